@@ -0,0 +1,122 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <common/crc.hpp>
+
+namespace
+{
+using framework::uint8;
+using framework::usize;
+using framework::utils::crc;
+using framework::utils::crc_engine;
+
+constexpr usize data_size  = 32 * 1024 * 1024;
+constexpr usize iterations = 3;
+
+template <typename Crc, crc_engine Engine>
+struct with_engine;
+
+template <usize BitsCount,
+          framework::utils::crc_details::value_t<BitsCount> Polynome,
+          framework::utils::crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          framework::utils::crc_details::value_t<BitsCount> XorOut,
+          crc_engine OldEngine,
+          crc_engine Engine>
+struct with_engine<crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, OldEngine>, Engine>
+{
+    using type = crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>;
+};
+
+std::vector<uint8> generate_data()
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8> data(data_size);
+    std::generate(data.begin(), data.end(), [&]() { return static_cast<uint8>(distribution(generator)); });
+
+    return data;
+}
+
+template <typename Crc>
+void measure(const std::string& name, const std::vector<uint8>& data)
+{
+    using clock = std::chrono::steady_clock;
+
+    typename Crc::value_type value = 0;
+    clock::duration best           = clock::duration::max();
+
+    for (usize i = 0; i < iterations; ++i) {
+        const auto start = clock::now();
+        value            = Crc::calculate(data.data(), data.size());
+        best             = std::min(best, clock::now() - start);
+    }
+
+    const double seconds   = std::chrono::duration<double>(best).count();
+    const double megabytes = static_cast<double>(data.size()) / (1024.0 * 1024.0);
+
+    std::cout << std::left << std::setw(36) << name << std::right << std::setw(10) << std::fixed
+              << std::setprecision(1) << megabytes / seconds << " MB/s    0x" << std::hex
+              << static_cast<framework::uint64>(value) << std::dec << std::endl;
+}
+
+template <typename Crc>
+void measure_engines(const std::string& name, const std::vector<uint8>& data)
+{
+    measure<typename with_engine<Crc, crc_engine::bytewise>::type>(name + " bytewise", data);
+    measure<typename with_engine<Crc, crc_engine::slicing_by_8>::type>(name + " slicing-by-8", data);
+    measure<typename with_engine<Crc, crc_engine::slicing_by_16>::type>(name + " slicing-by-16", data);
+}
+
+} // namespace
+
+int main()
+{
+    using namespace framework::utils;
+
+    const std::vector<uint8> data = generate_data();
+
+    measure_engines<crc8>("CRC-8", data);
+    measure_engines<crc8_darc>("CRC-8/DARC", data);
+    measure_engines<crc16_buypas>("CRC-16/BUYPAS", data);
+    measure_engines<crc16_arc>("CRC-16/ARC", data);
+    measure_engines<crc32_bzip2>("CRC-32/BZIP2", data);
+    measure_engines<crc32>("CRC-32", data);
+    measure_engines<crc32c>("CRC-32C", data);
+    measure_engines<crc64_ecma_182>("CRC-64/ECMA-182", data);
+    measure_engines<crc64_xz>("CRC-64/XZ", data);
+
+    return 0;
+}
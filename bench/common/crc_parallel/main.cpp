@@ -0,0 +1,107 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <common/crc.hpp>
+
+namespace
+{
+using framework::uint8;
+using framework::usize;
+
+constexpr usize data_size  = 256 * 1024 * 1024;
+constexpr usize iterations = 3;
+
+std::vector<uint8> generate_data()
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8> data(data_size);
+    std::generate(data.begin(), data.end(), [&]() { return static_cast<uint8>(distribution(generator)); });
+
+    return data;
+}
+
+template <typename Crc>
+void measure(const std::string& name, const std::vector<uint8>& data, usize thread_count)
+{
+    using clock = std::chrono::steady_clock;
+
+    typename Crc::value_type value = 0;
+    clock::duration best           = clock::duration::max();
+
+    for (usize i = 0; i < iterations; ++i) {
+        const auto start = clock::now();
+        value            = Crc::calculate_parallel(data.data(), data.size(), thread_count);
+        best             = std::min(best, clock::now() - start);
+    }
+
+    const double seconds   = std::chrono::duration<double>(best).count();
+    const double gigabytes = static_cast<double>(data.size()) / (1024.0 * 1024.0 * 1024.0);
+
+    std::cout << std::left << std::setw(16) << name << std::right << std::setw(4) << thread_count << " threads"
+              << std::setw(10) << std::fixed << std::setprecision(2) << gigabytes / seconds << " GB/s    0x"
+              << std::hex << static_cast<framework::uint64>(value) << std::dec << std::endl;
+}
+
+template <typename Crc>
+void measure_threads(const std::string& name, const std::vector<uint8>& data)
+{
+    const usize max_threads = std::max<usize>(std::thread::hardware_concurrency(), 1);
+
+    for (usize thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+        measure<Crc>(name, data, thread_count);
+    }
+
+    if ((max_threads & (max_threads - 1)) != 0) {
+        measure<Crc>(name, data, max_threads);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    using namespace framework::utils;
+
+    const std::vector<uint8> data = generate_data();
+
+    measure_threads<crc16_arc>("CRC-16/ARC", data);
+    measure_threads<crc32_bzip2>("CRC-32/BZIP2", data);
+    measure_threads<crc32>("CRC-32", data);
+    measure_threads<crc32c>("CRC-32C", data);
+    measure_threads<crc64_xz>("CRC-64/XZ", data);
+
+    return 0;
+}
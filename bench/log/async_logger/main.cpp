@@ -0,0 +1,143 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log/async_logger.hpp>
+#include <log/batching_logger.hpp>
+#include <log/log.hpp>
+#include <log/stream_logger.hpp>
+
+namespace
+{
+using framework::log::async_logger;
+using framework::log::batching_logger;
+using framework::log::logger_base;
+using framework::log::overflow_policy;
+using framework::log::stream_logger;
+
+constexpr std::size_t messages_count = 400000;
+
+/// Discards everything, so only the logging overhead is measured.
+class null_buffer : public std::streambuf
+{
+protected:
+    int overflow(int character) override
+    {
+        return character;
+    }
+
+    std::streamsize xsputn(const char* /*data*/, std::streamsize count) override
+    {
+        return count;
+    }
+};
+
+void measure(const std::string& name,
+             const std::function<std::unique_ptr<logger_base>()>& create_logger,
+             std::size_t thread_count)
+{
+    using clock = std::chrono::steady_clock;
+
+    framework::log::set_logger(create_logger());
+
+    const std::size_t messages_per_thread = messages_count / thread_count;
+
+    const auto start = clock::now();
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread = 0; thread < thread_count; ++thread) {
+        threads.emplace_back([messages_per_thread, thread]() {
+            for (std::size_t i = 0; i < messages_per_thread; ++i) {
+                framework::log::info("bench") << "producer " << thread << " message " << i << std::endl;
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto produced = clock::now();
+
+    framework::log::logger()->flush();
+
+    const auto written = clock::now();
+
+    const auto total        = static_cast<double>(messages_per_thread * thread_count);
+    const double producing  = std::chrono::duration<double>(produced - start).count();
+    const double processing = std::chrono::duration<double>(written - start).count();
+
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(4) << thread_count << " threads"
+              << std::setw(14) << std::fixed << std::setprecision(0) << total / producing << " msg/s produced"
+              << std::setw(14) << total / processing << " msg/s written" << std::endl;
+}
+
+} // namespace
+
+int main()
+{
+    null_buffer buffer;
+    std::ostream output(&buffer);
+
+    const std::size_t max_threads = std::max<std::size_t>(std::thread::hardware_concurrency() * 2, 8);
+
+    for (std::size_t thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+        measure("stream_logger", [&output]() { return std::make_unique<stream_logger>(output); }, thread_count);
+
+        measure("async_logger (block)",
+                [&output]() {
+                    return std::make_unique<async_logger>(std::make_unique<stream_logger>(output),
+                                                          8192,
+                                                          overflow_policy::block);
+                },
+                thread_count);
+
+        measure("async_logger (drop_oldest)",
+                [&output]() {
+                    return std::make_unique<async_logger>(std::make_unique<stream_logger>(output),
+                                                          8192,
+                                                          overflow_policy::drop_oldest);
+                },
+                thread_count);
+
+        measure("batching_logger",
+                [&output]() { return std::make_unique<batching_logger>(std::make_unique<stream_logger>(output)); },
+                thread_count);
+    }
+
+    framework::log::set_logger(nullptr);
+
+    return 0;
+}
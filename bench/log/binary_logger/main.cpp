@@ -0,0 +1,185 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log/binary_logger.hpp>
+#include <log/log.hpp>
+#include <log/stream_logger.hpp>
+
+namespace
+{
+using framework::usize;
+using framework::log::binary_logger;
+using framework::log::severity_level;
+using framework::log::stream_logger;
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr usize messages_count = 1000000;
+constexpr usize file_size      = 64 * 1024 * 1024;
+
+const std::string log_path = "binary_logger_bench.blog";
+
+class null_buffer : public std::streambuf
+{
+protected:
+    int overflow(int character) override
+    {
+        return character;
+    }
+
+    std::streamsize xsputn(const char* /*data*/, std::streamsize count) override
+    {
+        return count;
+    }
+};
+
+void print(const std::string& name, clock_type::duration duration, usize bytes)
+{
+    const double nanoseconds = std::chrono::duration<double, std::nano>(duration).count();
+
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << nanoseconds / messages_count << " ns/message";
+
+    if (bytes > 0) {
+        std::cout << std::setw(10) << static_cast<double>(bytes) / messages_count << " bytes/message";
+    }
+
+    std::cout << std::endl;
+}
+
+usize file_size_of(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return 0;
+    }
+
+    std::fseek(file, 0, SEEK_END);
+    const long size = std::ftell(file);
+    std::fclose(file);
+
+    return size > 0 ? static_cast<usize>(size) : 0;
+}
+
+void measure_binary_write()
+{
+    std::remove(log_path.c_str());
+
+    clock_type::duration duration{};
+    {
+        binary_logger logger(log_path, file_size, 1);
+
+        const auto start = clock_type::now();
+        for (usize i = 0; i < messages_count; ++i) {
+            logger.write(severity_level::info, "bench", "frame {} took {:.3f} ms", i, 16.6);
+        }
+        duration = clock_type::now() - start;
+    }
+
+    print("binary_logger::write", duration, file_size_of(log_path));
+    std::remove(log_path.c_str());
+}
+
+void measure_binary_call_site()
+{
+    std::remove(log_path.c_str());
+
+    clock_type::duration duration{};
+    {
+        binary_logger logger(log_path, file_size, 1);
+
+        const auto start = clock_type::now();
+        for (usize i = 0; i < messages_count; ++i) {
+            FRAMEWORK_LOG_BINARY(logger, info, "bench", "frame {} took {:.3f} ms", i, 16.6);
+        }
+        duration = clock_type::now() - start;
+    }
+
+    print("FRAMEWORK_LOG_BINARY", duration, file_size_of(log_path));
+    std::remove(log_path.c_str());
+}
+
+void measure_binary_stream()
+{
+    std::remove(log_path.c_str());
+
+    framework::log::set_logger(std::make_unique<binary_logger>(log_path, file_size, 1));
+
+    const auto start = clock_type::now();
+    for (usize i = 0; i < messages_count; ++i) {
+        framework::log::info("bench") << "frame " << i << " took " << 16.6 << " ms" << std::endl;
+    }
+    const auto duration = clock_type::now() - start;
+
+    framework::log::set_logger(nullptr);
+
+    print("binary_logger via log::info", duration, file_size_of(log_path));
+    std::remove(log_path.c_str());
+}
+
+void measure_stream()
+{
+    std::stringstream counter;
+    null_buffer buffer;
+    std::ostream output(&buffer);
+
+    framework::log::set_logger(std::make_unique<stream_logger>(output, false));
+
+    const auto start = clock_type::now();
+    for (usize i = 0; i < messages_count; ++i) {
+        framework::log::info("bench") << "frame " << i << " took " << 16.6 << " ms" << std::endl;
+    }
+    const auto duration = clock_type::now() - start;
+
+    framework::log::set_logger(nullptr);
+
+    // Size of the same text line, the stream itself discards output.
+    counter << "[" << severity_level::info << "] bench: frame " << messages_count / 2 << " took " << 16.6 << " ms\n";
+
+    print("stream_logger (null stream)", duration, counter.str().size() * messages_count);
+}
+
+} // namespace
+
+int main()
+{
+    measure_binary_write();
+    measure_binary_call_site();
+    measure_binary_stream();
+    measure_stream();
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <log/file_logger.hpp>
+#include <log/log.hpp>
+#include <log/stream_logger.hpp>
+
+namespace
+{
+using framework::log::file_logger;
+using framework::log::logger_base;
+using framework::log::stream_logger;
+
+constexpr std::size_t messages_count = 400000;
+
+const std::string path = "file_logger_bench.log";
+
+void measure(const std::string& name, const std::function<std::unique_ptr<logger_base>()>& create_logger)
+{
+    using clock = std::chrono::steady_clock;
+
+    framework::log::set_logger(create_logger());
+
+    const auto start = clock::now();
+
+    for (std::size_t i = 0; i < messages_count; ++i) {
+        framework::log::info("bench") << "message " << i << std::endl;
+    }
+
+    framework::log::set_logger(nullptr);
+
+    const auto stop = clock::now();
+
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+
+    std::cout << std::left << std::setw(32) << name << std::right << std::setw(14) << std::fixed
+              << std::setprecision(0) << static_cast<double>(messages_count) / seconds << " msg/s" << std::endl;
+}
+
+/// Keeps the file stream alive while the logger uses it.
+class ofstream_logger : public stream_logger
+{
+public:
+    explicit ofstream_logger(std::unique_ptr<std::ofstream> file) : stream_logger(*file), m_file(std::move(file))
+    {}
+
+    void add_message(framework::log::severity_level level, std::string_view tag, std::string_view message) override
+    {
+        stream_logger::add_message(level, tag, message);
+        flush();
+    }
+
+private:
+    std::unique_ptr<std::ofstream> m_file;
+};
+
+} // namespace
+
+int main()
+{
+    measure("ofstream, flush per message", []() {
+        return std::make_unique<ofstream_logger>(std::make_unique<std::ofstream>(path));
+    });
+
+    measure("file_logger", []() { return std::make_unique<file_logger>(path, 64 * 1024 * 1024, 1); });
+
+    std::remove(path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <common/utils.hpp>
+#include <log/async_logger.hpp>
+#include <log/batching_logger.hpp>
+#include <log/log.hpp>
+#include <log/stream_logger.hpp>
+
+namespace
+{
+using framework::float64;
+using framework::uint64;
+using framework::usize;
+using framework::log::logger_base;
+using framework::log::severity_level;
+using framework::log::log_details::timestamp_ticks;
+
+constexpr usize messages_count = 100000;
+
+/// Discards everything, so only the logging overhead is measured.
+class null_buffer : public std::streambuf
+{
+protected:
+    int overflow(int character) override
+    {
+        return character;
+    }
+
+    std::streamsize xsputn(const char* /*data*/, std::streamsize count) override
+    {
+        return count;
+    }
+};
+
+struct backend
+{
+    std::string name;
+    std::function<std::unique_ptr<logger_base>()> create;
+};
+
+struct result
+{
+    std::string logger;
+    usize threads;
+    bool long_message;
+    bool enabled;
+    float64 messages_per_second;
+    float64 p50;
+    float64 p99;
+    float64 p999;
+    float64 max;
+};
+
+/// Logs one message, debug messages are filtered out by the severity level.
+///
+/// The filtered message is logged by the function, `FRAMEWORK_LOG_DEBUG` is compiled out@n
+/// in release builds and would measure nothing.
+void log_message(bool enabled, const std::string& text, usize thread, usize index)
+{
+    if (enabled) {
+        FRAMEWORK_LOG_INFO("bench").format("producer {} message {}: {}\n", thread, index, text);
+    } else {
+        framework::log::debug("bench").format("producer {} message {}: {}\n", thread, index, text);
+    }
+}
+
+result measure(const backend& logger, usize thread_count, bool long_message, bool enabled)
+{
+    using clock = std::chrono::steady_clock;
+
+    framework::log::set_logger(logger.create());
+    framework::log::set_level(severity_level::info);
+
+    const std::string text = long_message ? std::string(512, 'x') : std::string("short");
+
+    const usize messages_per_thread = messages_count / thread_count;
+
+    std::vector<std::vector<uint64>> latencies(thread_count);
+    std::atomic<usize> ready{0};
+    std::atomic<bool> start{false};
+
+    std::vector<std::thread> threads;
+    for (usize thread = 0; thread < thread_count; ++thread) {
+        threads.emplace_back([&, thread]() {
+            auto& samples = latencies[thread];
+            samples.resize(messages_per_thread);
+
+            ready.fetch_add(1);
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+
+            for (usize i = 0; i < messages_per_thread; ++i) {
+                const uint64 begin = timestamp_ticks();
+                log_message(enabled, text, thread, i);
+                samples[i] = timestamp_ticks() - begin;
+            }
+        });
+    }
+
+    while (ready.load() != thread_count) {
+        std::this_thread::yield();
+    }
+
+    const auto start_time = clock::now();
+    start.store(true);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    framework::log::logger()->flush();
+
+    const float64 elapsed = std::chrono::duration<float64>(clock::now() - start_time).count();
+
+    std::vector<uint64> samples;
+    samples.reserve(messages_per_thread * thread_count);
+    for (const auto& thread_samples : latencies) {
+        samples.insert(samples.end(), thread_samples.begin(), thread_samples.end());
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    const float64 tick = framework::log::log_details::calibration().nanoseconds_per_tick;
+    const auto percentile = [&samples, tick](float64 fraction) {
+        const auto index = static_cast<usize>(fraction * static_cast<float64>(samples.size() - 1));
+        return static_cast<float64>(samples[index]) * tick;
+    };
+
+    framework::log::set_logger(nullptr);
+
+    return {logger.name,
+            thread_count,
+            long_message,
+            enabled,
+            static_cast<float64>(samples.size()) / elapsed,
+            percentile(0.5),
+            percentile(0.99),
+            percentile(0.999),
+            static_cast<float64>(samples.back()) * tick};
+}
+
+void write_json(std::ostream& out, const std::vector<result>& results)
+{
+    using framework::utils::format;
+
+    out << "{\n  \"benchmark\": \"log_throughput\",\n  \"results\": [\n";
+
+    for (usize i = 0; i < results.size(); ++i) {
+        const result& item = results[i];
+
+        out << format(FRAMEWORK_FORMAT_STRING("    {{\"logger\": \"{}\", \"threads\": {}, \"message\": \"{}\", "
+                                              "\"severity\": \"{}\", \"messages_per_second\": {:.0f}, "
+                                              "\"latency_ns\": {{\"p50\": {:.1f}, \"p99\": {:.1f}, "
+                                              "\"p999\": {:.1f}, \"max\": {:.1f}}}}}{}\n"),
+                      item.logger,
+                      item.threads,
+                      item.long_message ? "long" : "short",
+                      item.enabled ? "enabled" : "filtered",
+                      item.messages_per_second,
+                      item.p50,
+                      item.p99,
+                      item.p999,
+                      item.max,
+                      i + 1 < results.size() ? "," : "");
+    }
+
+    out << "  ]\n}\n";
+}
+
+} // namespace
+
+/// Usage: `throughput [output.json]`, results are printed to the standard output if no file is given.
+int main(int argc, char** argv)
+{
+    using framework::log::async_logger;
+    using framework::log::batching_logger;
+    using framework::log::stream_logger;
+
+    null_buffer buffer;
+    std::ostream output(&buffer);
+
+    const std::vector<backend> backends = {
+    {"stream_logger", [&output]() { return std::make_unique<stream_logger>(output); }},
+    {"async_logger", [&output]() { return std::make_unique<async_logger>(std::make_unique<stream_logger>(output)); }},
+    {"batching_logger",
+     [&output]() { return std::make_unique<batching_logger>(std::make_unique<stream_logger>(output)); }},
+    };
+
+    const usize max_threads = std::max<usize>(std::thread::hardware_concurrency(), 4);
+
+    std::vector<result> results;
+    for (const auto& logger : backends) {
+        for (usize thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+            for (bool long_message : {false, true}) {
+                for (bool enabled : {true, false}) {
+                    results.push_back(measure(logger, thread_count, long_message, enabled));
+                }
+            }
+        }
+    }
+
+    if (argc > 1) {
+        std::ofstream file(argv[1]);
+        write_json(file, results);
+    } else {
+        write_json(std::cout, results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <math/math.hpp>
+
+namespace
+{
+using framework::float32;
+using framework::usize;
+using framework::math::matrix4f;
+using framework::math::vector4f;
+
+namespace details = framework::math::matrix_functions_details;
+
+constexpr usize matrices_count = 64 * 1024;
+constexpr usize iterations     = 20;
+
+std::vector<matrix4f> generate_matrices(unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float32> distribution(-1.0f, 1.0f);
+
+    std::vector<matrix4f> matrices(matrices_count);
+    for (auto& item : matrices) {
+        for (usize c = 0; c < 4; ++c) {
+            for (usize r = 0; r < 4; ++r) {
+                item[c][r] = distribution(generator);
+            }
+            item[c][c] += 4.0f;
+        }
+        item[0][3] = item[1][3] = item[2][3] = 0.0f;
+        item[3][3]                           = 1.0f;
+    }
+
+    return matrices;
+}
+
+/// Runs the kernel over all matrices and returns the best time in nanoseconds per call.
+template <typename Kernel>
+double measure(const std::vector<matrix4f>& lhs, const std::vector<matrix4f>& rhs, Kernel kernel)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::vector<matrix4f> result(matrices_count);
+    clock::duration best = clock::duration::max();
+
+    for (usize i = 0; i < iterations; ++i) {
+        const auto start = clock::now();
+        for (usize j = 0; j < matrices_count; ++j) {
+            result[j] = kernel(lhs[j], rhs[j]);
+        }
+        best = std::min(best, clock::now() - start);
+    }
+
+    float32 checksum = 0.0f;
+    for (const auto& item : result) {
+        checksum += item[0][0] + item[3][2];
+    }
+
+    // Keeps the results alive.
+    if (checksum == 0.12345f) {
+        std::cout << checksum;
+    }
+
+    return std::chrono::duration<double, std::nano>(best).count() / matrices_count;
+}
+
+template <typename Generic, typename Simd>
+void report(const std::string& name,
+            const std::vector<matrix4f>& lhs,
+            const std::vector<matrix4f>& rhs,
+            Generic generic,
+            Simd simd)
+{
+    const double generic_time = measure(lhs, rhs, generic);
+    const double simd_time    = measure(lhs, rhs, simd);
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << generic_time << " ns" << std::setw(10) << simd_time << " ns" << std::setw(8)
+              << generic_time / simd_time << "x" << std::endl;
+}
+
+} // namespace
+
+/// Compares the generic 4x4 float32 kernels (selected with explicit template arguments)
+/// with the default overloads, which are SIMD unless `FRAMEWORK_MATH_NO_SIMD` is defined.
+int main()
+{
+    using framework::math::operator*;
+
+#if defined(FRAMEWORK_MATH_SIMD)
+    std::cout << "SIMD enabled" << std::endl;
+#else
+    std::cout << "SIMD disabled" << std::endl;
+#endif
+
+    const auto lhs = generate_matrices(42);
+    const auto rhs = generate_matrices(24);
+
+    std::cout << std::left << std::setw(20) << "kernel" << std::right << std::setw(13) << "generic" << std::setw(13)
+              << "simd" << std::setw(9) << "speedup" << std::endl;
+
+    const auto generic_vector = [](const matrix4f& a, const matrix4f& b) {
+        const vector4f v = operator*<4, 4, float32, float32>(a, b[3]);
+        return matrix4f(v, v, v, v);
+    };
+    const auto simd_vector = [](const matrix4f& a, const matrix4f& b) {
+        const vector4f v = a * b[3];
+        return matrix4f(v, v, v, v);
+    };
+
+    report("multiply", lhs, rhs,
+           [](const matrix4f& a, const matrix4f& b) { return operator*<4, 4, 4, float32, float32>(a, b); },
+           [](const matrix4f& a, const matrix4f& b) { return a * b; });
+
+    report("matrix * vector", lhs, rhs, generic_vector, simd_vector);
+
+    report("transpose", lhs, rhs,
+           [](const matrix4f& a, const matrix4f&) { return details::transpose<4, float32>(a); },
+           [](const matrix4f& a, const matrix4f&) { return transpose(a); });
+
+    report("inverse", lhs, rhs,
+           [](const matrix4f& a, const matrix4f&) { return details::inverse<float32>(a); },
+           [](const matrix4f& a, const matrix4f&) { return inverse(a); });
+
+    report("affine_inverse", lhs, rhs,
+           [](const matrix4f& a, const matrix4f&) { return details::affine_inverse<float32>(a); },
+           [](const matrix4f& a, const matrix4f&) { return affine_inverse(a); });
+
+    report("inverse_transpose", lhs, rhs,
+           [](const matrix4f& a, const matrix4f&) { return details::inverse_transpose<float32>(a); },
+           [](const matrix4f& a, const matrix4f&) { return inverse_transpose(a); });
+
+    return 0;
+}
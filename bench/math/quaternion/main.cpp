@@ -0,0 +1,167 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <math/math.hpp>
+
+namespace
+{
+using framework::float32;
+using framework::usize;
+using framework::math::matrix4f;
+using framework::math::quaternionf;
+using framework::math::vector3f;
+
+constexpr usize rotations_count = 64 * 1024;
+constexpr usize iterations      = 20;
+constexpr float32 weight        = 0.3f;
+
+std::vector<quaternionf> generate_rotations(unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float32> distribution(-1.0f, 1.0f);
+
+    std::vector<quaternionf> rotations(rotations_count);
+    for (auto& item : rotations) {
+        const vector3f axis(distribution(generator), distribution(generator), distribution(generator) + 2.0f);
+        item = framework::math::angle_axis(3.0f * distribution(generator), normalize(axis));
+    }
+
+    return rotations;
+}
+
+/// Runs the kernel and returns the best time in nanoseconds per rotation.
+template <typename Kernel>
+double measure(Kernel kernel)
+{
+    using clock = std::chrono::steady_clock;
+
+    clock::duration best = clock::duration::max();
+
+    for (usize i = 0; i < iterations; ++i) {
+        const auto start = clock::now();
+        kernel();
+        best = std::min(best, clock::now() - start);
+    }
+
+    return std::chrono::duration<double, std::nano>(best).count() / rotations_count;
+}
+
+void report(const std::string& name, double matrix_time, double quaternion_time)
+{
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << matrix_time << " ns" << std::setw(10) << quaternion_time << " ns" << std::setw(8)
+              << matrix_time / quaternion_time << "x" << std::endl;
+}
+
+float32 first(const matrix4f& value)
+{
+    return value[0][0];
+}
+
+float32 first(const quaternionf& value)
+{
+    return value[0];
+}
+
+/// Keeps the results alive.
+template <typename T>
+void keep_alive(const std::vector<T>& values)
+{
+    float32 checksum = 0.0f;
+    for (const auto& item : values) {
+        checksum += first(item);
+    }
+
+    if (checksum == 0.12345f) {
+        std::cout << checksum;
+    }
+}
+
+} // namespace
+
+/// Compares blending and composition of the rotations stored as 4x4 matrices and as quaternions.
+int main()
+{
+#if defined(FRAMEWORK_MATH_SIMD)
+    std::cout << "SIMD enabled" << std::endl;
+#else
+    std::cout << "SIMD disabled" << std::endl;
+#endif
+
+    const auto from = generate_rotations(42);
+    const auto to   = generate_rotations(24);
+
+    std::vector<matrix4f> from_matrices;
+    std::vector<matrix4f> to_matrices;
+    for (usize i = 0; i < rotations_count; ++i) {
+        from_matrices.push_back(framework::math::matrix4_cast(from[i]));
+        to_matrices.push_back(framework::math::matrix4_cast(to[i]));
+    }
+
+    std::vector<matrix4f> matrices(rotations_count);
+    std::vector<quaternionf> quaternions(rotations_count);
+
+    std::cout << std::left << std::setw(20) << "kernel" << std::right << std::setw(13) << "matrix" << std::setw(13)
+              << "quaternion" << std::setw(9) << "speedup" << std::endl;
+
+    const double matrix_blend = measure([&]() {
+        for (usize i = 0; i < rotations_count; ++i) {
+            matrices[i] = from_matrices[i] * (1.0f - weight) + to_matrices[i] * weight;
+        }
+    });
+
+    report("blend (nlerp)", matrix_blend, measure([&]() {
+               framework::math::nlerp(from.data(), to.data(), rotations_count, weight, quaternions.data());
+           }));
+
+    report("blend (slerp)", matrix_blend, measure([&]() {
+               framework::math::slerp(from.data(), to.data(), rotations_count, weight, quaternions.data());
+           }));
+
+    report("compose",
+           measure([&]() {
+               for (usize i = 0; i < rotations_count; ++i) {
+                   matrices[i] = from_matrices[i] * to_matrices[i];
+               }
+           }),
+           measure([&]() {
+               for (usize i = 0; i < rotations_count; ++i) {
+                   quaternions[i] = from[i] * to[i];
+               }
+           }));
+
+    keep_alive(matrices);
+    keep_alive(quaternions);
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <math/math.hpp>
+
+namespace
+{
+using framework::float32;
+using framework::usize;
+using framework::math::vector4f;
+
+constexpr usize vertices_count = 1024 * 1024;
+constexpr usize iterations     = 10;
+
+/// Component-wise reference with the same math as the generic vector<4, T> implementation.
+struct scalar4
+{
+    float32 x, y, z, w;
+};
+
+template <typename V>
+struct vertex
+{
+    V position;
+    V normal;
+    V color;
+};
+
+scalar4 fma(const scalar4& a, const scalar4& b, const scalar4& c)
+{
+    return {a.x * b.x + c.x, a.y * b.y + c.y, a.z * b.z + c.z, a.w * b.w + c.w};
+}
+
+float32 dot(const scalar4& a, const scalar4& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+scalar4 normalize(const scalar4& value)
+{
+    const float32 scale = 1.0f / std::sqrt(dot(value, value));
+    return {value.x * scale, value.y * scale, value.z * scale, value.w * scale};
+}
+
+scalar4 shade(const scalar4& color, float32 intensity)
+{
+    const auto clamp = [](float32 value) { return value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value); };
+    return {clamp(color.x * intensity), clamp(color.y * intensity), clamp(color.z * intensity), color.w};
+}
+
+vector4f shade(const vector4f& color, float32 intensity)
+{
+    using framework::math::max;
+    using framework::math::min;
+
+    const vector4f result = min(max(color * intensity, 0.0f), 1.0f);
+    return {result.x, result.y, result.z, color.w};
+}
+
+/// Per-vertex work of a simple vertex shader: scale and move position, normalize normal, shade color.
+template <typename V>
+void process(std::vector<vertex<V>>& vertices, const V& scale, const V& offset, const V& light)
+{
+    using framework::math::dot;
+    using framework::math::fma;
+    using framework::math::normalize;
+
+    for (auto& item : vertices) {
+        item.position = fma(item.position, scale, offset);
+        item.normal   = normalize(item.normal);
+        item.color    = shade(item.color, dot(item.normal, light));
+    }
+}
+
+template <typename V>
+std::vector<vertex<V>> generate_vertices()
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float32> distribution(-1.0f, 1.0f);
+
+    std::vector<vertex<V>> vertices(vertices_count);
+    for (auto& item : vertices) {
+        item.position = V{distribution(generator), distribution(generator), distribution(generator), 1.0f};
+        item.normal   = V{distribution(generator), distribution(generator), distribution(generator), 0.0f};
+        item.color    = V{0.5f, 0.5f, 0.5f, 1.0f};
+    }
+
+    return vertices;
+}
+
+template <typename V>
+double measure(const std::string& name)
+{
+    using clock = std::chrono::steady_clock;
+
+    auto vertices = generate_vertices<V>();
+
+    const V scale{1.0f, 1.0f, 1.0f, 1.0f};
+    const V offset{0.0f, 0.0f, 0.0f, 0.0f};
+    const V light{0.0f, 0.707f, 0.707f, 0.0f};
+
+    clock::duration best = clock::duration::max();
+
+    for (usize i = 0; i < iterations; ++i) {
+        const auto start = clock::now();
+        process(vertices, scale, offset, light);
+        best = std::min(best, clock::now() - start);
+    }
+
+    float32 checksum = 0.0f;
+    for (const auto& item : vertices) {
+        checksum += item.position.x + item.normal.y + item.color.z;
+    }
+
+    const double nanoseconds = std::chrono::duration<double, std::nano>(best).count() / vertices_count;
+
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(10) << std::fixed
+              << std::setprecision(2) << nanoseconds << " ns/vertex    checksum " << checksum << std::endl;
+
+    return nanoseconds;
+}
+
+} // namespace
+
+/// Build with `FRAMEWORK_MATH_NO_SIMD` defined to measure the generic vector<4, T> implementation.
+int main()
+{
+#if defined(FRAMEWORK_MATH_SIMD)
+    std::cout << "SIMD enabled" << std::endl;
+#else
+    std::cout << "SIMD disabled" << std::endl;
+#endif
+
+    const double scalar = measure<scalar4>("scalar");
+    const double simd   = measure<vector4f>("vector4f");
+
+    std::cout << "speedup " << std::setprecision(2) << scalar / simd << "x" << std::endl;
+
+    return 0;
+}
@@ -30,7 +30,10 @@
 #ifndef FRAMEWORK_COMMON_CRC_HPP
 #define FRAMEWORK_COMMON_CRC_HPP
 
+#include <vector>
+
 #include <common/crc_details.hpp>
+#include <common/parallel_details.hpp>
 #include <common/types.hpp>
 
 namespace framework::utils
@@ -42,7 +45,7 @@ namespace framework::utils
 /// All parameters needed for computation passed as template parametrs,@n
 /// so it can be configured to any algorithm.
 ///
-/// There are predefined types for different `crc8`, `crc16` and `crc32` algorithms.
+/// There are predefined types for different `crc8`, `crc16`, `crc32` and `crc64` algorithms.
 ///
 /// Code example:
 /// @code
@@ -57,10 +60,34 @@ namespace framework::utils
 /// // CRC-32
 /// std::cout << "0x" << std::hex << crc32::calculate(data.begin(), data.end()) << std::endl;
 /// @endcode
+///
+/// Contiguous data (pointers, `std::vector` and `std::string` iterators) is processed@n
+/// several bytes per iteration by the slicing tables, selected with the `crc_engine` parameter.
+/// @code
+/// const framework::uint8* buffer = load_asset(...);
+/// const framework::uint32 checksum = crc32::calculate(buffer, buffer_size);
+/// @endcode
+///
+/// Reflected algorithms with the CRC-32 and CRC-32C polynomes are computed with PCLMULQDQ folding@n
+/// and SSE4.2 `crc32` instruction if CPU supports them, tables are used otherwise.
+///
+/// The crc value can be calculated at compile time.
+/// @code
+/// constexpr framework::uint8 data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+/// static_assert(crc32::calculate(std::begin(data), std::end(data)) == 0xCBF43926);
+/// @endcode
 
 /// @addtogroup crc_implementation
 /// @{
 
+/// @brief Table driven algorithm used to process contiguous data.
+enum class crc_engine
+{
+    bytewise      = 1, ///< One table, one byte per iteration.
+    slicing_by_8  = 8, ///< Eight tables, eight bytes per iteration.
+    slicing_by_16 = 16 ///< Sixteen tables, sixteen bytes per iteration.
+};
+
 /// @brief CRC implementation.
 ///
 /// @t_param BitsCount Bits count in result value.
@@ -69,18 +96,54 @@ namespace framework::utils
 /// @t_param ReflectIn Should reflect input bytes.
 /// @t_param ReflectOut Should reflect output value.
 /// @t_param XorOut Value to 'xor' with the result at the end.
+/// @t_param Engine Algorithm used to process contiguous data.
 template <usize BitsCount,
           crc_details::value_t<BitsCount> Polynome,
           crc_details::value_t<BitsCount> Init,
           bool ReflectIn,
           bool ReflectOut,
-          crc_details::value_t<BitsCount> XorOut>
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine = crc_engine::bytewise>
 class crc
 {
 public:
     /// @brief Crc value type.
     using value_type = crc_details::value_t<BitsCount>;
 
+    /// @brief Incremental crc computation.
+    ///
+    /// Data can be fed by chunks, the final value is the same as for the whole data.
+    class state
+    {
+    public:
+        /// @brief Creates state with initial crc value.
+        constexpr state() noexcept;
+
+        /// @brief Processes next chunk of contiguous data.
+        ///
+        /// @param data Pointer to the data.
+        /// @param size Size of the data in bytes.
+        constexpr void feed(const uint8* data, usize size) noexcept;
+
+        /// @brief Processes next chunk of data.
+        ///
+        /// @param begin Iterator that points to the begin of diapason.
+        /// @param end Iterator that points to the end of diapason.
+        template <typename Iterator>
+        constexpr void feed(Iterator begin, Iterator end);
+
+        /// @brief Calculates the crc value of all processed data.
+        ///
+        /// @return The crc value.
+        constexpr value_type finalize() const noexcept;
+
+        /// @brief Resets state to initial crc value.
+        constexpr void reset() noexcept;
+
+    private:
+        value_type m_value;
+    };
+
     /// @brief Calculates the crc value.
     ///
     /// @param begin Iterator that points to the begin of diapason.
@@ -88,7 +151,36 @@ public:
     ///
     /// @return The crc value.
     template <typename Iterator>
-    static value_type calculate(Iterator begin, Iterator end);
+    static constexpr value_type calculate(Iterator begin, Iterator end);
+
+    /// @brief Calculates the crc value of contiguous data.
+    ///
+    /// @param data Pointer to the data.
+    /// @param size Size of the data in bytes.
+    ///
+    /// @return The crc value.
+    static constexpr value_type calculate(const uint8* data, usize size) noexcept;
+
+    /// @brief Calculates the crc value of contiguous data on several threads.
+    ///
+    /// Data is split into equal blocks, crc of each block is calculated on a separate thread,
+    /// then values are merged with @ref combine.
+    ///
+    /// @param data Pointer to the data.
+    /// @param size Size of the data in bytes.
+    /// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+    ///
+    /// @return The crc value.
+    static value_type calculate_parallel(const uint8* data, usize size, usize thread_count = 0);
+
+    /// @brief Combines crc values of two consecutive data blocks.
+    ///
+    /// @param crc_a The crc value of the first block.
+    /// @param crc_b The crc value of the second block.
+    /// @param size_b Size of the second block in bytes.
+    ///
+    /// @return The crc value of both blocks.
+    static constexpr value_type combine(value_type crc_a, value_type crc_b, usize size_b) noexcept;
 
     /// @brief Updates crc value.
     ///
@@ -101,54 +193,74 @@ public:
     static value_type update(uint8 byte, value_type crc) noexcept;
 
 private:
-    constexpr static usize crc_table_size = 256;
-    constexpr static crc_details::crc_table_t<BitsCount, crc_table_size>
-    crc_table = crc_details::generate_table<BitsCount, Polynome, crc_table_size>();
+    constexpr static usize slices_count       = static_cast<usize>(Engine);
+    constexpr static usize parallel_block_min = 256 * 1024;
+
+    static_assert(slices_count == 1 || slices_count >= BitsCount / 8, "Slice should cover the whole crc value.");
+
+    // Reflected algorithms keep the register reflected, so input bytes are never reflected.
+    constexpr static value_type init_value = ReflectIn ? crc_details::reflect<BitsCount>(Init) : Init;
+
+    constexpr static crc_details::slicing_table_t<BitsCount, slices_count>
+    crc_tables = crc_details::generate_slicing_table<BitsCount, Polynome, slices_count, ReflectIn>();
+
+    constexpr static crc_details::crc_table_t<BitsCount, 256>
+    normal_table = crc_details::generate_table<BitsCount, Polynome, 256>();
+
+    static constexpr value_type process(const uint8* data, usize size, value_type value) noexcept;
+    static constexpr value_type process_slice(const uint8* data, value_type value) noexcept;
+    static constexpr value_type process_byte(uint8 byte, value_type value) noexcept;
+    static constexpr value_type finalize(value_type value) noexcept;
+    static constexpr value_type unfinalize(value_type value) noexcept;
 };
 
 // clang-format off
-using crc8          = crc<8, 0x07, 0x00, false, false, 0x00>; ///< Predefined CRC-8 algorithm.
-using crc8_cdma2000 = crc<8, 0x9B, 0xFF, false, false, 0x00>; ///< Predefined CRC-8/CDMA2000 algorithm.
-using crc8_darc     = crc<8, 0x39, 0x00, true,  true,  0x00>; ///< Predefined CRC-8/DARC algorithm.
-using crc8_dvb_s2   = crc<8, 0xD5, 0x00, false, false, 0x00>; ///< Predefined CRC-8/DVB-S2 algorithm.
-using crc8_ebu      = crc<8, 0x1D, 0xFF, true,  true,  0x00>; ///< Predefined CRC-8/EBU algorithm.
-using crc8_i_code   = crc<8, 0x1D, 0xFD, false, false, 0x00>; ///< Predefined CRC-8/I-CODE algorithm.
-using crc8_itu      = crc<8, 0x07, 0x00, false, false, 0x55>; ///< Predefined CRC-8/ITU algorithm.
-using crc8_maxim    = crc<8, 0x31, 0x00, true,  true,  0x00>; ///< Predefined CRC-8/MAXIM algorithm.
-using crc8_rohc     = crc<8, 0x07, 0xFF, true,  true,  0x00>; ///< Predefined CRC-8/ROHC algorithm.
-using crc8_wcdma    = crc<8, 0x9B, 0x00, true,  true,  0x00>; ///< Predefined CRC-8/WCDMA algorithm.
-
-using crc16_ccitt_false = crc<16, 0x1021, 0xFFFF, false, false, 0x0000>; ///< Predefined CRC-16/CCITT-FALSE algorithm.
-using crc16_arc         = crc<16, 0x8005, 0x0000, true,  true,  0x0000>; ///< Predefined CRC-16/ARC algorithm.
-using crc16_aug_ccitt   = crc<16, 0x1021, 0x1D0F, false, false, 0x0000>; ///< Predefined CRC-16/AUG-CCITT algorithm.
-using crc16_buypas      = crc<16, 0x8005, 0x0000, false, false, 0x0000>; ///< Predefined CRC-16/BUYPAS algorithm.
-using crc16_cdma2000    = crc<16, 0xC867, 0xFFFF, false, false, 0x0000>; ///< Predefined CRC-16/CDMA2000 algorithm.
-using crc16_dds_110     = crc<16, 0x8005, 0x800D, false, false, 0x0000>; ///< Predefined CRC-16/DDS-110 algorithm.
-using crc16_dect_r      = crc<16, 0x0589, 0x0000, false, false, 0x0001>; ///< Predefined CRC-16/DECT-R algorithm.
-using crc16_dect_x      = crc<16, 0x0589, 0x0000, false, false, 0x0000>; ///< Predefined CRC-16/DECT-X algorithm.
-using crc16_genibus     = crc<16, 0x1021, 0xFFFF, false, false, 0xFFFF>; ///< Predefined CRC-16/GENIBUS algorithm.
-using crc16_maxim       = crc<16, 0x8005, 0x0000, true,  true,  0xFFFF>; ///< Predefined CRC-16/MAXIM algorithm.
-using crc16_mcrf4xx     = crc<16, 0x1021, 0xFFFF, true,  true,  0x0000>; ///< Predefined CRC-16/MCRF4XX algorithm.
-using crc16_riello      = crc<16, 0x1021, 0xB2AA, true,  true,  0x0000>; ///< Predefined CRC-16/RIELLO algorithm.
-using crc16_t0_dif      = crc<16, 0x8BB7, 0x0000, false, false, 0x0000>; ///< Predefined CRC-16/T0-DIF algorithm.
-using crc16_teledisk    = crc<16, 0xA097, 0x0000, false, false, 0x0000>; ///< Predefined CRC-16/TELEDISK algorithm.
-using crc16_tms37157    = crc<16, 0x1021, 0x89EC, true,  true,  0x0000>; ///< Predefined CRC-16/TMS37157 algorithm.
-using crc16_usb         = crc<16, 0x8005, 0xFFFF, true,  true,  0xFFFF>; ///< Predefined CRC-16/USB algorithm.
-using crc16_a           = crc<16, 0x1021, 0xC6C6, true,  true,  0x0000>; ///< Predefined CRC-A algorithm.
-using crc16_kermit      = crc<16, 0x1021, 0x0000, true,  true,  0x0000>; ///< Predefined CRC-16/KERMIT algorithm.
-using crc16_modbus      = crc<16, 0x8005, 0xFFFF, true,  true,  0x0000>; ///< Predefined CRC-16/MODBUS algorithm.
-using crc16_x_25        = crc<16, 0x1021, 0xFFFF, true,  true,  0xFFFF>; ///< Predefined CRC-16/X-25 algorithm.
-using crc16_xmodem      = crc<16, 0x1021, 0x0000, false, false, 0x0000>; ///< Predefined CRC-16/XMODEM algorithm.
-
-using crc32        = crc<32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF>; ///< Predefined CRC-32 algorithm.
-using crc32_bzip2  = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF>; ///< Predefined CRC-32/BZIP2 algorithm.
-using crc32c       = crc<32, 0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF>; ///< Predefined CRC-32C algorithm.
-using crc32d       = crc<32, 0xA833982B, 0xFFFFFFFF, true,  true,  0xFFFFFFFF>; ///< Predefined CRC-32D algorithm.
-using crc32_mpeg_2 = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000>; ///< Predefined CRC-32/MPEG-2 algorithm.
-using crc32_posix  = crc<32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF>; ///< Predefined CRC-32/POSIX algorithm.
-using crc32q       = crc<32, 0x814141AB, 0x00000000, false, false, 0x00000000>; ///< Predefined CRC-32Q algorithm.
-using crc32_jamcrc = crc<32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0x00000000>; ///< Predefined CRC-32/JAMCRC algorithm.
-using crc32_xfer   = crc<32, 0x000000AF, 0x00000000, false, false, 0x00000000>; ///< Predefined CRC-32/XFER algorithm.
+using crc8          = crc<8, 0x07, 0x00, false, false, 0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8 algorithm.
+using crc8_cdma2000 = crc<8, 0x9B, 0xFF, false, false, 0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/CDMA2000 algorithm.
+using crc8_darc     = crc<8, 0x39, 0x00, true,  true,  0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/DARC algorithm.
+using crc8_dvb_s2   = crc<8, 0xD5, 0x00, false, false, 0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/DVB-S2 algorithm.
+using crc8_ebu      = crc<8, 0x1D, 0xFF, true,  true,  0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/EBU algorithm.
+using crc8_i_code   = crc<8, 0x1D, 0xFD, false, false, 0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/I-CODE algorithm.
+using crc8_itu      = crc<8, 0x07, 0x00, false, false, 0x55, crc_engine::slicing_by_8>; ///< Predefined CRC-8/ITU algorithm.
+using crc8_maxim    = crc<8, 0x31, 0x00, true,  true,  0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/MAXIM algorithm.
+using crc8_rohc     = crc<8, 0x07, 0xFF, true,  true,  0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/ROHC algorithm.
+using crc8_wcdma    = crc<8, 0x9B, 0x00, true,  true,  0x00, crc_engine::slicing_by_8>; ///< Predefined CRC-8/WCDMA algorithm.
+
+using crc16_ccitt_false = crc<16, 0x1021, 0xFFFF, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/CCITT-FALSE algorithm.
+using crc16_arc         = crc<16, 0x8005, 0x0000, true,  true,  0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/ARC algorithm.
+using crc16_aug_ccitt   = crc<16, 0x1021, 0x1D0F, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/AUG-CCITT algorithm.
+using crc16_buypas      = crc<16, 0x8005, 0x0000, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/BUYPAS algorithm.
+using crc16_cdma2000    = crc<16, 0xC867, 0xFFFF, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/CDMA2000 algorithm.
+using crc16_dds_110     = crc<16, 0x8005, 0x800D, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/DDS-110 algorithm.
+using crc16_dect_r      = crc<16, 0x0589, 0x0000, false, false, 0x0001, crc_engine::slicing_by_8>; ///< Predefined CRC-16/DECT-R algorithm.
+using crc16_dect_x      = crc<16, 0x0589, 0x0000, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/DECT-X algorithm.
+using crc16_genibus     = crc<16, 0x1021, 0xFFFF, false, false, 0xFFFF, crc_engine::slicing_by_8>; ///< Predefined CRC-16/GENIBUS algorithm.
+using crc16_maxim       = crc<16, 0x8005, 0x0000, true,  true,  0xFFFF, crc_engine::slicing_by_8>; ///< Predefined CRC-16/MAXIM algorithm.
+using crc16_mcrf4xx     = crc<16, 0x1021, 0xFFFF, true,  true,  0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/MCRF4XX algorithm.
+using crc16_riello      = crc<16, 0x1021, 0xB2AA, true,  true,  0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/RIELLO algorithm.
+using crc16_t0_dif      = crc<16, 0x8BB7, 0x0000, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/T0-DIF algorithm.
+using crc16_teledisk    = crc<16, 0xA097, 0x0000, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/TELEDISK algorithm.
+using crc16_tms37157    = crc<16, 0x1021, 0x89EC, true,  true,  0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/TMS37157 algorithm.
+using crc16_usb         = crc<16, 0x8005, 0xFFFF, true,  true,  0xFFFF, crc_engine::slicing_by_8>; ///< Predefined CRC-16/USB algorithm.
+using crc16_a           = crc<16, 0x1021, 0xC6C6, true,  true,  0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-A algorithm.
+using crc16_kermit      = crc<16, 0x1021, 0x0000, true,  true,  0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/KERMIT algorithm.
+using crc16_modbus      = crc<16, 0x8005, 0xFFFF, true,  true,  0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/MODBUS algorithm.
+using crc16_x_25        = crc<16, 0x1021, 0xFFFF, true,  true,  0xFFFF, crc_engine::slicing_by_8>; ///< Predefined CRC-16/X-25 algorithm.
+using crc16_xmodem      = crc<16, 0x1021, 0x0000, false, false, 0x0000, crc_engine::slicing_by_8>; ///< Predefined CRC-16/XMODEM algorithm.
+
+using crc32        = crc<32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, crc_engine::slicing_by_16>; ///< Predefined CRC-32 algorithm.
+using crc32_bzip2  = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, crc_engine::slicing_by_16>; ///< Predefined CRC-32/BZIP2 algorithm.
+using crc32c       = crc<32, 0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, crc_engine::slicing_by_16>; ///< Predefined CRC-32C algorithm.
+using crc32d       = crc<32, 0xA833982B, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, crc_engine::slicing_by_16>; ///< Predefined CRC-32D algorithm.
+using crc32_mpeg_2 = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000, crc_engine::slicing_by_16>; ///< Predefined CRC-32/MPEG-2 algorithm.
+using crc32_posix  = crc<32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF, crc_engine::slicing_by_16>; ///< Predefined CRC-32/POSIX algorithm.
+using crc32q       = crc<32, 0x814141AB, 0x00000000, false, false, 0x00000000, crc_engine::slicing_by_16>; ///< Predefined CRC-32Q algorithm.
+using crc32_jamcrc = crc<32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0x00000000, crc_engine::slicing_by_16>; ///< Predefined CRC-32/JAMCRC algorithm.
+using crc32_xfer   = crc<32, 0x000000AF, 0x00000000, false, false, 0x00000000, crc_engine::slicing_by_16>; ///< Predefined CRC-32/XFER algorithm.
+
+using crc64_ecma_182 = crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000, crc_engine::slicing_by_16>; ///< Predefined CRC-64/ECMA-182 algorithm.
+using crc64_go_iso   = crc<64, 0x000000000000001B, 0xFFFFFFFFFFFFFFFF, true,  true,  0xFFFFFFFFFFFFFFFF, crc_engine::slicing_by_16>; ///< Predefined CRC-64/GO-ISO algorithm.
+using crc64_xz       = crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true,  true,  0xFFFFFFFFFFFFFFFF, crc_engine::slicing_by_16>; ///< Predefined CRC-64/XZ algorithm.
 // clang-format on
 
 /// @}
@@ -160,28 +272,251 @@ template <usize BitsCount,
           crc_details::value_t<BitsCount> Init,
           bool ReflectIn,
           bool ReflectOut,
-          crc_details::value_t<BitsCount> XorOut>
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
 template <typename Iterator>
-inline typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut>::value_type crc<
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
 BitsCount,
 Polynome,
 Init,
 ReflectIn,
 ReflectOut,
-XorOut>::calculate(Iterator begin, Iterator end)
+XorOut,
+Engine>::calculate(Iterator begin, Iterator end)
 {
-    constexpr usize input_value_size = sizeof(typename std::iterator_traits<Iterator>::value_type);
+    state crc_state;
+    crc_state.feed(begin, end);
+    return crc_state.finalize();
+}
 
-    value_type value = Init;
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::calculate(const uint8* data, usize size) noexcept
+{
+    return finalize(process(data, size, init_value));
+}
 
-    for (; begin != end; ++begin) {
-        for (usize i = 0; i < input_value_size; ++i) {
-            const uint8 byte = ((*begin) >> (i * 8)) & 0xFF;
-            value            = update(ReflectIn ? crc_details::reflect<8>(byte) : byte, value);
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+inline typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::calculate_parallel(const uint8* data, usize size, usize thread_count)
+{
+    const usize blocks_count = parallel_details::count_blocks(size, thread_count, parallel_block_min);
+    if (blocks_count <= 1) {
+        return calculate(data, size);
+    }
+
+    std::vector<value_type> values(blocks_count);
+
+    parallel_details::parallel_for(size, blocks_count, [data, &values](usize index, usize begin, usize block_size) {
+        values[index] = calculate(data + begin, block_size);
+    });
+
+    value_type value = values[0];
+    for (usize i = 1; i < blocks_count; ++i) {
+        value = combine(value, values[i], parallel_details::block_size(size, blocks_count, i));
+    }
+
+    return value;
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::combine(value_type crc_a, value_type crc_b, usize size_b) noexcept
+{
+    if (size_b == 0) {
+        return crc_a;
+    }
+
+    const value_type shifted = crc_details::shift_zeros<BitsCount, Polynome, ReflectIn>(unfinalize(crc_a) ^ init_value,
+                                                                                         size_b);
+    return finalize(shifted ^ unfinalize(crc_b));
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+inline typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::update(uint8 byte, value_type value) noexcept
+{
+    return crc_details::update_register<BitsCount, false>(normal_table, value, byte);
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::process(const uint8* data, usize size, value_type value) noexcept
+{
+    using crc_details::hardware_engine;
+
+    constexpr hardware_engine hardware = crc_details::get_hardware_engine<BitsCount, Polynome, ReflectIn>();
+
+    if constexpr (hardware == hardware_engine::crc32c) {
+        if (!crc_details::is_constant_evaluated() && crc_details::has_crc32c_instruction()) {
+            return crc_details::crc32c_hardware(data, size, value);
+        }
+    } else if constexpr (hardware == hardware_engine::crc32_folding) {
+        if (!crc_details::is_constant_evaluated() && size >= crc_details::folding_min_size &&
+            crc_details::has_carryless_multiplication()) {
+            const usize folding_size = size & ~static_cast<usize>(15);
+
+            value = crc_details::crc32_hardware(data, folding_size, value);
+
+            data += folding_size;
+            size -= folding_size;
+        }
+    } else if constexpr (hardware == hardware_engine::crc64_folding) {
+        if (!crc_details::is_constant_evaluated() && size >= crc_details::folding_min_size &&
+            crc_details::has_carryless_multiplication()) {
+            constexpr crc_details::folding_constants constants = crc_details::generate_folding_constants<Polynome>();
+
+            const usize folding_size = size & ~static_cast<usize>(15);
+
+            value = crc_details::crc64_hardware(data, folding_size, value, constants);
+
+            data += folding_size;
+            size -= folding_size;
         }
     }
 
-    if (ReflectOut) {
+    if constexpr (slices_count > 1) {
+        for (; size >= slices_count; size -= slices_count, data += slices_count) {
+            value = process_slice(data, value);
+        }
+    }
+
+    for (; size > 0; --size, ++data) {
+        value = process_byte(*data, value);
+    }
+
+    return value;
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::process_slice(const uint8* data, value_type value) noexcept
+{
+    constexpr usize value_size = BitsCount / 8;
+
+    value_type result = 0;
+
+    for (usize i = 0; i < slices_count; ++i) {
+        uint8 index = data[i];
+        if (i < value_size) {
+            const usize shift = ReflectIn ? 8 * i : BitsCount - 8 * (i + 1);
+            index ^= static_cast<uint8>(value >> shift);
+        }
+
+        result ^= crc_tables[slices_count - 1 - i][index];
+    }
+
+    return result;
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::process_byte(uint8 byte, value_type value) noexcept
+{
+    return crc_details::update_register<BitsCount, ReflectIn>(crc_tables[0], value, byte);
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::finalize(value_type value) noexcept
+{
+    if constexpr (ReflectIn != ReflectOut) {
         value = crc_details::reflect<BitsCount>(value);
     }
 
@@ -193,17 +528,106 @@ template <usize BitsCount,
           crc_details::value_t<BitsCount> Init,
           bool ReflectIn,
           bool ReflectOut,
-          crc_details::value_t<BitsCount> XorOut>
-inline typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut>::value_type crc<
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
 BitsCount,
 Polynome,
 Init,
 ReflectIn,
 ReflectOut,
-XorOut>::update(uint8 byte, value_type value) noexcept
+XorOut,
+Engine>::unfinalize(value_type value) noexcept
+{
+    value ^= XorOut;
+
+    if constexpr (ReflectIn != ReflectOut) {
+        value = crc_details::reflect<BitsCount>(value);
+    }
+
+    return value;
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::state::state() noexcept : m_value(init_value)
+{}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr void crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::state::feed(const uint8* data, usize size) noexcept
+{
+    m_value = process(data, size, m_value);
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+template <typename Iterator>
+constexpr void crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::state::feed(Iterator begin, Iterator end)
+{
+    if constexpr (crc_details::is_contiguous_bytes_iterator<Iterator>::value) {
+        if (!crc_details::is_constant_evaluated()) {
+            if (begin != end) {
+                feed(reinterpret_cast<const uint8*>(&*begin), static_cast<usize>(std::distance(begin, end)));
+            }
+            return;
+        }
+    }
+
+    constexpr usize input_value_size = sizeof(typename std::iterator_traits<Iterator>::value_type);
+
+    for (; begin != end; ++begin) {
+        for (usize i = 0; i < input_value_size; ++i) {
+            const auto byte = static_cast<uint8>(((*begin) >> (i * 8)) & 0xFF);
+            m_value         = process_byte(byte, m_value);
+        }
+    }
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr typename crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::value_type crc<
+BitsCount,
+Polynome,
+Init,
+ReflectIn,
+ReflectOut,
+XorOut,
+Engine>::state::finalize() const noexcept
+{
+    return crc::finalize(m_value);
+}
+
+template <usize BitsCount,
+          crc_details::value_t<BitsCount> Polynome,
+          crc_details::value_t<BitsCount> Init,
+          bool ReflectIn,
+          bool ReflectOut,
+          crc_details::value_t<BitsCount> XorOut,
+          crc_engine Engine>
+constexpr void crc<BitsCount, Polynome, Init, ReflectIn, ReflectOut, XorOut, Engine>::state::reset() noexcept
 {
-    const uint8 index = byte ^ (value >> (BitsCount - 8));
-    return crc_table[index] ^ (value << 8);
+    m_value = init_value;
 }
 #pragma endregion
 
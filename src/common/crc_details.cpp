@@ -0,0 +1,317 @@
+/// @file
+/// @brief CRC implementation details.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <cstring>
+
+#include <common/crc_details.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define FRAMEWORK_CRC_X86
+#endif
+
+#if defined(FRAMEWORK_CRC_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FRAMEWORK_CRC_TARGET(features) __attribute__((target(features)))
+#else
+#define FRAMEWORK_CRC_TARGET(features)
+#endif
+
+namespace
+{
+using framework::uint32;
+using framework::uint64;
+using framework::uint8;
+using framework::usize;
+
+struct cpu_features
+{
+    bool sse41  = false;
+    bool sse42  = false;
+    bool pclmul = false;
+};
+
+cpu_features detect_cpu_features()
+{
+    cpu_features features;
+
+#if defined(FRAMEWORK_CRC_X86)
+#if defined(_MSC_VER)
+    int registers[4] = {0};
+    __cpuid(registers, 1);
+    const auto ecx = static_cast<uint32>(registers[2]);
+#else
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return features;
+    }
+#endif
+
+    features.pclmul = (ecx & (1u << 1)) != 0;
+    features.sse41  = (ecx & (1u << 19)) != 0;
+    features.sse42  = (ecx & (1u << 20)) != 0;
+#endif
+
+    return features;
+}
+
+const cpu_features& get_cpu_features()
+{
+    static const cpu_features features = detect_cpu_features();
+    return features;
+}
+
+#if defined(FRAMEWORK_CRC_X86)
+
+FRAMEWORK_CRC_TARGET("sse4.2")
+uint32 crc32c_sse42(const uint8* data, usize size, uint32 value) noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64 value64 = value;
+    for (; size >= 8; size -= 8, data += 8) {
+        uint64 chunk = 0;
+        std::memcpy(&chunk, data, sizeof(chunk));
+        value64 = _mm_crc32_u64(value64, chunk);
+    }
+    value = static_cast<uint32>(value64);
+#endif
+
+    for (; size >= 4; size -= 4, data += 4) {
+        uint32 chunk = 0;
+        std::memcpy(&chunk, data, sizeof(chunk));
+        value = _mm_crc32_u32(value, chunk);
+    }
+
+    for (; size > 0; --size, ++data) {
+        value = _mm_crc32_u8(value, *data);
+    }
+
+    return value;
+}
+
+FRAMEWORK_CRC_TARGET("pclmul,sse4.1")
+inline __m128i load(const uint8* data) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+FRAMEWORK_CRC_TARGET("pclmul,sse4.1")
+inline __m128i fold(__m128i value, __m128i next, __m128i constants) noexcept
+{
+    const __m128i low  = _mm_clmulepi64_si128(value, constants, 0x00);
+    const __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(high, next), low);
+}
+
+// Folding constants for the reflected 0x04C11DB7 polynome, see Intel white paper
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+FRAMEWORK_CRC_TARGET("pclmul,sse4.1")
+uint32 crc32_pclmul(const uint8* data, usize size, uint32 value) noexcept
+{
+    alignas(16) static const uint64 k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static const uint64 k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static const uint64 k5k0[] = {0x0163cd6124, 0x0000000000};
+    alignas(16) static const uint64 poly[] = {0x01db710641, 0x01f7011641};
+
+    __m128i x1 = load(data + 0x00);
+    __m128i x2 = load(data + 0x10);
+    __m128i x3 = load(data + 0x20);
+    __m128i x4 = load(data + 0x30);
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(value)));
+
+    __m128i x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+
+    data += 64;
+    size -= 64;
+
+    // Fold 64 bytes per iteration in four parallel streams.
+    for (; size >= 64; size -= 64, data += 64) {
+        x1 = fold(x1, load(data + 0x00), x0);
+        x2 = fold(x2, load(data + 0x10), x0);
+        x3 = fold(x3, load(data + 0x20), x0);
+        x4 = fold(x4, load(data + 0x30), x0);
+    }
+
+    // Fold streams into 128 bits.
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+
+    x1 = fold(x1, x2, x0);
+    x1 = fold(x1, x3, x0);
+    x1 = fold(x1, x4, x0);
+
+    for (; size >= 16; size -= 16, data += 16) {
+        x1 = fold(x1, load(data), x0);
+    }
+
+    // Fold 128 bits to 64 bits.
+    const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits.
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+
+    x2 = _mm_and_si128(x1, mask);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, mask);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32>(_mm_extract_epi32(x1, 1));
+}
+
+FRAMEWORK_CRC_TARGET("pclmul,sse4.1")
+uint64 crc64_pclmul(const uint8* data,
+                    usize size,
+                    uint64 value,
+                    const framework::utils::crc_details::folding_constants& constants) noexcept
+{
+    using framework::int64;
+
+    const __m128i fold_by_4 = _mm_set_epi64x(static_cast<int64>(constants.fold_by_4[1]),
+                                             static_cast<int64>(constants.fold_by_4[0]));
+    const __m128i fold_by_1 = _mm_set_epi64x(static_cast<int64>(constants.fold_by_1[1]),
+                                             static_cast<int64>(constants.fold_by_1[0]));
+
+    __m128i x1 = load(data + 0x00);
+    __m128i x2 = load(data + 0x10);
+    __m128i x3 = load(data + 0x20);
+    __m128i x4 = load(data + 0x30);
+
+    x1 = _mm_xor_si128(x1, _mm_set_epi64x(0, static_cast<int64>(value)));
+
+    data += 64;
+    size -= 64;
+
+    // Fold 64 bytes per iteration in four parallel streams.
+    for (; size >= 64; size -= 64, data += 64) {
+        x1 = fold(x1, load(data + 0x00), fold_by_4);
+        x2 = fold(x2, load(data + 0x10), fold_by_4);
+        x3 = fold(x3, load(data + 0x20), fold_by_4);
+        x4 = fold(x4, load(data + 0x30), fold_by_4);
+    }
+
+    // Fold streams into 128 bits.
+    x1 = fold(x1, x2, fold_by_1);
+    x1 = fold(x1, x3, fold_by_1);
+    x1 = fold(x1, x4, fold_by_1);
+
+    for (; size >= 16; size -= 16, data += 16) {
+        x1 = fold(x1, load(data), fold_by_1);
+    }
+
+    // Multiply by x^64 and reduce to 128 bits.
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, fold_by_1, 0x10), _mm_srli_si128(x1, 8));
+
+    // Barrett reduction to 64 bits.
+    const __m128i barrett = _mm_set_epi64x(static_cast<int64>(constants.polynome),
+                                           static_cast<int64>(constants.quotient));
+
+    alignas(16) uint64 remainder[2] = {0, 0};
+    alignas(16) uint64 quotient[2]  = {0, 0};
+    alignas(16) uint64 product[2]   = {0, 0};
+
+    _mm_store_si128(reinterpret_cast<__m128i*>(remainder), x1);
+    _mm_store_si128(reinterpret_cast<__m128i*>(quotient), _mm_clmulepi64_si128(x1, barrett, 0x00));
+    _mm_store_si128(reinterpret_cast<__m128i*>(product),
+                    _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64>(quotient[0])), barrett, 0x10));
+
+    return remainder[1] ^ product[1] ^ (constants.odd_polynome ? quotient[0] : 0);
+}
+
+#endif
+
+} // namespace
+
+namespace framework::utils::crc_details
+{
+bool has_crc32c_instruction() noexcept
+{
+    return get_cpu_features().sse42;
+}
+
+bool has_carryless_multiplication() noexcept
+{
+    return get_cpu_features().pclmul && get_cpu_features().sse41;
+}
+
+uint32 crc32c_hardware(const uint8* data, usize size, uint32 value) noexcept
+{
+#if defined(FRAMEWORK_CRC_X86)
+    return crc32c_sse42(data, size, value);
+#else
+    (void)data;
+    (void)size;
+    return value;
+#endif
+}
+
+uint32 crc32_hardware(const uint8* data, usize size, uint32 value) noexcept
+{
+#if defined(FRAMEWORK_CRC_X86)
+    return crc32_pclmul(data, size, value);
+#else
+    (void)data;
+    (void)size;
+    return value;
+#endif
+}
+
+uint64 crc64_hardware(const uint8* data, usize size, uint64 value, const folding_constants& constants) noexcept
+{
+#if defined(FRAMEWORK_CRC_X86)
+    return crc64_pclmul(data, size, value, constants);
+#else
+    (void)data;
+    (void)size;
+    (void)constants;
+    return value;
+#endif
+}
+
+} // namespace framework::utils::crc_details
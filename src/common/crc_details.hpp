@@ -31,12 +31,36 @@
 #define FRAMEWORK_COMMON_CRC_DETAILS_HPP
 
 #include <array>
+#include <iterator>
+#include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <common/types.hpp>
 
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define FRAMEWORK_CRC_CONSTEXPR
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#define FRAMEWORK_CRC_CONSTEXPR
+#endif
+
 namespace framework::utils::crc_details
 {
+/// @brief Checks if function is evaluated at compile time.
+///
+/// Without compiler support always returns `false`, so crc of contiguous data can't be calculated at compile time.
+constexpr bool is_constant_evaluated() noexcept
+{
+#if defined(FRAMEWORK_CRC_CONSTEXPR)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
 /// @brief Helper class to get correct type for crc::value_type.
 template <usize BitsCount>
 struct get_crc_value_type;
@@ -62,6 +86,13 @@ struct get_crc_value_type<32>
     using type = uint32;
 };
 
+/// @brief Helper class to get correct type for crc::value_type.
+template <>
+struct get_crc_value_type<64>
+{
+    using type = uint64;
+};
+
 /// @brief Value type short cut.
 template <usize BitsCount>
 using value_t = typename get_crc_value_type<BitsCount>::type;
@@ -70,48 +101,330 @@ using value_t = typename get_crc_value_type<BitsCount>::type;
 template <usize BitsCount, usize Size>
 using crc_table_t = std::array<value_t<BitsCount>, Size>;
 
-template <usize BitsCount, value_t<BitsCount> Polynome>
-constexpr value_t<BitsCount> generate_value(usize dividend) noexcept
+/// @brief Generates table of bytes with reflected bits.
+constexpr std::array<uint8, 256> generate_reflected_bytes() noexcept
 {
-    constexpr value_t<BitsCount> topbit = (1u << (BitsCount - 1));
+    std::array<uint8, 256> table{};
 
-    value_t<BitsCount> value = static_cast<value_t<BitsCount>>(dividend << (BitsCount - 8));
-    for (uint8 bit = 8; bit > 0; --bit) {
-        value = (value & topbit) ? (value << 1) ^ Polynome : value << 1;
+    for (usize i = 0; i < table.size(); ++i) {
+        for (usize bit = 0; bit < 8; ++bit) {
+            if (i & (usize{1} << bit)) {
+                table[i] |= static_cast<uint8>(1u << (7 - bit));
+            }
+        }
     }
 
-    return value;
+    return table;
+}
+
+/// @brief Bytes with reflected bits.
+inline constexpr std::array<uint8, 256> reflected_bytes = generate_reflected_bytes();
+
+/// @brief Reflects bits in value.
+template <usize BitsCount>
+constexpr value_t<BitsCount> reflect(value_t<BitsCount> value) noexcept
+{
+    value_t<BitsCount> result = 0;
+
+    for (usize i = 0; i < BitsCount / 8; ++i) {
+        result = static_cast<value_t<BitsCount>>((result << 8) | reflected_bytes[value & 0xFF]);
+        value  = static_cast<value_t<BitsCount>>(value >> 8);
+    }
+
+    return result;
+}
+
+/// @brief Updates crc register with one byte.
+///
+/// Reflected register is shifted to the right, normal one is shifted to the left.
+template <usize BitsCount, bool Reflected>
+constexpr value_t<BitsCount> update_register(const crc_table_t<BitsCount, 256>& table,
+                                             value_t<BitsCount> value,
+                                             uint8 byte) noexcept
+{
+    if constexpr (Reflected) {
+        return static_cast<value_t<BitsCount>>(table[(value ^ byte) & 0xFF] ^ (value >> 8));
+    } else {
+        return static_cast<value_t<BitsCount>>(table[((value >> (BitsCount - 8)) ^ byte) & 0xFF] ^ (value << 8));
+    }
+}
+
+template <usize BitsCount, value_t<BitsCount> Polynome, bool Reflected>
+constexpr value_t<BitsCount> generate_value(usize dividend) noexcept
+{
+    if constexpr (Reflected) {
+        constexpr value_t<BitsCount> polynome = reflect<BitsCount>(Polynome);
+
+        auto value = static_cast<value_t<BitsCount>>(dividend);
+        for (uint8 bit = 8; bit > 0; --bit) {
+            value = static_cast<value_t<BitsCount>>((value & 1) ? (value >> 1) ^ polynome : value >> 1);
+        }
+
+        return value;
+    } else {
+        constexpr value_t<BitsCount> topbit = value_t<BitsCount>{1} << (BitsCount - 1);
+
+        auto value = static_cast<value_t<BitsCount>>(dividend << (BitsCount - 8));
+        for (uint8 bit = 8; bit > 0; --bit) {
+            value = static_cast<value_t<BitsCount>>((value & topbit) ? (value << 1) ^ Polynome : value << 1);
+        }
+
+        return value;
+    }
 }
 
-template <usize BitsCount, value_t<BitsCount> Polynome, usize Size, usize... I>
+template <usize BitsCount, value_t<BitsCount> Polynome, bool Reflected, usize Size, usize... I>
 constexpr inline crc_table_t<BitsCount, Size> generate_table_impl(std::index_sequence<I...>) noexcept
 {
-    return {generate_value<BitsCount, Polynome>(I)...};
+    return {generate_value<BitsCount, Polynome, Reflected>(I)...};
 }
 
 /// @brief Geneates crc table at compile time.
-template <usize BitsCount, value_t<BitsCount> Polynome, usize Size>
+///
+/// Reflected table is generated with the reflected polynome by the right-shifting algorithm.
+template <usize BitsCount, value_t<BitsCount> Polynome, usize Size, bool Reflected = false>
 constexpr inline crc_table_t<BitsCount, Size> generate_table() noexcept
 {
-    return generate_table_impl<BitsCount, Polynome, Size>(std::make_index_sequence<Size>());
+    return generate_table_impl<BitsCount, Polynome, Reflected, Size>(std::make_index_sequence<Size>());
 }
 
-/// @brief Reflects bits in value.
+/// @brief Slicing tables type.
+///
+/// Table `k` holds crc values of every byte followed by `k` zero bytes.
+template <usize BitsCount, usize Slices>
+using slicing_table_t = std::array<crc_table_t<BitsCount, 256>, Slices>;
+
+/// @brief Geneates slicing tables at compile time.
+template <usize BitsCount, value_t<BitsCount> Polynome, usize Slices, bool Reflected>
+constexpr inline slicing_table_t<BitsCount, Slices> generate_slicing_table() noexcept
+{
+    slicing_table_t<BitsCount, Slices> tables{};
+    tables[0] = generate_table<BitsCount, Polynome, 256, Reflected>();
+
+    for (usize slice = 1; slice < Slices; ++slice) {
+        for (usize i = 0; i < 256; ++i) {
+            tables[slice][i] = update_register<BitsCount, Reflected>(tables[0], tables[slice - 1][i], 0);
+        }
+    }
+
+    return tables;
+}
+
+/// @brief Checks if iterator points to contiguous sequence of bytes.
+template <typename Iterator>
+struct is_contiguous_bytes_iterator
+{
+private:
+    using value_type = std::remove_cv_t<typename std::iterator_traits<Iterator>::value_type>;
+
+    static constexpr bool is_byte = sizeof(value_type) == 1 && std::is_integral_v<value_type> &&
+                                    !std::is_same_v<value_type, bool>;
+
+    template <typename Container>
+    static constexpr bool is_container_iterator = std::is_same_v<Iterator, typename Container::iterator> ||
+                                                  std::is_same_v<Iterator, typename Container::const_iterator>;
+
+    static constexpr bool is_contiguous = std::is_pointer_v<Iterator> ||
+                                          is_container_iterator<std::vector<value_type>> ||
+                                          is_container_iterator<std::string>;
+
+public:
+    static constexpr bool value = is_byte && is_contiguous;
+};
+
+/// @brief Linear operator over GF(2) on crc values, stored by columns.
+template <usize BitsCount>
+using gf2_matrix_t = std::array<value_t<BitsCount>, BitsCount>;
+
+/// @brief Multiplies GF(2) matrix by vector.
+template <usize BitsCount>
+constexpr value_t<BitsCount> gf2_matrix_times(const gf2_matrix_t<BitsCount>& matrix, value_t<BitsCount> vector) noexcept
+{
+    value_t<BitsCount> result = 0;
+
+    for (usize i = 0; vector != 0; ++i, vector >>= 1) {
+        if (vector & 1) {
+            result ^= matrix[i];
+        }
+    }
+
+    return result;
+}
+
+/// @brief Squares GF(2) matrix.
 template <usize BitsCount>
-value_t<BitsCount> reflect(value_t<BitsCount> value)
+constexpr gf2_matrix_t<BitsCount> gf2_matrix_square(const gf2_matrix_t<BitsCount>& matrix) noexcept
 {
-    value_t<BitsCount> ref = 0;
+    gf2_matrix_t<BitsCount> square{};
+
+    for (usize i = 0; i < BitsCount; ++i) {
+        square[i] = gf2_matrix_times<BitsCount>(matrix, matrix[i]);
+    }
+
+    return square;
+}
+
+/// @brief Applies crc register update for @p count zero bytes.
+template <usize BitsCount, value_t<BitsCount> Polynome, bool Reflected>
+constexpr value_t<BitsCount> shift_zeros(value_t<BitsCount> value, usize count) noexcept
+{
+    // Operator for one zero bit.
+    gf2_matrix_t<BitsCount> matrix{};
+    if constexpr (Reflected) {
+        matrix[0] = reflect<BitsCount>(Polynome);
+        for (usize i = 1; i < BitsCount; ++i) {
+            matrix[i] = static_cast<value_t<BitsCount>>(value_t<BitsCount>{1} << (i - 1));
+        }
+    } else {
+        for (usize i = 0; i + 1 < BitsCount; ++i) {
+            matrix[i] = static_cast<value_t<BitsCount>>(value_t<BitsCount>{1} << (i + 1));
+        }
+        matrix[BitsCount - 1] = Polynome;
+    }
 
-    for (usize bit = 0; bit < BitsCount; ++bit) {
-        if (value & 1) {
-            ref |= 1 << (BitsCount - 1 - bit);
+    // Operator for one zero byte.
+    for (usize i = 0; i < 3; ++i) {
+        matrix = gf2_matrix_square<BitsCount>(matrix);
+    }
+
+    for (; count != 0; count >>= 1) {
+        if (count & 1) {
+            value = gf2_matrix_times<BitsCount>(matrix, value);
+        }
+
+        if (count > 1) {
+            matrix = gf2_matrix_square<BitsCount>(matrix);
         }
-        value >>= 1;
     }
 
-    return ref;
+    return value;
+}
+
+/// @brief Hardware accelerated algorithm for the specific crc parameters.
+enum class hardware_engine
+{
+    none,          ///< No hardware support.
+    crc32c,        ///< SSE4.2 crc32 instruction, reflected 0x1EDC6F41 polynome.
+    crc32_folding, ///< PCLMULQDQ folding, reflected 0x04C11DB7 polynome.
+    crc64_folding  ///< PCLMULQDQ folding, any reflected 64 bit polynome.
+};
+
+/// @brief Minimum data size processed by the folding algorithm.
+constexpr usize folding_min_size = 64;
+
+/// @brief Selects hardware accelerated algorithm for the crc parameters.
+template <usize BitsCount, value_t<BitsCount> Polynome, bool ReflectIn>
+constexpr hardware_engine get_hardware_engine() noexcept
+{
+    if (BitsCount == 64 && ReflectIn) {
+        return hardware_engine::crc64_folding;
+    }
+
+    if (BitsCount != 32 || !ReflectIn) {
+        return hardware_engine::none;
+    }
+
+    switch (static_cast<uint32>(Polynome)) {
+        case 0x1EDC6F41: return hardware_engine::crc32c;
+        case 0x04C11DB7: return hardware_engine::crc32_folding;
+        default: return hardware_engine::none;
+    }
+}
+
+/// @brief Constants for carry-less multiplication folding of reflected 64 bit crc.
+///
+/// All values are reflected, `x^n` means `x^n mod P`.
+struct folding_constants
+{
+    std::array<uint64, 2> fold_by_4; ///< x^(512 + 63) and x^(512 - 1).
+    std::array<uint64, 2> fold_by_1; ///< x^(128 + 63) and x^(128 - 1).
+    uint64 quotient;                 ///< floor(x^128 / P) / x, for the Barrett reduction.
+    uint64 polynome;                 ///< P / x, for the Barrett reduction.
+    bool odd_polynome;               ///< Polynome has the x^0 term.
+};
+
+/// @brief Calculates `x^exponent mod P` for 64 bit polynome.
+template <uint64 Polynome>
+constexpr uint64 power_mod(usize exponent) noexcept
+{
+    constexpr uint64 topbit = uint64{1} << 63;
+
+    uint64 value = 1;
+    for (usize i = 0; i < exponent; ++i) {
+        value = (value & topbit) ? (value << 1) ^ Polynome : value << 1;
+    }
+
+    return value;
+}
+
+/// @brief Calculates `floor(x^128 / P) / x` for 64 bit polynome.
+template <uint64 Polynome>
+constexpr uint64 barrett_quotient() noexcept
+{
+    constexpr uint64 topbit = uint64{1} << 63;
+
+    // Long division of x^128, quotient bits are collected from the x^64 term down to the x^1 term.
+    uint64 remainder = 1;
+    uint64 quotient  = 0;
+    for (usize i = 0; i < 127; ++i) {
+        const bool carry = (remainder & topbit) != 0;
+
+        remainder = carry ? (remainder << 1) ^ Polynome : remainder << 1;
+        quotient  = (quotient << 1) | (carry ? 1 : 0);
+    }
+
+    return quotient;
 }
 
+/// @brief Generates folding constants at compile time.
+template <uint64 Polynome>
+constexpr folding_constants generate_folding_constants() noexcept
+{
+    folding_constants constants{};
+
+    constants.fold_by_4    = {reflect<64>(power_mod<Polynome>(512 + 63)), reflect<64>(power_mod<Polynome>(512 - 1))};
+    constants.fold_by_1    = {reflect<64>(power_mod<Polynome>(128 + 63)), reflect<64>(power_mod<Polynome>(128 - 1))};
+    constants.quotient     = reflect<64>(barrett_quotient<Polynome>());
+    constants.polynome     = reflect<64>((uint64{1} << 63) | (Polynome >> 1));
+    constants.odd_polynome = (Polynome & 1) != 0;
+
+    return constants;
+}
+
+/// @brief Checks if CPU supports SSE4.2 crc32 instruction.
+bool has_crc32c_instruction() noexcept;
+
+/// @brief Checks if CPU supports PCLMULQDQ and SSE4.1 instructions.
+bool has_carryless_multiplication() noexcept;
+
+/// @brief Processes data with SSE4.2 crc32 instruction.
+///
+/// @param data Pointer to the data.
+/// @param size Size of the data.
+/// @param value Reflected crc register value.
+///
+/// @return New reflected crc register value.
+uint32 crc32c_hardware(const uint8* data, usize size, uint32 value) noexcept;
+
+/// @brief Folds data with carry-less multiplication.
+///
+/// @param data Pointer to the data.
+/// @param size Size of the data, should be a multiple of 16 and not less than @ref folding_min_size.
+/// @param value Reflected crc register value.
+///
+/// @return New reflected crc register value.
+uint32 crc32_hardware(const uint8* data, usize size, uint32 value) noexcept;
+
+/// @brief Folds data with carry-less multiplication.
+///
+/// @param data Pointer to the data.
+/// @param size Size of the data, should be a multiple of 16 and not less than @ref folding_min_size.
+/// @param value Reflected crc register value.
+/// @param constants Folding constants for the polynome.
+///
+/// @return New reflected crc register value.
+uint64 crc64_hardware(const uint8* data, usize size, uint64 value, const folding_constants& constants) noexcept;
+
 } // namespace framework::utils::crc_details
 
 #endif
@@ -0,0 +1,112 @@
+/// @file
+/// @brief Splitting of the range between threads.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_COMMON_PARALLEL_DETAILS_HPP
+#define FRAMEWORK_COMMON_PARALLEL_DETAILS_HPP
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <common/types.hpp>
+
+namespace framework::utils::parallel_details
+{
+/// @brief Returns count of the blocks the range is split into.
+///
+/// @param count Size of the range.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+/// @param block_min Minimal size of the block processed by one thread.
+///
+/// @return Count of the blocks, `1` or less means the range is not split.
+inline usize count_blocks(usize count, usize thread_count, usize block_min)
+{
+    if (thread_count == 0) {
+        thread_count = std::max<usize>(std::thread::hardware_concurrency(), 1);
+    }
+
+    return std::min(thread_count, count / block_min);
+}
+
+/// @brief Returns size of the block, the last block takes the remainder of the range.
+///
+/// @param count Size of the range.
+/// @param blocks_count Count of the blocks.
+/// @param index Index of the block.
+///
+/// @return Size of the block.
+constexpr usize block_size(usize count, usize blocks_count, usize index) noexcept
+{
+    const usize size = count / blocks_count;
+    return index + 1 == blocks_count ? count - index * size : size;
+}
+
+/// @brief Splits the range into equal blocks and calls `function(index, begin, size)` for each block.
+///
+/// The first block is processed on the calling thread, others on separate threads.
+///
+/// @param count Size of the range.
+/// @param blocks_count Count of the blocks, see @ref count_blocks.
+/// @param function Function to call.
+template <typename Function>
+inline void parallel_for(usize count, usize blocks_count, const Function& function)
+{
+    if (blocks_count <= 1) {
+        function(usize{0}, usize{0}, count);
+        return;
+    }
+
+    const usize size = count / blocks_count;
+
+    std::vector<std::thread> threads;
+    threads.reserve(blocks_count - 1);
+
+    try {
+        for (usize i = 1; i < blocks_count; ++i) {
+            threads.emplace_back([&function, count, blocks_count, size, i]() {
+                function(i, i * size, block_size(count, blocks_count, i));
+            });
+        }
+    } catch (...) {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+
+    function(usize{0}, usize{0}, block_size(count, blocks_count, 0));
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace framework::utils::parallel_details
+
+#endif
@@ -31,6 +31,8 @@
 #define FRAMEWORK_COMMON_UTILS_HPP
 
 #include <random>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <common/utils_details.hpp>
@@ -113,16 +115,65 @@ constexpr inline std::size_t size(const T (&)[N]) noexcept
     return N;
 }
 
-/*
+/// @brief Formats arguments according to the format string.
+///
+/// Format string contains text and replacement fields `{[index][:spec]}`, braces are escaped@n
+/// as `{{` and `}}`. Specification is `[[fill]align][sign][#][0][width][.precision][type]`:
+/// - align: `<` left, `>` right, `^` center;
+/// - sign: `+`, `-` or space;
+/// - `#` adds `0b`, `0` or `0x` prefix to integers;
+/// - `0` pads numbers with zeros after the sign;
+/// - type: `d`, `b`, `o`, `x`, `X`, `c` for integers, `e`, `E`, `f`, `F`, `g`, `G`, `a`, `A` for@n
+///   floating-point numbers, `s` for strings and `p` for pointers.
+///
+/// Numbers are formatted with `std::to_chars`, floating-point numbers without type and precision@n
+/// use the shortest round trip representation. Other types are printed with `operator<<`.
+///
+/// @code{.cpp}
+/// utils::format("{}: {:.3f}", "value", 1.23456);                          // "value: 1.235"
+/// utils::format(FRAMEWORK_FORMAT_STRING("{:>8}|{:#06x}"), "right", 255); // "   right|0x00ff"
+/// @endcode
+///
+/// @param format_string Format string.
+/// @param args Arguments.
+///
+/// @return Formatted string.
+///
+/// @throw format_error if format string is invalid or does not match the arguments.
 template <typename... Args>
-std::string format(const std::string& str, Args&&... args)
+std::string format(std::string_view format_string, const Args&... args)
 {
-    std::unique_ptr<format_details::value_base> values[sizeof...(args)] = {
-    (format_details::make_value_holder_ptr(args))...,
-    };
-    return format_details::make_string_impl(str, values, sizeof...(args));
+    const format_details::format_arg values[] = {format_details::make_arg(args)..., {}};
+
+    std::string result;
+    format_details::vformat_to(format_details::make_sink(result), format_string, values, sizeof...(Args));
+
+    return result;
+}
+
+/// @brief Formats arguments according to the format string checked at compile time.
+///
+/// The format string is created by @ref FRAMEWORK_FORMAT_STRING, it is parsed and validated@n
+/// against the argument types during compilation, so formatting does not parse it at all.
+///
+/// @param format_string Format string.
+/// @param args Arguments.
+///
+/// @return Formatted string.
+template <typename S, typename... Args, std::enable_if_t<format_details::is_compile_string_v<S>, int> = 0>
+std::string format(S /*format_string*/, const Args&... args)
+{
+    static_assert(format_details::check_format<Args...>(S::value()), "Invalid format string.");
+
+    using compiled = format_details::compiled_format<S>;
+
+    const format_details::format_arg values[] = {format_details::make_arg(args)..., {}};
+
+    std::string result;
+    format_details::vformat_to(format_details::make_sink(result), compiled::segments.data(), compiled::size, values);
+
+    return result;
 }
-*/
 
 /// @}
 
@@ -132,4 +183,17 @@ std::string format(const std::string& str, Args&&... args)
 
 } // namespace framework
 
+/// @brief Creates format string that is parsed and validated at compile time, see @ref framework::utils::format.
+#define FRAMEWORK_FORMAT_STRING(str)                                                    \
+    [] {                                                                                \
+        struct format_string_type : ::framework::utils::format_details::compile_string \
+        {                                                                               \
+            static constexpr std::string_view value()                                   \
+            {                                                                           \
+                return str;                                                             \
+            }                                                                           \
+        };                                                                              \
+        return format_string_type();                                                    \
+    }()
+
 #endif
@@ -27,256 +27,408 @@
 // SOFTWARE.
 // =============================================================================
 
-#include <exception>
-#include <iomanip>
-#include <sstream>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <streambuf>
 
 #include <common/utils_details.hpp>
 
-namespace framework
-{
-namespace utils
-{
-namespace format_details
+namespace
 {
-/*
-struct value_format
+using framework::float32;
+using framework::float64;
+using framework::int64;
+using framework::uint64;
+using framework::usize;
+using framework::utils::format_error;
+using framework::utils::format_details::arg_type;
+using framework::utils::format_details::format_arg;
+using framework::utils::format_details::format_sink;
+using framework::utils::format_details::format_spec;
+
+/// @brief Stream buffer over the sink, used for types printed by `operator<<`.
+class sink_buffer : public std::streambuf
 {
-    size_t width;     // number
-    size_t precision; // .number
-    char specifier;   // doxXeEfF
-    char fill;        // any char
-    char align;       // <>=
-    char flag;        // +-#0
-
-    value_format() : width(0), precision(6), specifier('\0'), fill('\0'), align('\0'), flag('\0')
+public:
+    explicit sink_buffer(const format_sink& out) : m_out(out)
     {}
 
-    void parse(std::istream& in);
-    void set_to(std::ostream& os) const;
+protected:
+    int overflow(int character) override
+    {
+        if (character != traits_type::eof()) {
+            const char c = static_cast<char>(character);
+            m_out.append(&c, 1);
+        }
+        return character;
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize size) override
+    {
+        m_out.append(data, static_cast<usize>(size));
+        return size;
+    }
+
+private:
+    const format_sink& m_out;
 };
 
-// format helper functions
-char read_last_char(const std::string& chars, std::string& format_str)
+void fill(const format_sink& out, char c, usize count)
 {
-    char out = '\0';
-    if (chars.find(format_str.back()) != std::string::npos) {
-        out = format_str.back();
-        format_str.pop_back();
+    std::array<char, 32> chars;
+    chars.fill(c);
+
+    while (count > 0) {
+        const usize size = std::min(count, chars.size());
+        out.append(chars.data(), size);
+        count -= size;
     }
-    return out;
 }
 
-size_t string_to_int(const std::string& str, size_t default_value = 0)
+void write_aligned(const format_sink& out,
+                   const format_spec& spec,
+                   std::string_view prefix,
+                   std::string_view text,
+                   char default_align)
 {
-    std::istringstream ist(str);
-    size_t value = default_value;
-    ist >> value;
-    return value;
+    const usize size    = prefix.size() + text.size();
+    const usize padding = spec.width > size ? spec.width - size : 0;
+
+    if (spec.zero && spec.align == '\0') {
+        out.append(prefix);
+        fill(out, '0', padding);
+        out.append(text);
+        return;
+    }
+
+    const char align = spec.align != '\0' ? spec.align : default_align;
+    const usize left = align == '>' ? padding : (align == '^' ? padding / 2 : 0);
+
+    fill(out, spec.fill, left);
+    out.append(prefix);
+    out.append(text);
+    fill(out, spec.fill, padding - left);
 }
 
-// implementation of value_format parser
-void value_format::parse(std::istream& in)
+void write_padded(const format_sink& out, const format_spec& spec, std::string_view text, char default_align)
 {
-    if (in.peek() != ':')
-        return;
-    in.ignore(1);
-    std::string format_str;
+    write_aligned(out, spec, std::string_view(), text, default_align);
+}
 
-    // read all foramt string
-    while (in.peek() != '}') {
-        format_str += static_cast<char>(in.peek());
-        in.ignore(1);
+usize sign_prefix(const format_spec& spec, bool negative, char* prefix)
+{
+    if (negative) {
+        prefix[0] = '-';
+    } else if (spec.sign == '+' || spec.sign == ' ') {
+        prefix[0] = spec.sign;
+    } else {
+        return 0;
     }
+    return 1;
+}
 
-    if (format_str.empty()) {
-        throw std::logic_error("Empty format string after ':'");
+void write_integer(const format_sink& out, const format_spec& spec, uint64 magnitude, bool negative)
+{
+    if (spec.type == 'c') {
+        const char c = static_cast<char>(negative ? 0 - magnitude : magnitude);
+        write_padded(out, spec, std::string_view(&c, 1), '<');
+        return;
     }
-    // read specifier
-    specifier = read_last_char("doxXeEfF", format_str);
 
-    // read precision and width
-    if (format_str.back() == '.') {
-        throw std::logic_error("Precision value expected after '.'");
+    int base = 10;
+    std::string_view base_prefix;
+
+    switch (spec.type) {
+        case 'b':
+        case 'B':
+            base        = 2;
+            base_prefix = spec.type == 'b' ? "0b" : "0B";
+            break;
+        case 'o':
+            base        = 8;
+            base_prefix = magnitude != 0 ? "0" : "";
+            break;
+        case 'x':
+        case 'X':
+            base        = 16;
+            base_prefix = spec.type == 'x' ? "0x" : "0X";
+            break;
+        default: break;
     }
 
-    std::string width_str;
-    std::string precision_str;
-    std::string buf_str;
-    while (std::isdigit(format_str.back()) || format_str.back() == '.') {
-        buf_str = format_str.back() + buf_str;
-        format_str.pop_back();
+    std::array<char, 64> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), magnitude, base);
+
+    if (spec.type == 'X') {
+        std::transform(digits.data(), result.ptr, digits.data(), [](char c) { return c >= 'a' ? c - 'a' + 'A' : c; });
     }
 
-    std::string::size_type dot_pos = buf_str.find('.');
+    std::array<char, 3> prefix;
+    usize prefix_size = sign_prefix(spec, negative, prefix.data());
 
-    if (dot_pos != std::string::npos) {
-        width_str     = buf_str.substr(0, dot_pos);
-        precision_str = buf_str.substr(dot_pos + 1, buf_str.size() - dot_pos - 1);
-    } else {
-        width_str = buf_str;
+    if (spec.alternate) {
+        std::memcpy(prefix.data() + prefix_size, base_prefix.data(), base_prefix.size());
+        prefix_size += base_prefix.size();
     }
 
-    // set zeros as fill chars
-    if (width_str.front() == '0' && width_str.size() > 1) {
-        format_str += '0';
-        width_str.erase(0, 1);
-    }
+    write_aligned(out,
+                  spec,
+                  std::string_view(prefix.data(), prefix_size),
+                  std::string_view(digits.data(), static_cast<usize>(result.ptr - digits.data())),
+                  '>');
+}
 
-    width     = string_to_int(width_str, width);
-    precision = string_to_int(precision_str, precision);
+#if defined(__cpp_lib_to_chars)
+template <typename T>
+std::to_chars_result float_to_chars(char* first, char* last, T value, const format_spec& spec)
+{
+    std::chars_format format = std::chars_format::general;
+
+    switch (spec.type) {
+        case 'a':
+        case 'A': format = std::chars_format::hex; break;
+        case 'e':
+        case 'E': format = std::chars_format::scientific; break;
+        case 'f':
+        case 'F': format = std::chars_format::fixed; break;
+        case 'g':
+        case 'G': break;
+        default:
+            if (spec.precision < 0) {
+                return std::to_chars(first, last, value);
+            }
+            break;
+    }
 
-    // read sign
-    flag = read_last_char("+-#0", format_str);
+    if (spec.precision < 0) {
+        if (format == std::chars_format::hex) {
+            return std::to_chars(first, last, value, format);
+        }
+        return std::to_chars(first, last, value, format, 6);
+    }
 
-    // read align
-    align = read_last_char("<>=", format_str);
+    return std::to_chars(first, last, value, format, spec.precision);
+}
+#else
+/// @brief Prints the number with `snprintf`, `to_chars` doesn't support floating point in this standard library.
+std::to_chars_result print_float(char* first, char* last, const char* format, int precision, float64 value) noexcept
+{
+    const auto capacity = static_cast<usize>(last - first);
+    const int size      = std::snprintf(first, capacity, format, precision, value);
 
-    // get fill char
-    if (format_str.size() == 1) {
-        fill = format_str.back();
-        format_str.pop_back();
+    // Writing needs one more character for the terminating zero.
+    if (size < 0 || static_cast<usize>(size) >= capacity) {
+        return {last, std::errc::value_too_large};
     }
 
-    // fill require align
-    if (fill != '\0' && align == '\0') {
-        throw std::logic_error("Expected align specification");
-    }
+    char* end = first + size;
 
-    if (!format_str.empty()) {
-        throw std::logic_error("Wrong field format");
+    // `to_chars` doesn't write the hexadecimal prefix.
+    if (std::strncmp(first, "0x", 2) == 0) {
+        std::memmove(first, first + 2, static_cast<usize>(size - 2));
+        end -= 2;
     }
+
+    return {end, std::errc()};
 }
 
-void value_format::set_to(std::ostream& os) const
+template <typename T>
+std::to_chars_result float_to_chars(char* first, char* last, T value, const format_spec& spec)
 {
-    switch (specifier) {
-        case '\0':
-        case 'd': os << std::dec; break;
-        case 'o': os << std::oct; break;
-        case 'x': os << std::hex; break;
-        case 'X': os << std::hex << std::uppercase; break;
-        case 'e': os << std::scientific; break;
-        case 'E': os << std::scientific << std::uppercase; break;
-        case 'f': os << std::fixed; break;
-        case 'F': os << std::fixed << std::uppercase; break;
-        default: throw std::logic_error(std::string("Unknown specifier '") + specifier + "'");
+    const int precision = spec.precision < 0 ? 6 : spec.precision;
+
+    switch (spec.type) {
+        case 'a':
+        case 'A': return print_float(first, last, "%.*a", spec.precision, value); // Negative is the shortest.
+        case 'e':
+        case 'E': return print_float(first, last, "%.*e", precision, value);
+        case 'f':
+        case 'F': return print_float(first, last, "%.*f", precision, value);
+        case 'g':
+        case 'G': return print_float(first, last, "%.*g", precision, value);
+        default:
+            if (spec.precision >= 0) {
+                return print_float(first, last, "%.*g", precision, value);
+            }
+            break;
     }
 
-    os.precision(precision);
-    os.width(width);
+    // Shortest representation that reads back to the same value.
+    std::to_chars_result result{last, std::errc::value_too_large};
+    for (int digits = 1; digits <= std::numeric_limits<T>::max_digits10; ++digits) {
+        result = print_float(first, last, "%.*g", digits, value);
+        if (result.ec != std::errc() || !std::isfinite(value)) {
+            break;
+        }
 
-    switch (flag) {
-        case '\0':
-        case '-': os << std::noshowpos; break;
-        case '+': os << std::showpos; break;
-        case '#': os << std::showbase << std::showpoint; break;
-        case '0': os << std::setfill('0'); break;
-        default: throw std::logic_error(std::string("Unknown flag '") + flag + "'");
+        const std::string text(first, result.ptr);
+        if (static_cast<T>(std::strtod(text.c_str(), nullptr)) == value) {
+            break;
+        }
     }
 
-    switch (align) {
-        case '\0':
-            if (flag == '0') {
-                os << std::internal;
-                break;
-            } else {
-                [[fallthrough]];
-            }
+    return result;
+}
+#endif
+
+template <typename T>
+void write_float(const format_sink& out, format_spec spec, T value)
+{
+    const bool negative = std::signbit(value);
+    const T magnitude   = std::abs(value);
+
+    std::array<char, 128> buffer;
+    std::string large;
 
-        case '<': os << std::left; break;
-        case '>': os << std::right; break;
-        case '=': os << std::internal; break;
-        default: throw std::logic_error(std::string("Unknown align flag '") + align + "'");
+    char* first = buffer.data();
+    auto result = float_to_chars(first, first + buffer.size(), magnitude, spec);
+
+    for (usize size = buffer.size() * 4; result.ec != std::errc(); size *= 2) {
+        large.resize(size);
+        first  = large.data();
+        result = float_to_chars(first, first + large.size(), magnitude, spec);
     }
 
-    if (flag != '0') {
-        os << std::setfill(fill == '\0' ? ' ' : fill);
+    if (spec.type == 'A' || spec.type == 'E' || spec.type == 'F' || spec.type == 'G') {
+        std::transform(first, result.ptr, first, [](char c) { return c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c; });
     }
-}
 
-// value wrapper
+    if (!std::isfinite(value)) {
+        spec.zero = false;
+    }
 
-enum class indexing_mode
-{
-    none,
-    automatic,
-    manual
-};
+    std::array<char, 1> prefix;
+    const usize prefix_size = sign_prefix(spec, negative, prefix.data());
 
-std::string make_string_impl(const std::string& str,
-                             const std::unique_ptr<value_base>* const values,
-                             const size_t values_count)
+    write_aligned(out,
+                  spec,
+                  std::string_view(prefix.data(), prefix_size),
+                  std::string_view(first, static_cast<usize>(result.ptr - first)),
+                  '>');
+}
+
+void write_custom(const format_sink& out, const format_spec& spec, const format_arg::custom_value& custom)
 {
-    indexing_mode mode = indexing_mode::none;
-    size_t next_index  = 0;
-
-    std::istringstream in(str);
-    std::ostringstream out;
-    char c;
-    while (in.get(c)) {
-        if (c == '{') {
-            if (in.peek() == '{') {
-                out << '{';
-                in.ignore(1);
-                continue;
-            }
+    if (spec.width == 0) {
+        sink_buffer buffer(out);
+        std::ostream stream(&buffer);
+        custom.print(stream, custom.value);
+        return;
+    }
+
+    std::string text;
+    const auto text_sink = framework::utils::format_details::make_sink(text);
 
-            size_t index;
-            char next_char = static_cast<char>(in.peek());
-            if (next_char == '}' || next_char == ':') {
-                if (mode == indexing_mode::manual) {
-                    throw std::logic_error(
-                    "Cannot switch from manual field specification mode to automatic field numbering");
-                }
-                mode  = indexing_mode::automatic;
-                index = next_index++;
-            } else if (std::isdigit(in.peek())) {
-                if (mode == indexing_mode::automatic) {
-                    throw std::logic_error(
-                    "Cannot switch from automatic field numbering to manual field specification");
-                }
-                mode = indexing_mode::manual;
-                in >> index;
+    write_custom(text_sink, format_spec(), custom);
+    write_padded(out, spec, text, '<');
+}
+
+void write_arg(const format_sink& out, const format_spec& spec, const format_arg& arg)
+{
+    switch (arg.type) {
+        case arg_type::boolean:
+            if (spec.type == '\0' || spec.type == 's') {
+                write_padded(out, spec, arg.boolean ? "true" : "false", '<');
             } else {
-                throw std::logic_error("Field number expected");
+                write_integer(out, spec, arg.boolean ? 1 : 0, false);
             }
-
-            value_format format;
-            if (in.peek() == ':') {
-                format.parse(in);
+            break;
+        case arg_type::character:
+            if (spec.type == '\0' || spec.type == 'c' || spec.type == 's') {
+                write_padded(out, spec, std::string_view(&arg.character, 1), '<');
+            } else {
+                write_integer(out, spec, static_cast<unsigned char>(arg.character), false);
             }
-
-            if (index >= values_count) {
-                std::ostringstream buf;
-                buf << index;
-                throw std::logic_error(std::string("Index ") + buf.str() + " out of range");
+            break;
+        case arg_type::signed_integer: {
+            const bool negative  = arg.signed_value < 0;
+            const auto magnitude = static_cast<uint64>(arg.signed_value);
+            write_integer(out, spec, negative ? 0 - magnitude : magnitude, negative);
+            break;
+        }
+        case arg_type::unsigned_integer: write_integer(out, spec, arg.unsigned_value, false); break;
+        case arg_type::float32: write_float(out, spec, arg.float32_value); break;
+        case arg_type::float64: write_float(out, spec, arg.float64_value); break;
+        case arg_type::string: {
+            std::string_view text(arg.string.data, arg.string.size);
+            if (spec.precision >= 0) {
+                text = text.substr(0, static_cast<usize>(spec.precision));
             }
+            write_padded(out, spec, text, '<');
+            break;
+        }
+        case arg_type::pointer: {
+            format_spec pointer_spec = spec;
+            pointer_spec.type        = 'x';
+            pointer_spec.alternate   = true;
+            write_integer(out, pointer_spec, reinterpret_cast<uintptr_t>(arg.pointer), false);
+            break;
+        }
+        case arg_type::custom: write_custom(out, spec, arg.custom); break;
+        case arg_type::none: break;
+    }
+}
 
-            format.set_to(out);
-            values[index]->print_to(out);
+struct format_writer
+{
+    const format_sink& out;
+    const format_arg* args;
+    usize count;
+
+    void on_text(std::string_view text) const
+    {
+        if (!text.empty()) {
+            out.append(text);
+        }
+    }
 
-            in.get(c);
-            if (c != '}') {
-                throw std::logic_error("'}' expected");
-            }
-        } else if (c == '}') {
-            if (in.peek() == '}') {
-                out << '}';
-                in.ignore(1);
-                continue;
-            }
-            throw std::logic_error("Single '}' in format string");
-        } else {
-            out << c;
+    void on_field(const framework::utils::format_details::format_field& field) const
+    {
+        if (field.index >= count) {
+            throw format_error("Argument index out of range");
         }
+
+        const format_arg& arg = args[field.index];
+
+        check_spec(field.spec, arg.type);
+        write_arg(out, field.spec, arg);
     }
-    return out.str();
+};
+
+} // namespace
+
+namespace framework::utils::format_details
+{
+format_sink make_sink(std::string& out) noexcept
+{
+    return {&out, [](void* context, const char* data, usize size) { static_cast<std::string*>(context)->append(data, size); }};
+}
+
+void vformat_to(const format_sink& out, std::string_view str, const format_arg* args, usize count)
+{
+    format_writer writer{out, args, count};
+    parse_format(str, writer);
 }
-*/
 
-} // namespace format_details
+void vformat_to(const format_sink& out, const format_segment* segments, usize count, const format_arg* args)
+{
+    for (usize i = 0; i < count; ++i) {
+        const format_segment& segment = segments[i];
 
-} // namespace utils
+        if (segment.is_field) {
+            write_arg(out, segment.field.spec, args[segment.field.index]);
+        } else {
+            out.append(segment.text);
+        }
+    }
+}
 
-} // namespace framework
+} // namespace framework::utils::format_details
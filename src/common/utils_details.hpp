@@ -27,12 +27,20 @@
 // SOFTWARE.
 // =============================================================================
 
+
 #ifndef FRAMEWORK_COMMON_UTILS_DETAILS_HPP
 #define FRAMEWORK_COMMON_UTILS_DETAILS_HPP
 
-#include <iostream>
+#include <array>
 #include <memory>
+#include <ostream>
 #include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <common/types.hpp>
 
 namespace framework::utils::details
 {
@@ -46,40 +54,529 @@ auto get_distribution(T min_value, T max_value)
     }
 }
 
-/*
-namespace format_details
+} // namespace framework::utils::details
+
+namespace framework::utils
 {
-struct value_base
+/// @brief Error in the format string or in the argument specification.
+class format_error : public std::logic_error
 {
-    virtual ~value_base()                         = default;
-    virtual void print_to(std::ostream& os) const = 0;
+public:
+    using std::logic_error::logic_error;
 };
 
-template <typename T>
-struct value_holder : public value_base
+} // namespace framework::utils
+
+namespace framework::utils::format_details
+{
+/// @brief Maximum value of the field width and precision.
+inline constexpr uint32 max_number = 4096;
+
+/// @brief Kind of the formatted argument.
+enum class arg_type : uint8
+{
+    none,
+    boolean,
+    character,
+    signed_integer,
+    unsigned_integer,
+    float32,
+    float64,
+    string,
+    pointer,
+    custom
+};
+
+/// @brief Parsed `[[fill]align][sign][#][0][width][.precision][type]` specification.
+struct format_spec
 {
-    value_holder(const T& v) : value(v)
+    char fill         = ' ';
+    char align        = '\0';
+    char sign         = '\0';
+    bool alternate    = false;
+    bool zero         = false;
+    uint32 width      = 0;
+    int32 precision   = -1;
+    char type         = '\0';
+};
+
+/// @brief Parsed replacement field.
+struct format_field
+{
+    usize index = 0;
+    format_spec spec;
+};
+
+/// @brief Piece of the format string parsed at compile time, either text or field.
+struct format_segment
+{
+    std::string_view text;
+    format_field field;
+    bool is_field = false;
+};
+
+enum class indexing_mode : uint8
+{
+    none,
+    automatic,
+    manual
+};
+
+#pragma region parser
+
+constexpr bool is_digit(char c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool is_align(char c) noexcept
+{
+    return c == '<' || c == '>' || c == '^';
+}
+
+constexpr bool is_type(char c) noexcept
+{
+    return std::string_view("bBcdoxXaAeEfFgGsp").find(c) != std::string_view::npos;
+}
+
+constexpr uint32 parse_number(std::string_view str, usize& pos)
+{
+    uint32 value = 0;
+    while (pos < str.size() && is_digit(str[pos])) {
+        value = value * 10 + static_cast<uint32>(str[pos] - '0');
+        if (value > max_number) {
+            throw format_error("Width or precision is too big");
+        }
+        ++pos;
+    }
+    return value;
+}
+
+constexpr void parse_spec(std::string_view str, usize& pos, format_spec& spec)
+{
+    auto at = [str](usize i) { return i < str.size() ? str[i] : '\0'; };
+
+    if (is_align(at(pos + 1))) {
+        if (at(pos) == '{' || at(pos) == '}') {
+            throw format_error("Invalid fill character");
+        }
+        spec.fill  = at(pos);
+        spec.align = at(pos + 1);
+        pos += 2;
+    } else if (is_align(at(pos))) {
+        spec.align = at(pos++);
+    }
+
+    if (at(pos) == '+' || at(pos) == '-' || at(pos) == ' ') {
+        spec.sign = at(pos++);
+    }
+
+    if (at(pos) == '#') {
+        spec.alternate = true;
+        ++pos;
+    }
+
+    if (at(pos) == '0') {
+        spec.zero = true;
+        ++pos;
+    }
+
+    spec.width = parse_number(str, pos);
+
+    if (at(pos) == '.') {
+        ++pos;
+        if (!is_digit(at(pos))) {
+            throw format_error("Precision value expected after '.'");
+        }
+        spec.precision = static_cast<int32>(parse_number(str, pos));
+    }
+
+    if (at(pos) != '}' && at(pos) != '\0') {
+        if (!is_type(at(pos))) {
+            throw format_error("Unknown format specifier");
+        }
+        spec.type = at(pos++);
+    }
+}
+
+/// @brief Parses replacement field, @p pos points after the opening brace.
+///
+/// @return Position after the closing brace.
+constexpr usize parse_field(std::string_view str, usize pos, indexing_mode& mode, usize& next_index, format_field& field)
+{
+    if (pos < str.size() && is_digit(str[pos])) {
+        if (mode == indexing_mode::automatic) {
+            throw format_error("Cannot switch from automatic field numbering to manual field specification");
+        }
+        mode        = indexing_mode::manual;
+        field.index = parse_number(str, pos);
+    } else if (pos < str.size() && (str[pos] == '}' || str[pos] == ':')) {
+        if (mode == indexing_mode::manual) {
+            throw format_error("Cannot switch from manual field specification mode to automatic field numbering");
+        }
+        mode        = indexing_mode::automatic;
+        field.index = next_index++;
+    } else if (pos < str.size()) {
+        throw format_error("Field number expected");
+    }
+
+    if (pos < str.size() && str[pos] == ':') {
+        parse_spec(str, ++pos, field.spec);
+    }
+
+    if (pos >= str.size() || str[pos] != '}') {
+        throw format_error("'}' expected");
+    }
+
+    return pos + 1;
+}
+
+/// @brief Splits format string into text and fields.
+///
+/// Calls `handler.on_text(std::string_view)` for the text and `handler.on_field(const format_field&)`@n
+/// for the replacement fields.
+template <typename Handler>
+constexpr void parse_format(std::string_view str, Handler& handler)
+{
+    auto mode        = indexing_mode::none;
+    usize next_index = 0;
+    usize begin      = 0;
+    usize pos        = 0;
+
+    while (pos < str.size()) {
+        const char c = str[pos];
+
+        if (c != '{' && c != '}') {
+            ++pos;
+            continue;
+        }
+
+        if (pos + 1 < str.size() && str[pos + 1] == c) {
+            handler.on_text(str.substr(begin, pos + 1 - begin));
+            pos += 2;
+            begin = pos;
+            continue;
+        }
+
+        if (c == '}') {
+            throw format_error("Single '}' in format string");
+        }
+
+        handler.on_text(str.substr(begin, pos - begin));
+
+        format_field field;
+        pos = parse_field(str, pos + 1, mode, next_index, field);
+        handler.on_field(field);
+
+        begin = pos;
+    }
+
+    handler.on_text(str.substr(begin));
+}
+
+/// @brief Checks that the specification can be applied to the argument.
+constexpr void check_spec(const format_spec& spec, arg_type type)
+{
+    const auto allowed = [&spec](std::string_view types) {
+        return spec.type == '\0' || types.find(spec.type) != std::string_view::npos;
+    };
+
+    constexpr std::string_view integer_types = "bBcdoxX";
+    constexpr std::string_view float_types   = "aAeEfFgG";
+
+    bool valid   = false;
+    bool numeric = false;
+
+    switch (type) {
+        case arg_type::boolean:
+        case arg_type::character:
+            valid   = allowed(integer_types) || spec.type == 's';
+            numeric = spec.type != '\0' && spec.type != 's' && spec.type != 'c';
+            break;
+        case arg_type::signed_integer:
+        case arg_type::unsigned_integer:
+            valid   = allowed(integer_types);
+            numeric = spec.type != 'c';
+            break;
+        case arg_type::float32:
+        case arg_type::float64:
+            valid   = allowed(float_types);
+            numeric = true;
+            break;
+        case arg_type::string:
+        case arg_type::custom: valid = allowed("s"); break;
+        case arg_type::pointer: valid = allowed("p"); break;
+        case arg_type::none: break;
+    }
+
+    if (!valid) {
+        throw format_error("Format specifier does not match the argument type");
+    }
+
+    if ((spec.sign != '\0' || spec.zero) && !numeric) {
+        throw format_error("Sign and zero padding require numeric argument");
+    }
+
+    if (spec.alternate && (!numeric || type == arg_type::float32 || type == arg_type::float64)) {
+        throw format_error("Alternate form requires integer argument");
+    }
+
+    if (spec.precision >= 0 && type != arg_type::float32 && type != arg_type::float64 && type != arg_type::string) {
+        throw format_error("Precision requires floating-point or string argument");
+    }
+}
+
+struct format_checker
+{
+    const arg_type* types;
+    usize count;
+
+    constexpr void on_text(std::string_view /*unused*/) const noexcept
     {}
-    void print_to(std::ostream& os) const override
+
+    constexpr void on_field(const format_field& field) const
+    {
+        if (field.index >= count) {
+            throw format_error("Argument index out of range");
+        }
+        check_spec(field.spec, types[field.index]);
+    }
+};
+
+struct segment_counter
+{
+    usize count = 0;
+
+    constexpr void on_text(std::string_view text) noexcept
+    {
+        count += text.empty() ? 0 : 1;
+    }
+
+    constexpr void on_field(const format_field& /*unused*/) noexcept
+    {
+        ++count;
+    }
+};
+
+template <usize N>
+struct segment_builder
+{
+    std::array<format_segment, N> segments{};
+    usize count = 0;
+
+    constexpr void on_text(std::string_view text) noexcept
     {
-        os << value;
+        if (!text.empty()) {
+            segments[count++].text = text;
+        }
+    }
+
+    constexpr void on_field(const format_field& field) noexcept
+    {
+        segments[count].field      = field;
+        segments[count++].is_field = true;
     }
-    const T& value;
 };
 
+constexpr usize count_segments(std::string_view str)
+{
+    segment_counter counter;
+    parse_format(str, counter);
+    return counter.count;
+}
+
+template <usize N>
+constexpr std::array<format_segment, N> parse_segments(std::string_view str)
+{
+    segment_builder<N> builder;
+    parse_format(str, builder);
+    return builder.segments;
+}
+
+#pragma endregion
+
+#pragma region arguments
+
+template <typename T, typename = void>
+struct is_streamable : std::false_type
+{};
+
+template <typename T>
+struct is_streamable<T, std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>>
+    : std::true_type
+{};
+
 template <typename T>
-inline std::unique_ptr<value_base> make_value_holder_ptr(const T& t)
+constexpr arg_type type_of() noexcept
 {
-    return std::unique_ptr<value_base>(new value_holder<T>(t));
+    using U = std::remove_cv_t<std::remove_reference_t<T>>;
+
+    if constexpr (std::is_same_v<U, bool>) {
+        return arg_type::boolean;
+    } else if constexpr (std::is_same_v<U, char>) {
+        return arg_type::character;
+    } else if constexpr (std::is_integral_v<U>) {
+        return std::is_signed_v<U> ? arg_type::signed_integer : arg_type::unsigned_integer;
+    } else if constexpr (std::is_same_v<U, float>) {
+        return arg_type::float32;
+    } else if constexpr (std::is_floating_point_v<U>) {
+        return arg_type::float64;
+    } else if constexpr (std::is_null_pointer_v<U>) {
+        return arg_type::pointer;
+    } else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+        return arg_type::string;
+    } else if constexpr (std::is_pointer_v<U>) {
+        return arg_type::pointer;
+    } else if constexpr (is_streamable<U>::value) {
+        return arg_type::custom;
+    } else if constexpr (std::is_enum_v<U>) {
+        return type_of<std::underlying_type_t<U>>();
+    } else {
+        return arg_type::none;
+    }
 }
 
-std::string make_string_impl(const std::string& str,
-                             const std::unique_ptr<value_base>* const values,
-                             const size_t values_count);
+/// @brief Prints custom argument to the stream.
+using print_function = void (*)(std::ostream&, const void*);
 
-} // namespace format_details
+template <typename T>
+void print_value(std::ostream& stream, const void* value)
+{
+    stream << *static_cast<const T*>(value);
+}
 
-*/
-} // namespace framework::utils::details
+/// @brief Type erased argument, refers to the original value.
+struct format_arg
+{
+    struct string_value
+    {
+        const char* data;
+        usize size;
+    };
+
+    struct custom_value
+    {
+        const void* value;
+        print_function print;
+    };
+
+    arg_type type = arg_type::none;
+
+    union
+    {
+        int64 signed_value = 0;
+        uint64 unsigned_value;
+        float32 float32_value;
+        float64 float64_value;
+        bool boolean;
+        char character;
+        string_value string;
+        const void* pointer;
+        custom_value custom;
+    };
+};
+
+template <typename T>
+format_arg make_arg(const T& value) noexcept
+{
+    constexpr arg_type type = type_of<T>();
+    static_assert(type != arg_type::none, "Type is not formattable, provide operator<< for it.");
+
+    format_arg arg;
+    arg.type = type;
+
+    if constexpr (type == arg_type::custom) {
+        arg.custom = {&value, &print_value<T>};
+    } else if constexpr (std::is_enum_v<T>) {
+        return make_arg(static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (type == arg_type::boolean) {
+        arg.boolean = value;
+    } else if constexpr (type == arg_type::character) {
+        arg.character = value;
+    } else if constexpr (type == arg_type::signed_integer) {
+        arg.signed_value = static_cast<int64>(value);
+    } else if constexpr (type == arg_type::unsigned_integer) {
+        arg.unsigned_value = static_cast<uint64>(value);
+    } else if constexpr (type == arg_type::float32) {
+        arg.float32_value = value;
+    } else if constexpr (type == arg_type::float64) {
+        arg.float64_value = static_cast<float64>(value);
+    } else if constexpr (type == arg_type::string) {
+        if constexpr (std::is_pointer_v<T>) {
+            if (value == nullptr) {
+                arg.string = {"(null)", 6};
+                return arg;
+            }
+        }
+        const std::string_view view(value);
+        arg.string = {view.data(), view.size()};
+    } else {
+        arg.pointer = static_cast<const void*>(value);
+    }
+
+    return arg;
+}
+
+/// @brief Checks format string against the argument types, throws @ref format_error if it is invalid.
+///
+/// @return `true` if the format string is valid.
+template <typename... Args>
+constexpr bool check_format(std::string_view str)
+{
+    constexpr arg_type types[] = {type_of<Args>()..., arg_type::none};
+
+    format_checker checker{types, sizeof...(Args)};
+    parse_format(str, checker);
+
+    return true;
+}
+
+/// @brief Base of the format strings created by @ref FRAMEWORK_FORMAT_STRING.
+struct compile_string
+{};
+
+template <typename S>
+inline constexpr bool is_compile_string_v = std::is_base_of_v<compile_string, S>;
+
+/// @brief Format string parsed at compile time.
+template <typename S>
+struct compiled_format
+{
+    static constexpr usize size = count_segments(S::value());
+
+    static constexpr std::array<format_segment, size> segments = parse_segments<size>(S::value());
+};
+
+#pragma endregion
+
+/// @brief Output of the formatter.
+struct format_sink
+{
+    void* context;
+    void (*write)(void* context, const char* data, usize size);
+
+    void append(const char* data, usize size) const
+    {
+        write(context, data, size);
+    }
+
+    void append(std::string_view text) const
+    {
+        write(context, text.data(), text.size());
+    }
+};
+
+/// @brief Creates sink that appends to the string.
+format_sink make_sink(std::string& out) noexcept;
+
+/// @brief Formats the arguments, parsing the format string at runtime.
+///
+/// @throw format_error if format string is invalid or does not match the arguments.
+void vformat_to(const format_sink& out, std::string_view str, const format_arg* args, usize count);
+
+/// @brief Formats the arguments using format string parsed at compile time.
+void vformat_to(const format_sink& out, const format_segment* segments, usize count, const format_arg* args);
+
+} // namespace framework::utils::format_details
 
 #endif
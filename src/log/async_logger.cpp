@@ -0,0 +1,314 @@
+/// @file
+/// @brief Async logger implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <chrono>
+#include <string>
+
+#include <log/async_logger.hpp>
+#include <log/log_details.hpp>
+
+namespace
+{
+constexpr std::chrono::milliseconds writer_timeout{10};
+
+std::size_t round_capacity(std::size_t capacity)
+{
+    std::size_t result = 2;
+    while (result < capacity) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+} // namespace
+
+namespace framework::log
+{
+/// @brief Queue cell, see Dmitry Vyukov's bounded MPMC queue.
+struct async_logger::slot
+{
+    std::atomic<std::size_t> sequence{0};
+    severity_level level{severity_level::debug};
+    std::string tag;
+    std::string message;
+    uint64 timestamp = 0;
+    uint32 thread    = 0;
+    const char* file = nullptr;
+    uint32 line      = 0;
+    bool valid       = false; ///< The message was not copied, the writer skips the slot.
+
+    log_details::call_site_state* site = nullptr;
+};
+
+async_logger::async_logger(std::unique_ptr<logger_base> sink, std::size_t capacity, overflow_policy policy)
+    : m_sink(std::move(sink)), m_mask(round_capacity(capacity) - 1), m_policy(policy)
+{
+    m_slots = std::make_unique<slot[]>(m_mask + 1);
+    for (std::size_t i = 0; i <= m_mask; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    m_writer = std::thread([this]() { writer_loop(); });
+}
+
+async_logger::~async_logger()
+{
+    m_stop.store(true, std::memory_order_release);
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_writer_condition.notify_one();
+    }
+
+    m_writer.join();
+    m_sink->flush();
+}
+
+void async_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void async_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    add_message(log_details::make_record(level, tag, message));
+}
+
+void async_logger::add_message(const record& item)
+{
+    while (!try_push(item)) {
+        switch (m_policy) {
+            case overflow_policy::block: wait_for_slot(); break;
+
+            case overflow_policy::drop_newest: m_dropped_count.fetch_add(1, std::memory_order_relaxed); return;
+
+            case overflow_policy::drop_oldest: try_pop(true); break;
+        }
+    }
+
+    wake_writer();
+}
+
+void async_logger::flush()
+{
+    const std::size_t target = m_enqueue_position.load(std::memory_order_acquire);
+
+    {
+        std::unique_lock lock(m_mutex);
+        m_writer_condition.notify_one();
+        // Messages discarded by producers are not signalled, so wake up periodically.
+        while (m_processed_count.load(std::memory_order_acquire) < target) {
+            m_written_condition.wait_for(lock, writer_timeout);
+        }
+    }
+
+    // The writer holds the sink mutex while a message is in flight.
+    std::lock_guard sink_lock(m_sink_mutex);
+    m_sink->flush();
+}
+
+std::size_t async_logger::dropped_count() const noexcept
+{
+    return m_dropped_count.load(std::memory_order_relaxed);
+}
+
+bool async_logger::try_push(const record& item)
+{
+    std::size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+
+    slot* cell = nullptr;
+    while (true) {
+        cell = &m_slots[position & m_mask];
+
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference      = static_cast<std::ptrdiff_t>(sequence - position);
+
+        if (difference == 0) {
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Assignment reuses the slot capacity, so the steady state does not allocate.
+    try {
+        cell->tag.assign(item.tag);
+        cell->message.assign(item.message);
+    } catch (...) {
+        // The claimed slot must be published anyway, otherwise the writer waits for it forever.
+        cell->valid = false;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        throw;
+    }
+
+    cell->valid     = true;
+    cell->level     = item.level;
+    cell->timestamp = item.timestamp;
+    cell->thread    = item.thread;
+    cell->file      = item.file;
+    cell->site      = item.site;
+    cell->line      = item.line;
+
+    cell->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool async_logger::try_pop(bool discard)
+{
+    std::size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+
+    slot* cell = nullptr;
+    while (true) {
+        cell = &m_slots[position & m_mask];
+
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference      = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+        if (difference == 0) {
+            if (m_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = m_dequeue_position.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Discarded messages and messages that failed to copy are counted as dropped.
+    if (discard || !cell->valid) {
+        m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+        cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+        m_processed_count.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    // Swap keeps both buffers allocated and frees the slot before the sink is called.
+    m_current_tag.swap(cell->tag);
+    m_current_message.swap(cell->message);
+
+    const record item{cell->level,
+                      m_current_tag,
+                      m_current_message,
+                      cell->timestamp,
+                      cell->thread,
+                      cell->file,
+                      cell->line,
+                      cell->site};
+
+    cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+
+    try {
+        m_sink->add_message(item);
+    } catch (...) {
+        // The writer thread must survive a failing sink.
+    }
+
+    m_processed_count.fetch_add(1, std::memory_order_release);
+
+    return true;
+}
+
+bool async_logger::full() const noexcept
+{
+    const std::size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    const std::size_t sequence = m_slots[position & m_mask].sequence.load(std::memory_order_acquire);
+
+    return static_cast<std::ptrdiff_t>(sequence - position) < 0;
+}
+
+bool async_logger::empty() const noexcept
+{
+    const std::size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    const std::size_t sequence = m_slots[position & m_mask].sequence.load(std::memory_order_acquire);
+
+    return sequence != position + 1;
+}
+
+void async_logger::wake_writer()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_writer_waiting.load(std::memory_order_relaxed)) {
+        std::lock_guard lock(m_mutex);
+        m_writer_condition.notify_one();
+    }
+}
+
+void async_logger::wait_for_slot()
+{
+    wake_writer();
+
+    // The writer notifies under the mutex after freeing the slots, so checking under it does not lose the wakeup.
+    // The timeout only guards against slots freed without notification.
+    std::unique_lock lock(m_mutex);
+    m_written_condition.wait_for(lock, writer_timeout, [this]() { return !full(); });
+}
+
+void async_logger::writer_loop()
+{
+    while (true) {
+        const bool stop = m_stop.load(std::memory_order_acquire);
+
+        bool written = false;
+        {
+            std::lock_guard sink_lock(m_sink_mutex);
+            while (try_pop(false)) {
+                written = true;
+            }
+        }
+
+        std::unique_lock lock(m_mutex);
+
+        if (written) {
+            m_written_condition.notify_all();
+        }
+
+        if (stop) {
+            break;
+        }
+
+        m_writer_waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (empty() && !m_stop.load(std::memory_order_acquire)) {
+            m_writer_condition.wait_for(lock, writer_timeout);
+        }
+
+        m_writer_waiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace framework::log
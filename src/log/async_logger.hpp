@@ -0,0 +1,152 @@
+/// @file
+/// @brief Implementation of logger that writes messages on a dedicated thread.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_ASYNC_LOGGER_HPP
+#define FRAMEWORK_LOG_ASYNC_LOGGER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Defines what to do with a message when the queue of @ref async_logger is full.
+enum class overflow_policy
+{
+    block,       ///< Wait until the writer thread frees a slot.
+    drop_newest, ///< Discard the new message.
+    drop_oldest  ///< Discard the oldest queued message.
+};
+
+/// @brief Passes messages to another logger on a dedicated writer thread.
+///
+/// Messages are pushed into a bounded lock-free queue, so producers never wait@n
+/// for the output unless the queue is full and @ref overflow_policy::block is used.
+/// @code
+/// std::stringstream log_stream;
+/// set_logger(std::make_unique<async_logger>(std::make_unique<stream_logger>(log_stream)));
+/// @endcode
+class async_logger : public logger_base
+{
+public:
+    /// @brief Creates async logger and starts the writer thread.
+    ///
+    /// @param sink Logger that receives messages on the writer thread.
+    /// @param capacity Queue capacity, rounded up to the power of two.
+    /// @param policy Behaviour when the queue is full.
+    explicit async_logger(std::unique_ptr<logger_base> sink,
+                          std::size_t capacity   = 1024,
+                          overflow_policy policy = overflow_policy::block);
+
+    /// @brief Writes all queued messages and stops the writer thread.
+    ~async_logger() override;
+
+    async_logger(const async_logger&) = delete;
+    async_logger& operator=(const async_logger&) = delete;
+
+    async_logger(async_logger&&) = delete;
+    async_logger& operator=(async_logger&&) = delete;
+
+    /// @brief Queues message to be written.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override;
+
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Queues message record to be written.
+    ///
+    /// If copying the message throws, the queued slot is skipped by the writer and the exception is rethrown.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Waits until all messages queued before the call are written and flushes the sink.
+    void flush() override;
+
+    /// @brief Returns count of messages discarded due to queue overflow or failed copy.
+    ///
+    /// @return Discarded messages count.
+    std::size_t dropped_count() const noexcept;
+
+private:
+    struct slot;
+
+    bool try_push(const record& item);
+    bool try_pop(bool discard);
+    bool full() const noexcept;
+    bool empty() const noexcept;
+
+    void wake_writer();
+    void wait_for_slot();
+    void writer_loop();
+
+    std::unique_ptr<logger_base> m_sink;
+    std::unique_ptr<slot[]> m_slots;
+    std::size_t m_mask;
+    overflow_policy m_policy;
+
+    alignas(64) std::atomic<std::size_t> m_enqueue_position{0};
+    alignas(64) std::atomic<std::size_t> m_dequeue_position{0};
+
+    alignas(64) std::atomic<std::size_t> m_processed_count{0};
+    std::atomic<std::size_t> m_dropped_count{0};
+
+    std::atomic<bool> m_writer_waiting{false};
+    std::atomic<bool> m_stop{false};
+
+    std::string m_current_tag;
+    std::string m_current_message;
+
+    std::mutex m_sink_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_writer_condition;
+    std::condition_variable m_written_condition;
+
+    std::thread m_writer;
+};
+
+/// @}
+
+} // namespace framework::log
+
+#endif
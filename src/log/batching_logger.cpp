@@ -0,0 +1,324 @@
+/// @file
+/// @brief Batching logger implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+
+#include <log/batching_logger.hpp>
+#include <log/log_details.hpp>
+
+namespace framework::log::log_details
+{
+struct thread_batch;
+
+/// @brief Batch written by the current thread, its sink may log again.
+thread_local const thread_batch* writing_batch = nullptr;
+
+/// @brief Messages of one thread waiting to be written.
+struct thread_batch
+{
+    struct entry
+    {
+        record item; ///< Tag and message are taken from the text buffer on write.
+        std::size_t tag_size;
+        std::size_t message_size;
+    };
+
+    explicit thread_batch(logger_base* batch_sink, uint64 batch_owner) : sink(batch_sink), owner(batch_owner)
+    {}
+
+    /// @brief Passes collected messages to the sink, the mutex should not be locked.
+    ///
+    /// The messages are taken out under the mutex and written after it is released,
+    /// so producers are not stalled by the sink and the sink may log.
+    ///
+    /// @param wait Wait for another thread writing this batch, otherwise leave the messages to it.
+    void write(bool wait)
+    {
+        if (writing_batch == this) {
+            // The sink logs, the messages are written after the current ones.
+            write_requested.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        std::unique_lock write_lock(write_mutex, std::defer_lock);
+        if (wait) {
+            write_lock.lock();
+        } else if (!write_lock.try_lock()) {
+            write_requested.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        struct writing_scope
+        {
+            explicit writing_scope(const thread_batch* batch)
+            {
+                writing_batch = batch;
+            }
+
+            ~writing_scope()
+            {
+                writing_batch = nullptr;
+            }
+
+            writing_scope(const writing_scope&) = delete;
+            writing_scope& operator=(const writing_scope&) = delete;
+        } scope(this);
+
+        do {
+            logger_base* target = nullptr;
+            {
+                std::lock_guard lock(mutex);
+                target = sink;
+                pending_entries.swap(entries);
+                pending_text.swap(text);
+            }
+
+            if (target != nullptr && !pending_entries.empty()) {
+                records.clear();
+
+                const char* text_data = pending_text.data();
+                for (const auto& value : pending_entries) {
+                    records.push_back(value.item);
+                    records.back().tag     = std::string_view(text_data, value.tag_size);
+                    records.back().message = std::string_view(text_data + value.tag_size, value.message_size);
+
+                    text_data += value.tag_size + value.message_size;
+                }
+
+                target->add_messages(records.data(), records.size());
+            }
+
+            pending_entries.clear();
+            pending_text.clear();
+        } while (write_requested.exchange(false, std::memory_order_relaxed));
+    }
+
+    /// @brief Checks that the first collected message is older than the interval.
+    bool expired(uint64 now, uint64 interval)
+    {
+        std::lock_guard lock(mutex);
+        return !entries.empty() && now - first_ticks >= interval;
+    }
+
+    /// @brief Writes the remaining messages and detaches the batch from the destroyed logger.
+    void detach()
+    {
+        write(true);
+
+        std::lock_guard write_lock(write_mutex);
+        std::lock_guard lock(mutex);
+        sink = nullptr;
+    }
+
+    std::mutex mutex;       ///< Guards the collected messages and the sink.
+    std::mutex write_mutex; ///< Keeps the messages of the thread in order, guards the pending buffers.
+    std::atomic<bool> write_requested{false};
+
+    logger_base* sink; ///< Null after the owner is destroyed, changed with both mutexes locked.
+    const uint64 owner;
+    uint64 first_ticks = 0;
+    std::vector<entry> entries;
+    std::vector<char> text;
+
+    std::vector<entry> pending_entries;
+    std::vector<char> pending_text;
+    std::vector<record> records;
+};
+
+} // namespace framework::log::log_details
+
+namespace
+{
+using framework::log::log_details::thread_batch;
+
+/// @brief Batches of the thread, written on the thread exit.
+struct thread_batches
+{
+    ~thread_batches()
+    {
+        for (auto& batch : items) {
+            batch->write(true);
+        }
+    }
+
+    std::vector<std::shared_ptr<thread_batch>> items;
+};
+
+thread_local thread_batches local_batches;
+
+std::atomic<framework::uint64> loggers_count{0};
+
+} // namespace
+
+namespace framework::log
+{
+batching_logger::batching_logger(std::unique_ptr<logger_base> sink,
+                                 std::size_t batch_size,
+                                 std::chrono::milliseconds interval)
+    : m_sink(std::move(sink)),
+      m_batch_size(std::max<std::size_t>(batch_size, 1)),
+      m_interval(std::max(interval, std::chrono::milliseconds(1))),
+      m_id(loggers_count.fetch_add(1, std::memory_order_relaxed))
+{
+    const auto nanoseconds = std::chrono::duration<float64, std::nano>(interval).count();
+    m_interval_ticks       = static_cast<uint64>(nanoseconds / log_details::calibration().nanoseconds_per_tick);
+
+    m_flusher = std::thread([this]() { flusher_loop(); });
+}
+
+batching_logger::~batching_logger()
+{
+    {
+        std::lock_guard lock(m_flusher_mutex);
+        m_stop = true;
+        m_flusher_condition.notify_one();
+    }
+
+    m_flusher.join();
+
+    std::lock_guard lock(m_batches_mutex);
+
+    for (auto& batch : m_batches) {
+        batch->detach();
+    }
+
+    m_sink->flush();
+}
+
+void batching_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void batching_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    add_message(log_details::make_record(level, tag, message));
+}
+
+void batching_logger::add_message(const record& item)
+{
+    auto& batch = local_batch();
+
+    bool ready = false;
+    {
+        std::lock_guard lock(batch.mutex);
+
+        if (batch.entries.empty()) {
+            batch.first_ticks = item.timestamp;
+        }
+
+        batch.entries.push_back({item, item.tag.size(), item.message.size()});
+        batch.text.insert(batch.text.end(), item.tag.begin(), item.tag.end());
+        batch.text.insert(batch.text.end(), item.message.begin(), item.message.end());
+
+        ready = batch.entries.size() >= m_batch_size || item.level >= severity_level::error ||
+                item.timestamp - batch.first_ticks >= m_interval_ticks;
+    }
+
+    if (ready) {
+        batch.write(false);
+    }
+}
+
+void batching_logger::flush()
+{
+    for (auto& batch : batches()) {
+        batch->write(true);
+    }
+
+    m_sink->flush();
+}
+
+std::vector<std::shared_ptr<log_details::thread_batch>> batching_logger::batches()
+{
+    // The batches are written without the list lock, so the sink may log from a new thread.
+    std::lock_guard lock(m_batches_mutex);
+    return m_batches;
+}
+
+void batching_logger::flusher_loop()
+{
+    const auto period = std::max(m_interval / 2, std::chrono::milliseconds(1));
+
+    std::unique_lock lock(m_flusher_mutex);
+    while (!m_flusher_condition.wait_for(lock, period, [this]() { return m_stop; })) {
+        lock.unlock();
+
+        const uint64 now = log_details::timestamp_ticks();
+        for (auto& batch : batches()) {
+            // Don't wait for the owner thread, it is writing the batch already.
+            if (batch->expired(now, m_interval_ticks)) {
+                batch->write(false);
+            }
+        }
+
+        lock.lock();
+    }
+}
+
+log_details::thread_batch& batching_logger::local_batch()
+{
+    auto& items = local_batches.items;
+
+    for (auto& batch : items) {
+        if (batch->owner == m_id) {
+            return *batch;
+        }
+    }
+
+    // First message of this thread, forget batches of destroyed loggers.
+    items.erase(std::remove_if(items.begin(),
+                               items.end(),
+                               [](const auto& batch) {
+                                   std::lock_guard lock(batch->mutex);
+                                   return batch->sink == nullptr;
+                               }),
+                items.end());
+
+    auto batch = std::make_shared<log_details::thread_batch>(m_sink.get(), m_id);
+
+    {
+        std::lock_guard lock(m_batches_mutex);
+
+        // Batches owned only by this list belong to finished threads.
+        m_batches.erase(std::remove_if(m_batches.begin(),
+                                       m_batches.end(),
+                                       [](const auto& item) { return item.use_count() == 1; }),
+                        m_batches.end());
+
+        m_batches.push_back(batch);
+    }
+
+    items.push_back(batch);
+
+    return *batch;
+}
+
+} // namespace framework::log
@@ -0,0 +1,133 @@
+/// @file
+/// @brief Implementation of logger that passes messages to another logger in batches.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_BATCHING_LOGGER_HPP
+#define FRAMEWORK_LOG_BATCHING_LOGGER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <common/types.hpp>
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+namespace log_details
+{
+struct thread_batch;
+}
+
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Collects messages in per-thread buffers and passes them to another logger in batches.
+///
+/// Each thread fills its own buffer, so the sink lock is taken once per batch instead of@n
+/// once per message. A batch is written when it reaches the size limit, when the interval@n
+/// since its first message has passed, when a message of @ref severity_level::error or higher@n
+/// is added, on @ref flush and on thread exit.
+///
+/// A flusher thread wakes up every half of the interval and writes the batches that are@n
+/// older than the interval, so messages of a thread that went quiet are not delayed.@n
+/// The sink is called without holding the batch lock, so it may log itself.
+/// @code
+/// std::stringstream log_stream;
+/// set_logger(std::make_unique<batching_logger>(std::make_unique<stream_logger>(log_stream)));
+/// @endcode
+class batching_logger : public logger_base
+{
+public:
+    /// @brief Creates batching logger.
+    ///
+    /// @param sink Logger that receives batches, it should be thread safe.
+    /// @param batch_size Maximum count of messages in a batch.
+    /// @param interval Maximum time a message waits in the batch.
+    explicit batching_logger(std::unique_ptr<logger_base> sink,
+                             std::size_t batch_size             = 64,
+                             std::chrono::milliseconds interval = std::chrono::milliseconds(100));
+
+    /// @brief Stops the flusher thread and writes all buffered messages.
+    ~batching_logger() override;
+
+    batching_logger(const batching_logger&) = delete;
+    batching_logger& operator=(const batching_logger&) = delete;
+
+    batching_logger(batching_logger&&) = delete;
+    batching_logger& operator=(batching_logger&&) = delete;
+
+    /// @brief Adds message to the batch of the calling thread.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override;
+
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Adds message record to the batch of the calling thread.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Writes batches of all threads and flushes the sink.
+    void flush() override;
+
+private:
+    log_details::thread_batch& local_batch();
+    std::vector<std::shared_ptr<log_details::thread_batch>> batches();
+    void flusher_loop();
+
+    std::unique_ptr<logger_base> m_sink;
+    std::size_t m_batch_size;
+    std::chrono::milliseconds m_interval;
+    uint64 m_interval_ticks;
+    uint64 m_id;
+
+    std::mutex m_batches_mutex;
+    std::vector<std::shared_ptr<log_details::thread_batch>> m_batches;
+
+    bool m_stop = false; ///< Guarded by the flusher mutex.
+    std::mutex m_flusher_mutex;
+    std::condition_variable m_flusher_condition;
+    std::thread m_flusher;
+};
+
+/// @}
+
+} // namespace framework::log
+
+#endif
@@ -0,0 +1,83 @@
+/// @file
+/// @brief Binary log format details.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <log/binary_log_details.hpp>
+
+namespace framework::log::log_details
+{
+bool intern_table::find(std::string_view value, uint64 hash, uint16& id) const noexcept
+{
+    for (usize index = hash & (capacity - 1);; index = (index + 1) & (capacity - 1)) {
+        const entry& current = m_entries[index];
+
+        const uint64 current_hash = current.hash.load(std::memory_order_acquire);
+        if (current_hash == 0) {
+            return false;
+        }
+
+        if (current_hash == hash && current.value == value) {
+            id = current.id;
+            return true;
+        }
+    }
+}
+
+uint16 intern_table::insert(std::string_view value, uint64 hash)
+{
+    uint16 id = overflow_id;
+    if (find(value, hash, id)) {
+        return id;
+    }
+
+    if (m_values.size() >= max_size) {
+        return overflow_id;
+    }
+
+    usize index = hash & (capacity - 1);
+    while (m_entries[index].hash.load(std::memory_order_relaxed) != 0) {
+        index = (index + 1) & (capacity - 1);
+    }
+
+    // Deque keeps references valid, so the entry can point to the stored string.
+    m_values.emplace_back(value);
+
+    entry& current = m_entries[index];
+    current.value  = m_values.back();
+    current.id     = static_cast<uint16>(m_values.size() - 1);
+    current.hash.store(hash, std::memory_order_release);
+
+    return current.id;
+}
+
+const std::deque<std::string>& intern_table::values() const noexcept
+{
+    return m_values;
+}
+
+} // namespace framework::log::log_details
@@ -0,0 +1,232 @@
+/// @file
+/// @brief Binary log format details.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_BINARY_LOG_DETAILS_HPP
+#define FRAMEWORK_LOG_BINARY_LOG_DETAILS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <common/types.hpp>
+
+/// @details
+///
+/// The file starts with @ref file_magic, @ref file_version and the timestamp calibration@n
+/// followed by records.@n
+/// Each record starts with `uint16` size and `uint8` @ref record_type.@n
+/// Definition records (`tag`, `format`) contain `uint16` id and the string.@n
+/// Message records contain severity, thread index, timestamp ticks, tag and format ids@n
+/// and the arguments, each is prefixed with its @ref argument_type.@n
+/// Zero record size marks the end of the file.
+
+namespace framework::log::log_details
+{
+/// @brief Binary log file signature.
+constexpr std::array<char, 8> file_magic = {'F', 'W', 'B', 'L', 'O', 'G', '0', '1'};
+
+/// @brief Binary log format version.
+constexpr uint32 file_version = 1;
+
+/// @brief Size of the file header, the version is followed by @ref tick_calibration fields.
+constexpr usize file_header_size = file_magic.size() + sizeof(file_version) + sizeof(uint64) * 2 + sizeof(float64);
+
+/// @brief Maximum size of the record.
+constexpr usize max_record_size = 0xFFFF;
+
+/// @brief Maximum size of the string argument, longer strings are truncated.
+constexpr usize max_string_size = 4096;
+
+/// @brief Size of the definition record without the string.
+constexpr usize definition_header_size = sizeof(uint16) + sizeof(uint8) + sizeof(uint16);
+
+/// @brief Size of the message record without arguments.
+constexpr usize message_header_size = sizeof(uint16) + sizeof(uint8) * 2 + sizeof(uint32) + sizeof(uint64) +
+                                      sizeof(uint16) * 2 + sizeof(uint8);
+
+/// @brief Binary log record type.
+enum class record_type : uint8
+{
+    end     = 0, ///< End of the file.
+    tag     = 1, ///< Tag definition.
+    format  = 2, ///< Format string definition.
+    message = 3  ///< Log message.
+};
+
+/// @brief Type of the serialized argument.
+enum class argument_type : uint8
+{
+    boolean          = 1, ///< `uint8` value.
+    character        = 2, ///< `char` value.
+    signed_integer   = 3, ///< `int64` value.
+    unsigned_integer = 4, ///< `uint64` value.
+    floating_point   = 5, ///< `float64` value.
+    string           = 6  ///< `uint16` size and characters.
+};
+
+/// @brief Writes value to the buffer.
+///
+/// @param output Output buffer.
+/// @param value Value to write.
+///
+/// @return Pointer past the written value.
+template <typename T>
+inline uint8* store(uint8* output, T value) noexcept
+{
+    std::memcpy(output, &value, sizeof(T));
+    return output + sizeof(T);
+}
+
+/// @brief Reads value from the buffer.
+///
+/// @param input Input buffer.
+///
+/// @return The value.
+template <typename T>
+inline T load(const uint8* input) noexcept
+{
+    T value;
+    std::memcpy(&value, input, sizeof(T));
+    return value;
+}
+
+/// @brief Calculates size of the serialized argument.
+template <typename T>
+inline usize argument_size(const T& value) noexcept
+{
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>) {
+        return sizeof(argument_type) + sizeof(uint8);
+    } else if constexpr (std::is_integral_v<T> || std::is_floating_point_v<T>) {
+        return sizeof(argument_type) + sizeof(uint64);
+    } else {
+        static_assert(std::is_convertible_v<const T&, std::string_view>, "Unsupported argument type.");
+        return sizeof(argument_type) + sizeof(uint16) + std::min(std::string_view(value).size(), max_string_size);
+    }
+}
+
+/// @brief Serializes argument.
+///
+/// @param output Output buffer.
+/// @param value Argument value.
+///
+/// @return Pointer past the written argument.
+template <typename T>
+inline uint8* store_argument(uint8* output, const T& value) noexcept
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        output = store(output, argument_type::boolean);
+        return store(output, static_cast<uint8>(value ? 1 : 0));
+    } else if constexpr (std::is_same_v<T, char>) {
+        output = store(output, argument_type::character);
+        return store(output, value);
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        output = store(output, argument_type::signed_integer);
+        return store(output, static_cast<int64>(value));
+    } else if constexpr (std::is_integral_v<T>) {
+        output = store(output, argument_type::unsigned_integer);
+        return store(output, static_cast<uint64>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        output = store(output, argument_type::floating_point);
+        return store(output, static_cast<float64>(value));
+    } else {
+        const std::string_view view(value);
+        const usize size = std::min(view.size(), max_string_size);
+
+        output = store(output, argument_type::string);
+        output = store(output, static_cast<uint16>(size));
+        std::memcpy(output, view.data(), size);
+        return output + size;
+    }
+}
+
+/// @brief Interned ids cached by a logging statement.
+///
+/// Packs the logger serial number, the tag id and the format id, so a single load checks@n
+/// that the ids belong to the logger. Zero means empty.
+struct binary_call_site
+{
+    std::atomic<uint64> ids{0};
+};
+
+/// @brief Maps strings to small ids.
+///
+/// Lookup is lock free, insertion must be synchronized by the owner.
+class intern_table
+{
+public:
+    /// @brief Maximum count of the strings.
+    static constexpr usize max_size = 2048;
+
+    /// @brief Id returned when the table is full.
+    static constexpr uint16 overflow_id = 0;
+
+    /// @brief Looks up the string.
+    ///
+    /// @param value The string.
+    /// @param hash The string hash.
+    /// @param id Found id.
+    ///
+    /// @return `true` if the string is found.
+    bool find(std::string_view value, uint64 hash, uint16& id) const noexcept;
+
+    /// @brief Adds the string.
+    ///
+    /// @param value The string.
+    /// @param hash The string hash.
+    ///
+    /// @return The string id or @ref overflow_id if the table is full.
+    uint16 insert(std::string_view value, uint64 hash);
+
+    /// @brief Returns all strings ordered by id.
+    ///
+    /// @return Interned strings.
+    const std::deque<std::string>& values() const noexcept;
+
+private:
+    static constexpr usize capacity = max_size * 2;
+
+    struct entry
+    {
+        std::atomic<uint64> hash{0};
+        std::string_view value;
+        uint16 id = 0;
+    };
+
+    std::array<entry, capacity> m_entries;
+    std::deque<std::string> m_values;
+};
+
+} // namespace framework::log::log_details
+
+#endif
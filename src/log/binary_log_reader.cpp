@@ -0,0 +1,259 @@
+/// @file
+/// @brief Binary log reader implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <common/utils.hpp>
+#include <log/binary_log_details.hpp>
+#include <log/binary_log_reader.hpp>
+
+namespace
+{
+using framework::float64;
+using framework::int64;
+using framework::uint16;
+using framework::uint64;
+using framework::uint8;
+using framework::usize;
+using framework::log::log_details::argument_type;
+using framework::log::log_details::load;
+using framework::log::log_details::record_type;
+
+/// @brief Decoded argument.
+struct argument
+{
+    argument_type type     = argument_type::string;
+    int64 signed_value     = 0;
+    uint64 unsigned_value  = 0;
+    float64 floating_value = 0.0;
+    std::string_view text;
+};
+
+bool read_argument(const uint8*& input, const uint8* end, argument& value)
+{
+    if (input >= end) {
+        return false;
+    }
+
+    value.type = load<argument_type>(input++);
+
+    const usize remaining = static_cast<usize>(end - input);
+    switch (value.type) {
+        case argument_type::boolean:
+        case argument_type::character:
+            if (remaining < 1) {
+                return false;
+            }
+            value.unsigned_value = *input++;
+            return true;
+
+        case argument_type::signed_integer:
+        case argument_type::unsigned_integer:
+        case argument_type::floating_point:
+            if (remaining < sizeof(uint64)) {
+                return false;
+            }
+            value.signed_value   = load<int64>(input);
+            value.unsigned_value = load<uint64>(input);
+            value.floating_value = load<float64>(input);
+            input += sizeof(uint64);
+            return true;
+
+        case argument_type::string: {
+            if (remaining < sizeof(uint16)) {
+                return false;
+            }
+            const usize size = load<uint16>(input);
+            input += sizeof(uint16);
+            if (remaining - sizeof(uint16) < size) {
+                return false;
+            }
+            value.text = std::string_view(reinterpret_cast<const char*>(input), size);
+            input += size;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief Formats the message with the shared formatting engine.
+///
+/// The log may be truncated or written by another version, so fields without arguments are kept as `{}`@n
+/// and a format string that does not match the arguments is returned as is instead of failing the whole file.
+std::string format_message(std::string_view format, const std::vector<argument>& arguments)
+{
+    using framework::utils::format_details::make_arg;
+
+    std::vector<framework::utils::format_details::format_arg> values;
+    values.reserve(arguments.size() + 1);
+
+    for (const auto& value : arguments) {
+        switch (value.type) {
+            case argument_type::boolean: values.push_back(make_arg(value.unsigned_value != 0)); break;
+            case argument_type::character: values.push_back(make_arg(static_cast<char>(value.unsigned_value))); break;
+            case argument_type::signed_integer: values.push_back(make_arg(value.signed_value)); break;
+            case argument_type::unsigned_integer: values.push_back(make_arg(value.unsigned_value)); break;
+            case argument_type::floating_point: values.push_back(make_arg(value.floating_value)); break;
+            case argument_type::string: values.push_back(make_arg(value.text)); break;
+        }
+    }
+
+    // Each field starts with a brace, so their count is the upper bound of the fields count.
+    const auto fields = static_cast<usize>(std::count(format.begin(), format.end(), '{'));
+    while (values.size() < fields) {
+        values.push_back(make_arg(std::string_view("{}")));
+    }
+
+    const usize count = values.size();
+    values.emplace_back();
+
+    std::string output;
+    try {
+        framework::utils::format_details::vformat_to(framework::utils::format_details::make_sink(output),
+                                                     format,
+                                                     values.data(),
+                                                     count);
+    } catch (const framework::utils::format_error&) {
+        output.assign(format);
+    }
+
+    return output;
+}
+
+} // namespace
+
+namespace framework::log
+{
+binary_log_reader::binary_log_reader(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Can't open log file: " + path);
+    }
+
+    m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    const auto& magic = log_details::file_magic;
+    if (m_data.size() < log_details::file_header_size || !std::equal(magic.begin(), magic.end(), m_data.begin()) ||
+        load<uint32>(m_data.data() + magic.size()) != log_details::file_version) {
+        throw std::runtime_error("Wrong log file format: " + path);
+    }
+
+    const uint8* calibration = m_data.data() + magic.size() + sizeof(uint32);
+    m_base_ticks             = load<uint64>(calibration);
+    m_base_nanoseconds       = load<uint64>(calibration + sizeof(uint64));
+    m_nanoseconds_per_tick   = load<float64>(calibration + sizeof(uint64) * 2);
+
+    // Definitions can follow the messages using them, so they are collected first.
+    for (usize offset = log_details::file_header_size; offset + sizeof(uint16) <= m_data.size();) {
+        const usize size = load<uint16>(m_data.data() + offset);
+        if (size < log_details::definition_header_size || offset + size > m_data.size()) {
+            break;
+        }
+
+        const uint8* record = m_data.data() + offset;
+        const auto type     = load<record_type>(record + sizeof(uint16));
+
+        if (type == record_type::tag || type == record_type::format) {
+            const usize id = load<uint16>(record + sizeof(uint16) + sizeof(record_type));
+
+            const std::string value(reinterpret_cast<const char*>(record + log_details::definition_header_size),
+                                    size - log_details::definition_header_size);
+
+            auto& values = type == record_type::tag ? m_tags : m_formats;
+            if (values.size() <= id) {
+                values.resize(id + 1, "?");
+            }
+            values[id] = value;
+        }
+
+        offset += size;
+    }
+
+    m_offset = log_details::file_header_size;
+}
+
+bool binary_log_reader::next(binary_record& record)
+{
+    std::vector<argument> arguments;
+
+    while (m_offset + sizeof(uint16) <= m_data.size()) {
+        const usize size = load<uint16>(m_data.data() + m_offset);
+        if (size < log_details::definition_header_size || m_offset + size > m_data.size()) {
+            return false;
+        }
+
+        const uint8* input = m_data.data() + m_offset;
+        const uint8* end   = input + size;
+
+        m_offset += size;
+
+        if (load<record_type>(input + sizeof(uint16)) != record_type::message ||
+            size < log_details::message_header_size) {
+            continue;
+        }
+
+        input += sizeof(uint16) + sizeof(record_type);
+
+        record.level  = static_cast<severity_level>(*input++);
+        record.thread = load<uint32>(input);
+        input += sizeof(uint32);
+        const auto ticks = static_cast<float64>(static_cast<int64>(load<uint64>(input) - m_base_ticks));
+        record.timestamp = m_base_nanoseconds + static_cast<uint64>(static_cast<int64>(ticks * m_nanoseconds_per_tick));
+        input += sizeof(uint64);
+
+        const usize tag = load<uint16>(input);
+        input += sizeof(uint16);
+        const usize format = load<uint16>(input);
+        input += sizeof(uint16);
+        const usize count = *input++;
+
+        arguments.resize(count);
+        for (auto& value : arguments) {
+            if (!read_argument(input, end, value)) {
+                value = argument{};
+            }
+        }
+
+        record.tag     = tag < m_tags.size() ? m_tags[tag] : "?";
+        record.message = format_message(format < m_formats.size() ? m_formats[format] : "{}", arguments);
+
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace framework::log
@@ -0,0 +1,95 @@
+/// @file
+/// @brief Reader of the binary log files.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_BINARY_LOG_READER_HPP
+#define FRAMEWORK_LOG_BINARY_LOG_READER_HPP
+
+#include <string>
+#include <vector>
+
+#include <common/types.hpp>
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Decoded record of the binary log.
+struct binary_record
+{
+    uint64 timestamp     = 0;                     ///< Nanoseconds since the system clock epoch.
+    uint32 thread        = 0;                     ///< Thread index.
+    severity_level level = severity_level::debug; ///< The message @ref severity_level
+    std::string tag;                              ///< Message tag.
+    std::string message;                          ///< Formatted message.
+};
+
+/// @brief Reads files written by `::framework::log::binary_logger`.
+/// @code
+/// binary_log_reader reader("application.blog");
+/// binary_record record;
+/// while (reader.next(record)) {
+///     std::cout << record.tag << ": " << record.message;
+/// }
+/// @endcode
+class binary_log_reader
+{
+public:
+    /// @brief Loads the file.
+    ///
+    /// @param path Path to the log file.
+    ///
+    /// @throw std::runtime_error If the file can't be read or has wrong format.
+    explicit binary_log_reader(const std::string& path);
+
+    /// @brief Decodes next message.
+    ///
+    /// @param record Decoded message.
+    ///
+    /// @return `false` if there are no more messages.
+    bool next(binary_record& record);
+
+private:
+    std::vector<uint8> m_data;
+    usize m_offset = 0;
+
+    uint64 m_base_ticks            = 0;
+    uint64 m_base_nanoseconds      = 0;
+    float64 m_nanoseconds_per_tick = 1.0;
+
+    std::vector<std::string> m_tags;
+    std::vector<std::string> m_formats;
+};
+
+/// @}
+
+} // namespace framework::log
+
+#endif
@@ -0,0 +1,405 @@
+/// @file
+/// @brief Binary logger implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <stdexcept>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <log/binary_logger.hpp>
+#include <log/file_logger_details.hpp>
+
+namespace
+{
+using framework::uint8;
+using framework::uint64;
+using framework::usize;
+
+#if defined(_WIN32)
+
+bool map_file(const std::string& path, usize size, std::intptr_t& handle, std::intptr_t& mapping, uint8*& data)
+{
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    const auto file_size = static_cast<uint64>(size);
+    HANDLE file_mapping  = CreateFileMappingA(file,
+                                             nullptr,
+                                             PAGE_READWRITE,
+                                             static_cast<DWORD>(file_size >> 32),
+                                             static_cast<DWORD>(file_size & 0xFFFFFFFF),
+                                             nullptr);
+    if (file_mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(file_mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (view == nullptr) {
+        CloseHandle(file_mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    handle  = reinterpret_cast<std::intptr_t>(file);
+    mapping = reinterpret_cast<std::intptr_t>(file_mapping);
+    data    = static_cast<uint8*>(view);
+
+    return true;
+}
+
+void unmap_file(std::intptr_t handle, std::intptr_t mapping, uint8* data, usize /*capacity*/, usize used)
+{
+    UnmapViewOfFile(data);
+    CloseHandle(reinterpret_cast<HANDLE>(mapping));
+
+    auto file = reinterpret_cast<HANDLE>(handle);
+
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(used);
+    SetFilePointerEx(file, position, nullptr, FILE_BEGIN);
+    SetEndOfFile(file);
+
+    CloseHandle(file);
+}
+
+void sync_file(uint8* data, usize size)
+{
+    FlushViewOfFile(data, size);
+}
+
+#else
+
+bool map_file(const std::string& path, usize size, std::intptr_t& handle, std::intptr_t& mapping, uint8*& data)
+{
+    const int file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file < 0) {
+        return false;
+    }
+
+    if (::ftruncate(file, static_cast<off_t>(size)) != 0) {
+        ::close(file);
+        return false;
+    }
+
+    void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (view == MAP_FAILED) {
+        ::close(file);
+        return false;
+    }
+
+    handle  = file;
+    mapping = -1;
+    data    = static_cast<uint8*>(view);
+
+    return true;
+}
+
+void unmap_file(std::intptr_t handle, std::intptr_t /*mapping*/, uint8* data, usize capacity, usize used)
+{
+    ::munmap(data, capacity);
+
+    const auto file = static_cast<int>(handle);
+    if (::ftruncate(file, static_cast<off_t>(used)) != 0) {
+        // Unused tail stays zeroed, the reader stops at it.
+    }
+
+    ::close(file);
+}
+
+void sync_file(uint8* data, usize size)
+{
+    ::msync(data, size, MS_ASYNC);
+}
+
+#endif
+
+} // namespace
+
+namespace framework::log
+{
+using log_details::record_type;
+
+namespace
+{
+std::atomic<uint64> loggers_count{0};
+
+} // namespace
+
+binary_logger::binary_logger(std::string path, usize file_size, usize max_files)
+    : m_serial(loggers_count.fetch_add(1, std::memory_order_relaxed) + 1),
+      m_path(std::move(path)),
+      m_file_size(std::max(file_size, usize{4096})),
+      m_max_files(std::max(max_files, usize{1})),
+      m_tags(std::make_unique<log_details::intern_table>()),
+      m_formats(std::make_unique<log_details::intern_table>())
+{
+    // Ids reserved for overflowed tables and for text messages.
+    m_tags->insert("?", log_details::string_hash("?"));
+    m_formats->insert("{}", log_details::string_hash("{}"));
+
+    if (!open_segment(m_segment)) {
+        throw std::runtime_error("Can't create log file: " + m_path);
+    }
+
+    m_current.store(&m_segment);
+}
+
+binary_logger::~binary_logger()
+{
+    std::lock_guard lock(m_mutex);
+
+    segment* current = m_current.exchange(nullptr);
+    if (current != nullptr) {
+        while (current->writers.load() != 0) {
+            std::this_thread::yield();
+        }
+
+        close_segment(*current);
+    }
+}
+
+void binary_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void binary_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    const uint16 tag_id = intern(*m_tags, record_type::tag, tag);
+
+    write_record(level, log_details::timestamp_ticks(), log_details::thread_index(), tag_id, text_format_id, message);
+}
+
+void binary_logger::add_message(const record& item)
+{
+    // Text is stored as the single argument of the reserved format, nothing is reformatted.
+    const uint16 tag_id = intern(*m_tags, record_type::tag, item.tag);
+
+    write_record(item.level, item.timestamp, item.thread, tag_id, text_format_id, item.message);
+}
+
+void binary_logger::flush()
+{
+    std::lock_guard lock(m_mutex);
+
+    segment* current = m_current.load();
+    if (current != nullptr) {
+        sync_file(current->data, current->offset.load());
+    }
+}
+
+usize binary_logger::dropped_count() const noexcept
+{
+    return m_dropped_count.load(std::memory_order_relaxed);
+}
+
+uint16 binary_logger::intern(log_details::intern_table& table, record_type type, std::string_view value)
+{
+    const uint64 hash = log_details::string_hash(value);
+
+    uint16 id = log_details::intern_table::overflow_id;
+    if (table.find(value, hash, id)) {
+        return id;
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    if (table.find(value, hash, id) || table.values().size() >= log_details::intern_table::max_size) {
+        return id;
+    }
+
+    // The definition is written before the id is published, so other threads can't write it first.
+    id = static_cast<uint16>(table.values().size());
+
+    segment* current = m_current.load();
+    if (current != nullptr && !write_definition(*current, type, id, value)) {
+        rotate_locked(current);
+
+        current = m_current.load();
+        if (current != nullptr) {
+            write_definition(*current, type, id, value);
+        }
+    }
+
+    return table.insert(value, hash);
+}
+
+uint8* binary_logger::reserve(usize size, segment*& current)
+{
+    while (true) {
+        current = m_current.load();
+        if (current == nullptr) {
+            // Wait for the rotation, the pointer stays null only if it failed.
+            std::lock_guard lock(m_mutex);
+            if (m_current.load() == nullptr) {
+                return nullptr;
+            }
+            continue;
+        }
+
+        current->writers.fetch_add(1);
+        if (m_current.load() != current) {
+            current->writers.fetch_sub(1);
+            continue;
+        }
+
+        usize offset = current->offset.load(std::memory_order_relaxed);
+        while (offset + size <= current->capacity) {
+            if (current->offset.compare_exchange_weak(offset, offset + size, std::memory_order_relaxed)) {
+                return current->data + offset;
+            }
+        }
+
+        current->writers.fetch_sub(1);
+        rotate(current);
+    }
+}
+
+void binary_logger::commit(segment* current) noexcept
+{
+    current->writers.fetch_sub(1, std::memory_order_release);
+}
+
+void binary_logger::rotate(segment* full)
+{
+    std::lock_guard lock(m_mutex);
+    rotate_locked(full);
+}
+
+void binary_logger::rotate_locked(segment* full)
+{
+    if (m_current.load() != full) {
+        return;
+    }
+
+    m_current.store(nullptr);
+
+    while (full->writers.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    close_segment(*full);
+
+    if (open_segment(*full)) {
+        m_current.store(full);
+    }
+}
+
+bool binary_logger::open_segment(segment& target)
+{
+    log_details::shift_files(m_path, m_max_files);
+
+    if (!map_file(m_path, m_file_size, target.handle, target.mapping, target.data)) {
+        target.data     = nullptr;
+        target.capacity = 0;
+        return false;
+    }
+
+    target.capacity = m_file_size;
+
+    const log_details::tick_calibration& calibration = log_details::calibration();
+
+    uint8* output = target.data;
+    std::memcpy(output, log_details::file_magic.data(), log_details::file_magic.size());
+    output = log_details::store(output + log_details::file_magic.size(), log_details::file_version);
+    output = log_details::store(output, calibration.ticks);
+    output = log_details::store(output, calibration.nanoseconds);
+    log_details::store(output, calibration.nanoseconds_per_tick);
+
+    target.offset.store(log_details::file_header_size);
+
+    // Every file is decodable on its own.
+    const auto& tags = m_tags->values();
+    for (usize id = 0; id < tags.size(); ++id) {
+        write_definition(target, record_type::tag, static_cast<uint16>(id), tags[id]);
+    }
+
+    const auto& formats = m_formats->values();
+    for (usize id = 0; id < formats.size(); ++id) {
+        write_definition(target, record_type::format, static_cast<uint16>(id), formats[id]);
+    }
+
+    return true;
+}
+
+void binary_logger::close_segment(segment& target) noexcept
+{
+    if (target.data == nullptr) {
+        return;
+    }
+
+    unmap_file(target.handle, target.mapping, target.data, target.capacity, target.offset.load());
+
+    target.data     = nullptr;
+    target.capacity = 0;
+    target.offset.store(0);
+}
+
+bool binary_logger::write_definition(segment& target, record_type type, uint16 id, std::string_view value) noexcept
+{
+    const usize length = std::min(value.size(), log_details::max_string_size);
+    const usize size   = log_details::definition_header_size + length;
+
+    usize offset = target.offset.load(std::memory_order_relaxed);
+    do {
+        if (offset + size > target.capacity) {
+            return false;
+        }
+    } while (!target.offset.compare_exchange_weak(offset, offset + size, std::memory_order_relaxed));
+
+    uint8* record = target.data + offset;
+    uint8* output = log_details::store(record + sizeof(uint16), type);
+    output        = log_details::store(output, id);
+    std::memcpy(output, value.data(), length);
+
+    std::atomic_thread_fence(std::memory_order_release);
+    log_details::store(record, static_cast<uint16>(size));
+
+    return true;
+}
+
+} // namespace framework::log
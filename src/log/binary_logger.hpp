@@ -0,0 +1,292 @@
+/// @file
+/// @brief Implementation of logger that writes compact binary records.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_BINARY_LOGGER_HPP
+#define FRAMEWORK_LOG_BINARY_LOGGER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <log/binary_log_details.hpp>
+#include <log/log_details.hpp>
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Writes compact binary records into memory-mapped rotating files.
+///
+/// Tags and format strings are interned and written once per file, messages store@n
+/// only their ids, timestamp, thread index and raw argument bytes, the text is rendered@n
+/// offline by `::framework::log::binary_log_reader` or the `log_decoder` tool.
+///
+/// When the current file is full, it is renamed to `path.1`, older files are shifted@n
+/// and only `max_files` files are retained.
+///
+/// @ref FRAMEWORK_LOG_BINARY caches the interned ids in the logging statement, so the tag@n
+/// and the format are not hashed on every call.
+/// @code
+/// binary_logger logger("application.blog");
+/// logger.write(severity_level::info, "renderer", "frame {} took {:.3f} ms", frame, time);
+/// FRAMEWORK_LOG_BINARY(logger, info, "renderer", "frame {} took {:.3f} ms", frame, time);
+/// @endcode
+class binary_logger : public logger_base
+{
+public:
+    /// @brief Creates binary logger.
+    ///
+    /// @param path Path to the log file.
+    /// @param file_size Size of one log file.
+    /// @param max_files Count of retained files including the current one.
+    explicit binary_logger(std::string path, usize file_size = 16 * 1024 * 1024, usize max_files = 4);
+
+    /// @brief Truncates the current file to the written size and closes it.
+    ~binary_logger() override;
+
+    binary_logger(const binary_logger&) = delete;
+    binary_logger& operator=(const binary_logger&) = delete;
+
+    binary_logger(binary_logger&&) = delete;
+    binary_logger& operator=(binary_logger&&) = delete;
+
+    /// @brief Writes text message as the single argument of the `{}` format.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override;
+
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Writes text message with the timestamp and the thread of the record.
+    ///
+    /// The source location is not stored.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Writes message without formatting it.
+    ///
+    /// Supported arguments are `bool`, characters, integers, floating point numbers and strings.@n
+    /// Every `{}` or `{:spec}` in the format is replaced by the next argument when the log is decoded.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param format Format string.
+    /// @param arguments Message arguments.
+    template <typename... Arguments>
+    void write(severity_level level, std::string_view tag, std::string_view format, const Arguments&... arguments);
+
+    /// @brief Writes message without formatting it, the ids of the tag and the format are cached in the call site.
+    ///
+    /// The call site must always be used with the same tag and format, see @ref FRAMEWORK_LOG_BINARY.
+    ///
+    /// @param site Cache of the statement.
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param format Format string.
+    /// @param arguments Message arguments.
+    template <typename... Arguments>
+    void write(log_details::binary_call_site& site,
+               severity_level level,
+               std::string_view tag,
+               std::string_view format,
+               const Arguments&... arguments);
+
+    /// @brief Schedules the mapped data to be written to the file.
+    void flush() override;
+
+    /// @brief Returns count of messages that do not fit into a record.
+    ///
+    /// @return Dropped messages count.
+    usize dropped_count() const noexcept;
+
+private:
+    struct segment
+    {
+        uint8* data           = nullptr;
+        usize capacity        = 0;
+        std::intptr_t handle  = -1;
+        std::intptr_t mapping = -1;
+
+        std::atomic<usize> offset{0};
+        std::atomic<usize> writers{0};
+    };
+
+    /// @brief Id of the `{}` format, reserved for text messages.
+    static constexpr uint16 text_format_id = 0;
+
+    template <typename... Arguments>
+    void write_record(severity_level level,
+                      uint64 timestamp,
+                      uint32 thread,
+                      uint16 tag_id,
+                      uint16 format_id,
+                      const Arguments&... arguments);
+
+    uint16 intern(log_details::intern_table& table, log_details::record_type type, std::string_view value);
+
+    uint8* reserve(usize size, segment*& current);
+    void commit(segment* current) noexcept;
+
+    void rotate(segment* full);
+    void rotate_locked(segment* full);
+    bool open_segment(segment& target);
+    void close_segment(segment& target) noexcept;
+    bool write_definition(segment& target, log_details::record_type type, uint16 id, std::string_view value) noexcept;
+
+    const uint64 m_serial; ///< Distinguishes loggers in the call site caches.
+
+    std::string m_path;
+    usize m_file_size;
+    usize m_max_files;
+
+    std::unique_ptr<log_details::intern_table> m_tags;
+    std::unique_ptr<log_details::intern_table> m_formats;
+
+    segment m_segment;
+    std::atomic<segment*> m_current{nullptr}; ///< Null while rotating or after a failure.
+    std::atomic<usize> m_dropped_count{0};
+
+    std::mutex m_mutex;
+};
+
+/// @}
+
+#pragma region definitions
+
+template <typename... Arguments>
+inline void binary_logger::write(severity_level level,
+                                 std::string_view tag,
+                                 std::string_view format,
+                                 const Arguments&... arguments)
+{
+    const uint16 tag_id    = intern(*m_tags, log_details::record_type::tag, tag);
+    const uint16 format_id = intern(*m_formats, log_details::record_type::format, format);
+
+    write_record(level, log_details::timestamp_ticks(), log_details::thread_index(), tag_id, format_id, arguments...);
+}
+
+template <typename... Arguments>
+inline void binary_logger::write(log_details::binary_call_site& site,
+                                 severity_level level,
+                                 std::string_view tag,
+                                 std::string_view format,
+                                 const Arguments&... arguments)
+{
+    uint64 ids = site.ids.load(std::memory_order_relaxed);
+
+    if ((ids >> 32) != m_serial) {
+        const uint16 tag_id    = intern(*m_tags, log_details::record_type::tag, tag);
+        const uint16 format_id = intern(*m_formats, log_details::record_type::format, format);
+
+        // Ids never change, so a racing store writes the same value.
+        ids = (m_serial << 32) | (uint64{tag_id} << 16) | format_id;
+        site.ids.store(ids, std::memory_order_relaxed);
+    }
+
+    write_record(level,
+                 log_details::timestamp_ticks(),
+                 log_details::thread_index(),
+                 static_cast<uint16>(ids >> 16),
+                 static_cast<uint16>(ids),
+                 arguments...);
+}
+
+template <typename... Arguments>
+inline void binary_logger::write_record(severity_level level,
+                                        uint64 timestamp,
+                                        uint32 thread,
+                                        uint16 tag_id,
+                                        uint16 format_id,
+                                        const Arguments&... arguments)
+{
+    using log_details::argument_size;
+    using log_details::store;
+    using log_details::store_argument;
+
+    const usize size = log_details::message_header_size + (usize{0} + ... + argument_size(arguments));
+    if (size > log_details::max_record_size || sizeof...(Arguments) > 0xFF) {
+        m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    segment* current = nullptr;
+    uint8* record    = reserve(size, current);
+    if (record == nullptr) {
+        m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint8* output = record + sizeof(uint16);
+    output        = store(output, log_details::record_type::message);
+    output        = store(output, static_cast<uint8>(level));
+    output        = store(output, thread);
+    output        = store(output, timestamp);
+    output        = store(output, tag_id);
+    output        = store(output, format_id);
+    output        = store(output, static_cast<uint8>(sizeof...(Arguments)));
+    ((output = store_argument(output, arguments)), ...);
+
+    // Size is written last, so an unfinished record looks like the end of the file.
+    std::atomic_thread_fence(std::memory_order_release);
+    store(record, static_cast<uint16>(size));
+
+    commit(current);
+}
+
+#pragma endregion
+
+} // namespace framework::log
+
+/// @addtogroup log_interface_functions
+/// @{
+
+/// @brief Writes message to the binary logger, the statement caches the ids of its tag and format.
+///
+/// The tag and the format must not change between executions of the statement.
+/// @code
+/// FRAMEWORK_LOG_BINARY(logger, info, "renderer", "frame {} took {:.3f} ms", frame, time);
+/// @endcode
+#define FRAMEWORK_LOG_BINARY(logger, level, tag, ...)                                                     \
+    do {                                                                                                 \
+        static ::framework::log::log_details::binary_call_site framework_log_binary_site;                \
+        (logger).write(framework_log_binary_site, ::framework::log::severity_level::level, tag, __VA_ARGS__); \
+    } while (false)
+
+/// @}
+
+#endif
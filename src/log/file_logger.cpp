@@ -0,0 +1,368 @@
+/// @file
+/// @brief File logger implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <log/file_logger.hpp>
+#include <log/file_logger_details.hpp>
+#include <log/log_details.hpp>
+
+namespace
+{
+using framework::usize;
+
+constexpr std::chrono::seconds retry_interval{1};
+
+#if defined(_WIN32)
+
+std::intptr_t open_file(const std::string& path)
+{
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_WRITE,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+
+    return file == INVALID_HANDLE_VALUE ? -1 : reinterpret_cast<std::intptr_t>(file);
+}
+
+void write_file(std::intptr_t handle, const char* data, usize size)
+{
+    while (size > 0) {
+        DWORD written = 0;
+        const auto chunk = static_cast<DWORD>(std::min<usize>(size, 0x40000000));
+        if (!WriteFile(reinterpret_cast<HANDLE>(handle), data, chunk, &written, nullptr) || written == 0) {
+            return;
+        }
+
+        data += written;
+        size -= written;
+    }
+}
+
+void sync_file(std::intptr_t handle)
+{
+    FlushFileBuffers(reinterpret_cast<HANDLE>(handle));
+}
+
+void close_file(std::intptr_t handle)
+{
+    CloseHandle(reinterpret_cast<HANDLE>(handle));
+}
+
+#else
+
+std::intptr_t open_file(const std::string& path)
+{
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+}
+
+void write_file(std::intptr_t handle, const char* data, usize size)
+{
+    while (size > 0) {
+        const ssize_t written = ::write(static_cast<int>(handle), data, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (written <= 0) {
+            return;
+        }
+
+        data += written;
+        size -= static_cast<usize>(written);
+    }
+}
+
+void sync_file(std::intptr_t handle)
+{
+#if defined(__APPLE__)
+    ::fsync(static_cast<int>(handle));
+#else
+    ::fdatasync(static_cast<int>(handle));
+#endif
+}
+
+void close_file(std::intptr_t handle)
+{
+    ::close(static_cast<int>(handle));
+}
+
+#endif
+
+} // namespace
+
+namespace framework::log
+{
+file_logger::file_logger(std::string path,
+                         usize file_size,
+                         usize max_files,
+                         std::chrono::seconds interval,
+                         bool sync_on_error)
+    : m_path(std::move(path)),
+      m_file_size(std::max(file_size, usize{1})),
+      m_max_files(std::max(max_files, usize{1})),
+      m_sync_on_error(sync_on_error),
+      m_buffer(std::make_unique<block>())
+{
+    const float64 nanoseconds_per_tick = log_details::calibration().nanoseconds_per_tick;
+    if (interval.count() > 0) {
+        const auto nanoseconds = std::chrono::duration<float64, std::nano>(interval).count();
+        m_interval_ticks       = static_cast<uint64>(nanoseconds / nanoseconds_per_tick);
+    }
+
+    const auto retry_nanoseconds = std::chrono::duration<float64, std::nano>(retry_interval).count();
+    m_retry_ticks                = static_cast<uint64>(retry_nanoseconds / nanoseconds_per_tick);
+
+    open();
+
+    if (m_handle < 0) {
+        throw std::runtime_error("Can't create log file: " + m_path);
+    }
+}
+
+file_logger::~file_logger()
+{
+    std::lock_guard lock(m_mutex);
+
+    close();
+}
+
+void file_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void file_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    add_message(log_details::make_record(level, tag, message));
+}
+
+void file_logger::add_message(const record& item)
+{
+    std::lock_guard lock(m_mutex);
+
+    append(item);
+}
+
+void file_logger::add_messages(const record* records, std::size_t count)
+{
+    std::lock_guard lock(m_mutex);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        append(records[i]);
+    }
+}
+
+void file_logger::flush()
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_handle < 0) {
+        reopen();
+    }
+
+    write_buffer();
+}
+
+void file_logger::append(const record& item)
+{
+    const std::string_view name      = level_name(item.level);
+    const std::string_view timestamp = m_timestamp.format(item.timestamp);
+
+    std::array<char, 16> thread{};
+    const auto thread_end = std::to_chars(thread.data(), thread.data() + thread.size(), item.thread).ptr;
+    const std::string_view thread_text(thread.data(), static_cast<usize>(thread_end - thread.data()));
+
+    std::string_view file;
+    std::array<char, 16> line{};
+    std::string_view line_text;
+    if (item.file != nullptr) {
+        file = item.file;
+        file.remove_prefix(std::min(file.size(), file.find_last_of("/\\") + 1));
+
+        const auto line_end = std::to_chars(line.data(), line.data() + line.size(), item.line).ptr;
+        line_text           = std::string_view(line.data(), static_cast<usize>(line_end - line.data()));
+    }
+
+    const usize location_size = file.empty() ? 0 : file.size() + line_text.size() + 4;
+    const usize size          = timestamp.size() + name.size() + thread_text.size() + item.tag.size() +
+                       location_size + item.message.size() + 8;
+
+    if (m_handle < 0) {
+        if (log_details::timestamp_ticks() - m_open_ticks < m_retry_ticks) {
+            return;
+        }
+
+        reopen();
+        if (m_handle < 0) {
+            return;
+        }
+    }
+
+    const usize file_size = m_written_size + m_buffer_used;
+    if ((file_size > 0 && file_size + size > m_file_size) ||
+        (m_interval_ticks > 0 && log_details::timestamp_ticks() - m_open_ticks >= m_interval_ticks)) {
+        rotate();
+    }
+
+    if (m_handle < 0) {
+        return;
+    }
+
+    put(timestamp);
+    put(" [");
+    put(name);
+    put("] #");
+    put(thread_text);
+    put(" ");
+    put(item.tag);
+    if (!file.empty()) {
+        put(" (");
+        put(file);
+        put(":");
+        put(line_text);
+        put(")");
+    }
+    put(": ");
+    put(item.message);
+
+    if (item.level >= severity_level::error) {
+        write_buffer();
+
+        if (m_sync_on_error) {
+            sync();
+        }
+    }
+}
+
+void file_logger::put(std::string_view text)
+{
+    // Long text goes directly to the file.
+    if (m_buffer_used == 0 && text.size() >= buffer_size) {
+        write_file(m_handle, text.data(), text.size());
+        m_written_size += text.size();
+        return;
+    }
+
+    while (!text.empty()) {
+        const usize size = std::min(text.size(), buffer_size - m_buffer_used);
+
+        std::memcpy(m_buffer->data + m_buffer_used, text.data(), size);
+        m_buffer_used += size;
+        text.remove_prefix(size);
+
+        if (m_buffer_used == buffer_size) {
+            write_buffer();
+        }
+    }
+}
+
+void file_logger::write_buffer()
+{
+    if (m_buffer_used == 0 || m_handle < 0) {
+        return;
+    }
+
+    write_file(m_handle, m_buffer->data, m_buffer_used);
+
+    m_written_size += m_buffer_used;
+    m_buffer_used = 0;
+}
+
+void file_logger::sync()
+{
+    if (m_handle >= 0) {
+        sync_file(m_handle);
+    }
+}
+
+void file_logger::open()
+{
+    log_details::shift_files(m_path, m_max_files);
+
+    m_handle       = open_file(m_path);
+    m_written_size = 0;
+    m_open_ticks   = log_details::timestamp_ticks();
+}
+
+void file_logger::reopen()
+{
+    // The files were already shifted by the failed rotation.
+    m_handle       = open_file(m_path);
+    m_written_size = 0;
+    m_open_ticks   = log_details::timestamp_ticks();
+
+    if (m_handle >= 0) {
+        m_failure_reported = false;
+    }
+}
+
+void file_logger::close()
+{
+    if (m_handle < 0) {
+        return;
+    }
+
+    write_buffer();
+    close_file(m_handle);
+
+    m_handle = -1;
+}
+
+void file_logger::rotate()
+{
+    close();
+    open();
+
+    if (m_handle < 0 && !m_failure_reported) {
+        m_failure_reported = true;
+        std::fprintf(stderr, "Can't reopen log file %s, messages are dropped until it is reopened.\n", m_path.c_str());
+    }
+}
+
+} // namespace framework::log
@@ -0,0 +1,161 @@
+/// @file
+/// @brief Implementation of logger that writes messages to rotating files.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_FILE_LOGGER_HPP
+#define FRAMEWORK_LOG_FILE_LOGGER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <common/types.hpp>
+#include <log/log_details.hpp>
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Writes messages to a file, rotating it by size and time.
+///
+/// Messages are formatted as `2026-10-16 12:00:00.000000 [info] #0 tag (file.cpp:10): message`,@n
+/// where `#0` is the thread index and the location is printed only for the logging macros.@n
+/// They are collected in a page aligned buffer, that is written to the file@n
+/// with a single system call when it is full, so the file grows@n
+/// by whole buffers. The buffer is also written on @ref flush and on messages of@n
+/// @ref severity_level::error or higher, which can additionally be synced to the disk.
+///
+/// When the file reaches the size limit or the rotation interval passes, it is renamed@n
+/// to `path.1`, older files are shifted in the same way and at most `max_files` are kept.@n
+/// Existing files are rotated when the logger is created.@n
+/// If the file can't be reopened during rotation, the failure is reported to `stderr` once,@n
+/// messages are dropped and reopening is retried on @ref flush and at most once a second on new messages.
+/// @code
+/// set_logger(std::make_unique<file_logger>("application.log"));
+/// @endcode
+class file_logger : public logger_base
+{
+public:
+    /// @brief Buffer size, also the size of writes to the file.
+    static constexpr usize buffer_size = 64 * 1024;
+
+    /// @brief Creates file logger.
+    ///
+    /// @param path Log file path.
+    /// @param file_size Maximum size of one file.
+    /// @param max_files Count of retained files including the current one.
+    /// @param interval Rotation interval, zero disables time based rotation.
+    /// @param sync_on_error Sync the file to the disk on error and fatal messages.
+    ///
+    /// @throw std::runtime_error if the file can't be created.
+    explicit file_logger(std::string path,
+                         usize file_size               = 16 * 1024 * 1024,
+                         usize max_files               = 4,
+                         std::chrono::seconds interval = std::chrono::seconds::zero(),
+                         bool sync_on_error            = false);
+
+    /// @brief Writes buffered messages and closes the file.
+    ~file_logger() override;
+
+    file_logger(const file_logger&) = delete;
+    file_logger& operator=(const file_logger&) = delete;
+
+    file_logger(file_logger&&) = delete;
+    file_logger& operator=(file_logger&&) = delete;
+
+    /// @brief Adds message to the buffer.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override;
+
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Adds message record to the buffer.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Adds messages to the buffer under a single lock.
+    ///
+    /// @param records Pointer to the first record.
+    /// @param count Records count.
+    void add_messages(const record* records, std::size_t count) override;
+
+    /// @brief Writes buffered messages to the file.
+    void flush() override;
+
+private:
+    struct alignas(4096) block
+    {
+        char data[buffer_size];
+    };
+
+    void append(const record& item);
+    void put(std::string_view text);
+    void write_buffer();
+    void sync();
+
+    void open();
+    void reopen();
+    void close();
+    void rotate();
+
+    std::string m_path;
+    usize m_file_size;
+    usize m_max_files;
+    uint64 m_interval_ticks = 0;
+    uint64 m_retry_ticks    = 0;
+    bool m_sync_on_error;
+    bool m_failure_reported = false;
+
+    std::intptr_t m_handle = -1;
+    usize m_written_size   = 0;
+    uint64 m_open_ticks    = 0;
+
+    std::unique_ptr<block> m_buffer;
+    usize m_buffer_used = 0;
+
+    log_details::timestamp_formatter m_timestamp;
+
+    std::mutex m_mutex;
+};
+
+/// @}
+
+} // namespace framework::log
+
+#endif
@@ -0,0 +1,52 @@
+/// @file
+/// @brief Log file rotation details.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <cstdio>
+
+#include <log/file_logger_details.hpp>
+
+namespace framework::log::log_details
+{
+std::string rotated_path(const std::string& path, usize index)
+{
+    return index == 0 ? path : path + "." + std::to_string(index);
+}
+
+void shift_files(const std::string& path, usize max_files)
+{
+    for (usize index = max_files - 1; index > 0; --index) {
+        const std::string source      = rotated_path(path, index - 1);
+        const std::string destination = rotated_path(path, index);
+
+        std::remove(destination.c_str());
+        std::rename(source.c_str(), destination.c_str());
+    }
+}
+
+} // namespace framework::log::log_details
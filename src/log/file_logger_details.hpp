@@ -0,0 +1,57 @@
+/// @file
+/// @brief Log file rotation details.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_FILE_LOGGER_DETAILS_HPP
+#define FRAMEWORK_LOG_FILE_LOGGER_DETAILS_HPP
+
+#include <string>
+
+#include <common/types.hpp>
+
+namespace framework::log::log_details
+{
+/// @brief Returns name of the rotated log file.
+///
+/// @param path Path of the current file.
+/// @param index Rotation index, zero is the current file.
+///
+/// @return `path` for zero index, `path.index` otherwise.
+std::string rotated_path(const std::string& path, usize index);
+
+/// @brief Renames `path` to `path.1`, `path.1` to `path.2` and so on.
+///
+/// The oldest file is removed, so at most @p max_files files remain including the new current one.
+///
+/// @param path Path of the current file.
+/// @param max_files Count of retained files.
+void shift_files(const std::string& path, usize max_files);
+
+} // namespace framework::log::log_details
+
+#endif
@@ -27,13 +27,32 @@
 // SOFTWARE.
 // =============================================================================
 
-#include <common/utils.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include <log/log.hpp>
 
 namespace
 {
 using ::framework::log::logger_base;
-using ::framework::log::log_details::log_buffer;
+using ::framework::log::severity_level;
 using ::framework::log::log_details::log_ostream;
 
 class dummy_logger : public logger_base
@@ -44,16 +63,237 @@ class dummy_logger : public logger_base
     {
         // nothing to do.
     }
+
+    void add_message(::framework::log::severity_level /*level*/,
+                     std::string_view /*tag*/,
+                     std::string_view /*message*/) override
+    {
+        // nothing to do.
+    }
+
+    void add_message(const ::framework::log::record& /*item*/) override
+    {
+        // nothing to do.
+    }
 };
 
-std::unique_ptr<logger_base>& logger_instance()
+/// @brief Runtime severity filter.
+///
+/// Tag overrides are published as immutable tables, so readers never lock.
+/// Overrides are expected to change rarely, superseded tables are kept until exit.
+struct level_filter
+{
+    using tag_level = std::pair<std::string, severity_level>;
+    using tag_table = std::vector<tag_level>; ///< Sorted by tag.
+
+    static tag_table::const_iterator find(const tag_table& table, std::string_view tag)
+    {
+        return std::lower_bound(table.begin(),
+                                table.end(),
+                                tag,
+                                [](const tag_level& item, std::string_view value) { return item.first < value; });
+    }
+
+    /// @brief Publishes new table, writer mutex should be locked.
+    void publish(tag_table table)
+    {
+        tables.push_back(std::make_unique<const tag_table>(std::move(table)));
+        const tag_table* current = tables.back().get();
+        tag_levels.store(current->empty() ? nullptr : current, std::memory_order_release);
+    }
+
+    std::atomic<severity_level> level{severity_level::debug};
+    std::atomic<const tag_table*> tag_levels{nullptr}; ///< Null if there are no overrides.
+
+    std::mutex writer_mutex;
+    std::vector<std::unique_ptr<const tag_table>> tables;
+};
+
+level_filter& filter()
+{
+    static level_filter instance;
+    return instance;
+}
+
+logger_base* dummy_instance()
+{
+    static dummy_logger instance;
+    return &instance;
+}
+
+/// @brief Hazard pointers, each non null pointer is a slot claimed by a handle.
+///
+/// Threads adopt records to claim slots without contention, but a slot is owned by its handle,@n
+/// so the handles can be released in any order and on any thread.
+/// @brief Read side state of a thread, see @ref framework::log::log_details::logger_handle.
+struct reader_record
+{
+    /// Odd while the thread uses the logger. Only the owner thread changes it.
+    std::atomic<framework::uint64> sequence{0};
+    std::atomic<bool> active{false};
+    reader_record* next = nullptr;
+};
+
+struct logger_state
+{
+    ~logger_state()
+    {
+        logger_base* last = current.exchange(nullptr);
+        if (last != dummy_instance()) {
+            delete last;
+        }
+
+        for (logger_base* item : leaked) {
+            delete item;
+        }
+
+        // Records can still be used by exiting threads.
+    }
+
+    std::atomic<logger_base*> current{dummy_instance()};
+    std::atomic<reader_record*> records{nullptr};
+
+    std::mutex leaked_mutex;
+    std::vector<logger_base*> leaked; ///< Retired without the process barrier, destroyed at exit.
+};
+
+logger_state& state()
+{
+    static logger_state instance;
+    return instance;
+}
+
+void push_record(reader_record* record)
+{
+    auto& records = state().records;
+
+    reader_record* head = records.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+}
+
+reader_record* acquire_record()
+{
+    for (reader_record* record = state().records.load(std::memory_order_acquire); record != nullptr;
+         record                = record->next) {
+        bool active = false;
+        if (!record->active.load(std::memory_order_relaxed) &&
+            record->active.compare_exchange_strong(active, true, std::memory_order_acquire)) {
+            return record;
+        }
+    }
+
+    auto* record = new reader_record;
+    record->active.store(true, std::memory_order_relaxed);
+
+    push_record(record);
+
+    return record;
+}
+
+/// @brief Makes the section marks of all threads visible to the caller.
+///
+/// Executes a memory barrier on every running thread of the process, so the readers@n
+/// don't need a fence between marking the section and loading the logger.
+///
+/// @return False if the barrier is not supported.
+bool process_barrier() noexcept
+{
+#if defined(__linux__)
+    static const bool expedited = ::syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+
+    if (expedited && ::syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) == 0) {
+        return true;
+    }
+
+    return ::syscall(SYS_membarrier, MEMBARRIER_CMD_GLOBAL, 0, 0) == 0;
+#elif defined(_WIN32)
+    ::FlushProcessWriteBuffers();
+    return true;
+#else
+    // The readers execute the fence themselves.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return true;
+#endif
+}
+
+/// @brief Destroys the loggers once no thread uses them, the calling thread is excluded.
+///
+/// @param loggers Retired loggers, the vector is left empty if they are destroyed.
+/// @param self Record of the calling thread.
+/// @param wait Wait for the other threads, otherwise keep the loggers if a thread uses a logger.
+void reclaim(std::vector<logger_base*>& loggers, const reader_record* self, bool wait)
+{
+    if (loggers.empty()) {
+        return;
+    }
+
+    if (!process_barrier()) {
+        auto& instance = state();
+
+        std::lock_guard lock(instance.leaked_mutex);
+        instance.leaked.insert(instance.leaked.end(), loggers.begin(), loggers.end());
+        loggers.clear();
+        return;
+    }
+
+    for (reader_record* record = state().records.load(std::memory_order_acquire); record != nullptr;
+         record                = record->next) {
+        if (record == self) {
+            continue;
+        }
+
+        // Sections started after the barrier see the new logger, only the current one matters.
+        const framework::uint64 sequence = record->sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) == 0) {
+            continue;
+        }
+
+        if (!wait) {
+            return;
+        }
+
+        while (record->sequence.load(std::memory_order_acquire) == sequence) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Destructors can log, which reclaims the deferred loggers again.
+    std::vector<logger_base*> destroyed;
+    destroyed.swap(loggers);
+
+    for (logger_base* item : destroyed) {
+        delete item;
+    }
+}
+
+/// @brief Read side state adopted by the thread.
+struct thread_reader
 {
-    static std::unique_ptr<logger_base> instance;
+    thread_reader() : record(acquire_record())
+    {}
+
+    ~thread_reader()
+    {
+        reclaim(deferred, record, true);
 
-    if (!instance) {
-        instance = std::make_unique<dummy_logger>();
+        record->active.store(false, std::memory_order_release);
     }
 
+    thread_reader(const thread_reader&) = delete;
+    thread_reader& operator=(const thread_reader&) = delete;
+
+    reader_record* record;
+    framework::usize depth   = 0;       ///< Count of the handles of the thread.
+    logger_base* last_loaded = nullptr; ///< Logger of the newest handle.
+
+    std::vector<logger_base*> deferred; ///< Retired while this thread could use them.
+};
+
+thread_reader& local_reader()
+{
+    thread_local thread_reader instance;
     return instance;
 }
 
@@ -63,41 +303,167 @@ namespace framework::log
 {
 #pragma region log functions
 
-log_ostream debug(const std::string& tag)
+log_ostream debug(std::string_view tag, log_details::source_location location)
 {
-    return log_ostream(std::make_unique<log_buffer>(severity_level::debug, tag));
+    return log_ostream(severity_level::debug, tag, is_enabled(severity_level::debug, tag), location);
 }
 
-log_ostream info(const std::string& tag)
+log_ostream info(std::string_view tag, log_details::source_location location)
 {
-    return log_ostream(std::make_unique<log_buffer>(severity_level::info, tag));
+    return log_ostream(severity_level::info, tag, is_enabled(severity_level::info, tag), location);
 }
 
-log_ostream warning(const std::string& tag)
+log_ostream warning(std::string_view tag, log_details::source_location location)
 {
-    return log_ostream(std::make_unique<log_buffer>(severity_level::warning, tag));
+    return log_ostream(severity_level::warning, tag, is_enabled(severity_level::warning, tag), location);
 }
 
-log_ostream error(const std::string& tag)
+log_ostream error(std::string_view tag, log_details::source_location location)
 {
-    return log_ostream(std::make_unique<log_buffer>(severity_level::error, tag));
+    return log_ostream(severity_level::error, tag, is_enabled(severity_level::error, tag), location);
 }
 
-log_ostream fatal(const std::string& tag)
+log_ostream fatal(std::string_view tag, log_details::source_location location)
 {
-    return log_ostream(std::make_unique<log_buffer>(severity_level::fatal, tag));
+    return log_ostream(severity_level::fatal, tag, is_enabled(severity_level::fatal, tag), location);
 }
 
 #pragma endregion
 
+void set_level(severity_level level)
+{
+    ::filter().level.store(level, std::memory_order_relaxed);
+}
+
+severity_level level()
+{
+    return ::filter().level.load(std::memory_order_relaxed);
+}
+
+void set_tag_level(std::string_view tag, severity_level level)
+{
+    auto& filter = ::filter();
+
+    std::lock_guard lock(filter.writer_mutex);
+
+    const auto* current = filter.tag_levels.load(std::memory_order_relaxed);
+    auto table          = current != nullptr ? *current : level_filter::tag_table{};
+
+    auto it = level_filter::find(table, tag);
+    if (it != table.end() && it->first == tag) {
+        table[static_cast<std::size_t>(it - table.begin())].second = level;
+    } else {
+        table.emplace(it, std::string(tag), level);
+    }
+
+    filter.publish(std::move(table));
+}
+
+void reset_tag_level(std::string_view tag)
+{
+    auto& filter = ::filter();
+
+    std::lock_guard lock(filter.writer_mutex);
+
+    const auto* current = filter.tag_levels.load(std::memory_order_relaxed);
+    if (current == nullptr) {
+        return;
+    }
+
+    auto it = level_filter::find(*current, tag);
+    if (it == current->end() || it->first != tag) {
+        return;
+    }
+
+    auto table = *current;
+    table.erase(table.begin() + (it - current->begin()));
+
+    filter.publish(std::move(table));
+}
+
+bool is_enabled(severity_level level, std::string_view tag)
+{
+    auto& filter = ::filter();
+
+    // Fast path, no tag overrides.
+    const auto* table = filter.tag_levels.load(std::memory_order_acquire);
+    if (table == nullptr) {
+        return level >= filter.level.load(std::memory_order_relaxed);
+    }
+
+    auto it = level_filter::find(*table, tag);
+    if (it != table->end() && it->first == tag) {
+        return level >= it->second;
+    }
+
+    return level >= filter.level.load(std::memory_order_relaxed);
+}
+
 void set_logger(std::unique_ptr<logger_base> implementation)
 {
-    ::logger_instance() = std::move(implementation);
+    logger_base* next     = implementation ? implementation.release() : ::dummy_instance();
+    logger_base* previous = ::state().current.exchange(next);
+
+    if (previous == ::dummy_instance()) {
+        return;
+    }
+
+    auto& reader = ::local_reader();
+
+    // A handle of this thread keeps the logger, the last handle destroys it.
+    if (reader.depth > 0 && reader.last_loaded == previous) {
+        reader.deferred.push_back(previous);
+        return;
+    }
+
+    // Waiting while this thread is in a section could deadlock with another thread doing the same.
+    std::vector<logger_base*> retired{previous};
+    ::reclaim(retired, reader.record, reader.depth == 0);
+
+    reader.deferred.insert(reader.deferred.end(), retired.begin(), retired.end());
+}
+
+log_details::logger_handle logger()
+{
+    return log_details::logger_handle();
 }
 
-logger_base* logger()
+namespace log_details
 {
-    return ::logger_instance().get();
+logger_handle::logger_handle()
+{
+    auto& reader = ::local_reader();
+
+    if (reader.depth++ == 0) {
+        auto& sequence = reader.record->sequence;
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+#if defined(__linux__) || defined(_WIN32)
+        // The writers make the mark visible with the process barrier.
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#else
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    m_logger           = ::state().current.load(std::memory_order_acquire);
+    reader.last_loaded = m_logger;
+}
+
+logger_handle::~logger_handle()
+{
+    auto& reader = ::local_reader();
+
+    if (--reader.depth == 0) {
+        auto& sequence = reader.record->sequence;
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+        if (!reader.deferred.empty()) {
+            ::reclaim(reader.deferred, reader.record, true);
+        }
+    }
 }
 
+} // namespace log_details
+
 } // namespace framework::log
@@ -31,7 +31,7 @@
 #define FRAMEWORK_LOG_LOG_HPP
 
 #include <memory>
-#include <string>
+#include <string_view>
 
 #include <log/log_details.hpp>
 #include <log/logger.hpp>
@@ -50,6 +50,13 @@
 /// log::warning("log_tag") << "message_3" << std::endl;
 /// @endcode
 ///
+/// `format` writes arguments straight into the message buffer without the stream machinery,@n
+/// see `::framework::utils::format` for the syntax. `FRAMEWORK_FORMAT_STRING` checks the format at compile time.@n
+/// @code
+/// log::info("log_tag").format("{}: {:.3f}", name, value);
+/// FRAMEWORK_LOG_INFO("log_tag").format(FRAMEWORK_FORMAT_STRING("{} frames in {} ms"), frames, time);
+/// @endcode
+///
 /// By default there is no logger implementation, so no messages would be logged.@n
 /// You need to set logger by calling `::framework::log::set_logger` function.@n
 /// Provided logger should be derived from the `::framework::log::logger_base` class.@n
@@ -74,6 +81,53 @@
 /// set_logger(std::make_unique<stream_logger>(log_stream));
 /// @endcode
 ///
+/// `::framework::log::file_logger` writes messages to a file with buffered output and rotation.@n
+/// @code
+/// set_logger(std::make_unique<file_logger>("application.log"));
+/// @endcode
+///
+/// To keep output off the calling threads wrap a logger into `::framework::log::async_logger`.@n
+/// @code
+/// set_logger(std::make_unique<async_logger>(std::make_unique<stream_logger>(log_stream)));
+/// @endcode
+///
+/// To send messages to several loggers with their own filters use `::framework::log::tee_logger`.@n
+/// @code
+/// auto logger = std::make_unique<tee_logger>();
+/// logger->add_sink(std::make_unique<file_logger>("errors.log"), severity_level::error);
+/// logger->add_sink(std::make_unique<stream_logger>(std::cerr), severity_level::debug, {"renderer"});
+/// set_logger(std::move(logger));
+/// @endcode
+///
+/// `::framework::log::ring_logger` keeps the last messages in memory and dumps them on a crash.@n
+/// @code
+/// auto ring = std::make_unique<ring_logger>();
+/// ring->install_crash_handler();
+/// @endcode
+///
+/// To keep noisy call sites from flooding the log wrap a logger into `::framework::log::rate_limited_logger`.@n
+/// @code
+/// set_logger(std::make_unique<rate_limited_logger>(std::make_unique<stream_logger>(log_stream)));
+/// @endcode
+///
+/// To take the logger lock once per several messages wrap it into `::framework::log::batching_logger`.@n
+/// @code
+/// set_logger(std::make_unique<batching_logger>(std::make_unique<stream_logger>(log_stream)));
+/// @endcode
+///
+/// Messages below the current level are discarded before anything is formatted.@n
+/// The level can be set globally and overridden for separate tags.@n
+/// @code
+/// set_level(severity_level::warning);
+/// set_tag_level("renderer", severity_level::debug);
+/// @endcode
+///
+/// The logging macros additionally remove levels below `FRAMEWORK_LOG_MIN_LEVEL` at compile time,@n
+/// so such statements cost nothing. By default, debug messages are removed if `NDEBUG` is defined.@n
+/// @code
+/// FRAMEWORK_LOG_DEBUG("log_tag") << "message_4" << std::endl;
+/// @endcode
+///
 /// @defgroup log_module Logging
 /// @{
 
@@ -89,51 +143,91 @@ namespace framework::log
 
 /// @brief Logs messages for debugging purposes.
 ///
-/// @param tag Message tag.
+/// @param tag Message tag, should outlive the returned stream.
+/// @param location Source location of the statement, filled by the logging macros.
 ///
 /// @return Output stream to log debug messages.
 ///
 /// @see logger_base::add_message
-log_details::log_ostream debug(const std::string& tag);
+log_details::log_ostream debug(std::string_view tag, log_details::source_location location = {});
 
 /// @brief Logs information messages.
 ///
-/// @param tag Message tag.
+/// @param tag Message tag, should outlive the returned stream.
+/// @param location Source location of the statement, filled by the logging macros.
 ///
 /// @return Output stream to log info messages.
 ///
 /// @see logger_base::add_message
-log_details::log_ostream info(const std::string& tag);
+log_details::log_ostream info(std::string_view tag, log_details::source_location location = {});
 
 /// @brief Logs warning messages.
 ///
-/// @param tag Message tag.
+/// @param tag Message tag, should outlive the returned stream.
+/// @param location Source location of the statement, filled by the logging macros.
 ///
 /// @return Output stream to log warning messages.
 ///
 /// @see logger_base::add_message
-log_details::log_ostream warning(const std::string& tag);
+log_details::log_ostream warning(std::string_view tag, log_details::source_location location = {});
 
 /// @brief Logs error messages.
 ///
-/// @param tag Message tag.
+/// @param tag Message tag, should outlive the returned stream.
+/// @param location Source location of the statement, filled by the logging macros.
 ///
 /// @return Output stream to log error messages.
 ///
 /// @see logger_base::add_message
-log_details::log_ostream error(const std::string& tag);
+log_details::log_ostream error(std::string_view tag, log_details::source_location location = {});
 
 /// @brief Logs fatal error messages.
 ///
-/// @param tag Message tag.
+/// @param tag Message tag, should outlive the returned stream.
+/// @param location Source location of the statement, filled by the logging macros.
 ///
 /// @return Output stream to log fatal error messages.
 ///
 /// @see logger_base::add_message
-log_details::log_ostream fatal(const std::string& tag);
+log_details::log_ostream fatal(std::string_view tag, log_details::source_location location = {});
+
+/// @brief Sets minimum severity level of logged messages.
+///
+/// @param level New minimum level.
+///
+/// @note Default level is @ref severity_level::debug, use `FRAMEWORK_LOG_MIN_LEVEL` to strip messages at compile time.
+void set_level(severity_level level);
+
+/// @brief Returns minimum severity level of logged messages.
+///
+/// @return Current minimum level.
+severity_level level();
+
+/// @brief Overrides minimum severity level for the tag.
+///
+/// @param tag Message tag.
+/// @param level New minimum level for the tag.
+void set_tag_level(std::string_view tag, severity_level level);
+
+/// @brief Removes minimum severity level override for the tag.
+///
+/// @param tag Message tag.
+void reset_tag_level(std::string_view tag);
+
+/// @brief Checks if messages with the level and the tag are logged.
+///
+/// @param level The message @ref severity_level
+/// @param tag Message tag.
+///
+/// @return `true` if messages are passed to the logger.
+bool is_enabled(severity_level level, std::string_view tag);
 
 /// @brief Sets new logger.
 ///
+/// Safe to call while other threads log. Waits until the other threads stop using@n
+/// the previous logger and destroys it. If the calling thread holds a handle of the logger,@n
+/// the logger is destroyed when the last handle of the thread is released.
+///
 /// @param implementation Pointer to a new logger.
 ///
 /// @see logger_base
@@ -141,15 +235,84 @@ void set_logger(std::unique_ptr<logger_base> implementation);
 
 /// @brief Returns current logger instance.
 ///
-/// @return Pointer to current logger instance or base logger if no logger is set.
+/// The logger stays alive while the returned handle exists, so it can be used@n
+/// directly in an expression like `logger()->flush()`. Don't wait for other threads@n
+/// while holding the handle, `set_logger` of another thread waits for it.
+///
+/// @return Handle of current logger instance or base logger if no logger is set.
 ///
 /// @see logger_base
-logger_base* logger();
+log_details::logger_handle logger();
 
 /// @}
 
 } // namespace framework::log
 
+/// @addtogroup log_interface_functions
+/// @{
+
+#ifndef FRAMEWORK_LOG_MIN_LEVEL
+#ifdef NDEBUG
+/// @brief Minimum level of the logging macros, 0 is debug and 4 is fatal.
+#define FRAMEWORK_LOG_MIN_LEVEL 1
+#else
+/// @brief Minimum level of the logging macros, 0 is debug and 4 is fatal.
+#define FRAMEWORK_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+/// @brief Logs message with its location if the level is enabled at runtime, the tag can be evaluated twice.
+///
+/// Each statement keeps a @ref log_details::call_site_state, so loggers find its state without a lookup.
+#define FRAMEWORK_LOG_ENABLED(level, tag)                                                                  \
+    static_cast<void>(0),                                                                                  \
+    !::framework::log::is_enabled(::framework::log::severity_level::level, tag)                            \
+    ? static_cast<void>(0)                                                                                 \
+    : ::framework::log::log_details::voidify() &                                                           \
+      ::framework::log::level(tag, {__FILE__, __LINE__, ::framework::log::log_details::site_state([] {})})
+
+/// @brief Compiles the statement, but never executes it.
+#define FRAMEWORK_LOG_DISABLED(level, tag)                                                                \
+    static_cast<void>(0),                                                                                 \
+    true ? static_cast<void>(0) : ::framework::log::log_details::voidify() & ::framework::log::level(tag)
+
+#if FRAMEWORK_LOG_MIN_LEVEL <= 0
+/// @brief Logs debug message, see @ref framework::log::debug.
+#define FRAMEWORK_LOG_DEBUG(tag) FRAMEWORK_LOG_ENABLED(debug, tag)
+#else
+#define FRAMEWORK_LOG_DEBUG(tag) FRAMEWORK_LOG_DISABLED(debug, tag)
+#endif
+
+#if FRAMEWORK_LOG_MIN_LEVEL <= 1
+/// @brief Logs info message, see @ref framework::log::info.
+#define FRAMEWORK_LOG_INFO(tag) FRAMEWORK_LOG_ENABLED(info, tag)
+#else
+#define FRAMEWORK_LOG_INFO(tag) FRAMEWORK_LOG_DISABLED(info, tag)
+#endif
+
+#if FRAMEWORK_LOG_MIN_LEVEL <= 2
+/// @brief Logs warning message, see @ref framework::log::warning.
+#define FRAMEWORK_LOG_WARNING(tag) FRAMEWORK_LOG_ENABLED(warning, tag)
+#else
+#define FRAMEWORK_LOG_WARNING(tag) FRAMEWORK_LOG_DISABLED(warning, tag)
+#endif
+
+#if FRAMEWORK_LOG_MIN_LEVEL <= 3
+/// @brief Logs error message, see @ref framework::log::error.
+#define FRAMEWORK_LOG_ERROR(tag) FRAMEWORK_LOG_ENABLED(error, tag)
+#else
+#define FRAMEWORK_LOG_ERROR(tag) FRAMEWORK_LOG_DISABLED(error, tag)
+#endif
+
+#if FRAMEWORK_LOG_MIN_LEVEL <= 4
+/// @brief Logs fatal message, see @ref framework::log::fatal.
+#define FRAMEWORK_LOG_FATAL(tag) FRAMEWORK_LOG_ENABLED(fatal, tag)
+#else
+#define FRAMEWORK_LOG_FATAL(tag) FRAMEWORK_LOG_DISABLED(fatal, tag)
+#endif
+
+/// @}
+
 /// @}
 
 #endif
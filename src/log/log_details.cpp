@@ -27,12 +27,91 @@
 // SOFTWARE.
 // =============================================================================
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+
 #include <log/log.hpp>
 #include <log/log_details.hpp>
 
 namespace
 {
-constexpr size_t log_buffer_size = 64;
+/// @brief Reusable storage for long messages.
+struct thread_storage
+{
+    std::vector<char> buffer;
+    bool in_use = false;
+};
+
+thread_local thread_storage spill_storage;
+
+std::atomic<framework::uint32> threads_count{0};
+
+constexpr std::chrono::milliseconds calibration_period{20};
+
+/// @brief First point of the timestamp calibration.
+struct calibration_start
+{
+    calibration_start() noexcept
+        : time(std::chrono::steady_clock::now()), ticks(framework::log::log_details::timestamp_ticks())
+    {}
+
+    std::chrono::steady_clock::time_point time;
+    framework::uint64 ticks;
+};
+
+const calibration_start& start_sample()
+{
+    static const calibration_start instance;
+    return instance;
+}
+
+// Takes the first point when the library is loaded, so the calibration usually doesn't wait.
+[[maybe_unused]] const bool start_sampled = (start_sample(), true);
+
+/// @brief Measures the tick duration on the interval since the library was loaded.
+framework::log::log_details::tick_calibration measure_calibration() noexcept
+{
+    using framework::float64;
+    using framework::uint64;
+    using framework::log::log_details::timestamp_ticks;
+    using std::chrono::steady_clock;
+    using std::chrono::system_clock;
+
+    framework::log::log_details::tick_calibration result{};
+
+#if defined(FRAMEWORK_LOG_TSC)
+    const auto& start     = start_sample();
+    const auto stop_time  = steady_clock::now();
+    const auto stop_ticks = timestamp_ticks();
+
+    const auto nanoseconds = std::chrono::duration<float64, std::nano>(stop_time - start.time).count();
+
+    const bool measured         = stop_ticks > start.ticks && nanoseconds > 0.0;
+    result.nanoseconds_per_tick = measured ? nanoseconds / static_cast<float64>(stop_ticks - start.ticks) : 1.0;
+#else
+    // The ticks are the steady clock ticks.
+    result.nanoseconds_per_tick = std::chrono::duration<float64, std::nano>(steady_clock::duration(1)).count();
+#endif
+
+    result.ticks       = timestamp_ticks();
+    result.nanoseconds = static_cast<uint64>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(system_clock::now().time_since_epoch()).count());
+
+    return result;
+}
+
+/// @brief Creates formatter output that writes into the stream buffer.
+framework::utils::format_details::format_sink buffer_sink(std::streambuf& buffer) noexcept
+{
+    return {&buffer, [](void* context, const char* data, framework::usize size) {
+                static_cast<std::streambuf*>(context)->sputn(data, static_cast<std::streamsize>(size));
+            }};
+}
 
 } // namespace
 
@@ -40,8 +119,8 @@ namespace framework::log::log_details
 {
 #pragma region log_buffer
 
-log_buffer::log_buffer(severity_level level, std::string tag)
-    : m_level(level), m_tag(std::move(tag)), m_buffer(log_buffer_size)
+log_buffer::log_buffer(severity_level level, std::string_view tag, source_location location)
+    : m_level(level), m_tag(tag), m_location(location)
 {
     reset_pointers();
 }
@@ -49,19 +128,29 @@ log_buffer::log_buffer(severity_level level, std::string tag)
 log_buffer::~log_buffer()
 {
     flush_buffer();
+    release_storage();
 }
 
 log_buffer::log_buffer(log_buffer&& other) noexcept
-    : std::streambuf(other), m_level(other.m_level), m_tag(std::move(other.m_tag)), m_buffer(std::move(other.m_buffer))
-{}
+    : std::streambuf(other), m_level(other.m_level), m_tag(other.m_tag), m_location(other.m_location)
+{
+    move_from(other);
+}
 
 log_buffer& log_buffer::operator=(log_buffer&& other) noexcept
 {
-    std::streambuf::operator=(other);
+    if (this != &other) {
+        flush_buffer();
+        release_storage();
 
-    m_level  = other.m_level;
-    m_tag    = std::move(other.m_tag);
-    m_buffer = std::move(other.m_buffer);
+        std::streambuf::operator=(other);
+
+        m_level    = other.m_level;
+        m_tag      = other.m_tag;
+        m_location = other.m_location;
+
+        move_from(other);
+    }
 
     return *this;
 }
@@ -72,8 +161,24 @@ int log_buffer::overflow(int character)
         return traits_type::eof();
     }
 
-    const size_t size = m_buffer.size();
-    m_buffer.resize(size * 2);
+    const auto size = static_cast<size_t>(pptr() - pbase());
+
+    if (m_storage == nullptr) {
+        if (!spill_storage.in_use) {
+            spill_storage.in_use = true;
+
+            m_storage        = &spill_storage.buffer;
+            m_thread_storage = true;
+        } else {
+            m_storage = &m_fallback;
+        }
+
+        m_storage->resize(std::max(m_storage->capacity(), inline_size * 2));
+        std::memcpy(m_storage->data(), m_inline.data(), size);
+    } else {
+        m_storage->resize(m_storage->size() * 2);
+    }
+
     reset_pointers();
     pbump(static_cast<int>(size));
 
@@ -89,9 +194,19 @@ int log_buffer::sync()
     return 0;
 }
 
+log_buffer::char_type* log_buffer::data() noexcept
+{
+    return m_storage != nullptr ? m_storage->data() : m_inline.data();
+}
+
+size_t log_buffer::capacity() const noexcept
+{
+    return m_storage != nullptr ? m_storage->size() : m_inline.size();
+}
+
 void log_buffer::reset_pointers()
 {
-    setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+    setp(data(), data() + capacity());
 }
 
 void log_buffer::flush_buffer()
@@ -101,30 +216,189 @@ void log_buffer::flush_buffer()
     }
 
     const auto size = static_cast<size_t>(pptr() - pbase());
-    ::framework::log::logger()->add_message(m_level, m_tag, std::string(m_buffer.data(), size));
+
+    record item = make_record(m_level, m_tag, std::string_view(pbase(), size));
+    item.file   = m_location.file;
+    item.line   = m_location.line;
+    item.site   = m_location.site;
+
+    ::framework::log::logger()->add_message(item);
+}
+
+void log_buffer::release_storage() noexcept
+{
+    if (m_thread_storage) {
+        spill_storage.in_use = false;
+    }
+
+    m_storage        = nullptr;
+    m_thread_storage = false;
+}
+
+void log_buffer::move_from(log_buffer& other) noexcept
+{
+    const auto size = static_cast<size_t>(other.pptr() - other.pbase());
+
+    if (other.m_storage == nullptr) {
+        std::memcpy(m_inline.data(), other.m_inline.data(), size);
+    } else if (other.m_thread_storage) {
+        m_storage        = other.m_storage;
+        m_thread_storage = true;
+    } else {
+        m_fallback = std::move(other.m_fallback);
+        m_storage  = &m_fallback;
+    }
+
+    other.m_storage        = nullptr;
+    other.m_thread_storage = false;
+    other.reset_pointers();
+
+    reset_pointers();
+    pbump(static_cast<int>(size));
 }
 
 #pragma endregion
 
-log_ostream::log_ostream(std::unique_ptr<std::streambuf> buffer)
-    : std::ostream(buffer.get()), m_buffer(std::move(buffer))
-{}
+log_ostream::log_ostream(severity_level level, std::string_view tag, bool enabled, source_location location)
+    : std::ostream(nullptr), m_buffer(level, tag, location)
+{
+    if (enabled) {
+        rdbuf(&m_buffer);
+    }
+}
 
 log_ostream::~log_ostream() = default;
 
-log_ostream::log_ostream(log_ostream&& other) noexcept
-    : std::ostream(other.m_buffer.get()), m_buffer(std::move(other.m_buffer))
+log_ostream::log_ostream(log_ostream&& other) noexcept : std::ostream(nullptr), m_buffer(std::move(other.m_buffer))
 {
-    rdbuf(m_buffer.get());
+    if (other.rdbuf() != nullptr) {
+        rdbuf(&m_buffer);
+    }
 }
 
 log_ostream& log_ostream::operator=(log_ostream&& other) noexcept
 {
+    const bool enabled = other.rdbuf() != nullptr;
+
     m_buffer = std::move(other.m_buffer);
 
     std::ostream::operator=(std::move(other));
 
+    rdbuf(enabled ? &m_buffer : nullptr);
+
     return *this;
 }
 
+void log_ostream::write_format(std::string_view format_string, const utils::format_details::format_arg* args, usize count)
+{
+    const auto out = buffer_sink(m_buffer);
+
+    try {
+        utils::format_details::vformat_to(out, format_string, args, count);
+    } catch (const utils::format_error& error) {
+        out.append("[format error: ");
+        out.append(error.what());
+        out.append("]");
+    }
+}
+
+void log_ostream::write_format(const utils::format_details::format_segment* segments,
+                               usize count,
+                               const utils::format_details::format_arg* args)
+{
+    utils::format_details::vformat_to(buffer_sink(m_buffer), segments, count, args);
+}
+
+const tick_calibration& calibration()
+{
+    struct calibration_state
+    {
+        std::once_flag estimate_flag;
+        std::once_flag final_flag;
+        std::atomic<bool> final_ready{false};
+        tick_calibration estimate{};
+        tick_calibration final{};
+    };
+
+    static calibration_state state;
+
+    if (state.final_ready.load(std::memory_order_acquire)) {
+        return state.final;
+    }
+
+    // Nothing waits for the calibration period, calls during it get an estimate from the shorter interval.
+    if (std::chrono::steady_clock::now() - start_sample().time >= calibration_period) {
+        std::call_once(state.final_flag, []() {
+            state.final = measure_calibration();
+            state.final_ready.store(true, std::memory_order_release);
+        });
+
+        return state.final;
+    }
+
+    std::call_once(state.estimate_flag, []() { state.estimate = measure_calibration(); });
+
+    return state.estimate;
+}
+
+uint32 thread_index() noexcept
+{
+    thread_local const uint32 index = threads_count.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+uint64 to_nanoseconds(uint64 ticks)
+{
+    const tick_calibration& base = calibration();
+
+    const auto delta = static_cast<float64>(static_cast<int64>(ticks - base.ticks)) * base.nanoseconds_per_tick;
+    return base.nanoseconds + static_cast<uint64>(static_cast<int64>(delta));
+}
+
+record make_record(severity_level level, std::string_view tag, std::string_view message) noexcept
+{
+    return record{level, tag, message, timestamp_ticks(), thread_index()};
+}
+
+std::string_view timestamp_formatter::format(uint64 ticks)
+{
+    const uint64 nanoseconds = to_nanoseconds(ticks);
+    const uint64 second      = nanoseconds / 1000000000;
+
+    if (second != m_second) {
+        m_second = second;
+
+        const auto time = static_cast<std::time_t>(second);
+
+        std::tm date{};
+#if defined(_WIN32)
+        gmtime_s(&date, &time);
+#else
+        gmtime_r(&time, &date);
+#endif
+
+        // Years after 9999 are cut, the text length never changes.
+        std::array<char, 64> text{};
+        std::snprintf(text.data(),
+                      text.size(),
+                      "%04d-%02d-%02d %02d:%02d:%02d.",
+                      date.tm_year + 1900,
+                      date.tm_mon + 1,
+                      date.tm_mday,
+                      date.tm_hour,
+                      date.tm_min,
+                      date.tm_sec);
+
+        std::memcpy(m_text.data(), text.data(), size - 6);
+    }
+
+    auto microseconds = static_cast<uint32>(nanoseconds % 1000000000 / 1000);
+    for (usize i = size; i > size - 6; --i) {
+        m_text[i - 1] = static_cast<char>('0' + microseconds % 10);
+        microseconds /= 10;
+    }
+
+    return std::string_view(m_text.data(), m_text.size());
+}
+
 } // namespace framework::log::log_details
@@ -30,23 +30,64 @@
 #ifndef FRAMEWORK_LOG_LOG_DETAILS_HPP
 #define FRAMEWORK_LOG_LOG_DETAILS_HPP
 
-#include <memory>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
-namespace framework::log
+#include <common/types.hpp>
+#include <common/utils.hpp>
+#include <log/logger.hpp>
+
+// GCC and Clang provide the time stamp counter as a builtin, so only MSVC needs the intrinsics header.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FRAMEWORK_LOG_TSC() __builtin_ia32_rdtsc()
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define FRAMEWORK_LOG_TSC() __rdtsc()
+#endif
+
+namespace framework::log::log_details
+{
+/// @brief State that loggers keep in the logging statement, so they don't look it up by the location.
+struct call_site_state
 {
-enum class severity_level;
+    /// Tick until which @ref rate_limited_logger drops the messages, tagged with the logger serial.
+    std::atomic<uint64> suppressed_until{0};
+};
+
+/// @brief Returns the state of the logging statement, each lambda type gets its own instance.
+///
+/// @return Call site state.
+template <typename Site>
+inline call_site_state* site_state(Site /*site*/) noexcept
+{
+    static call_site_state state;
+    return &state;
 }
 
-namespace framework::log::log_details
+/// @brief Source location of the logging statement.
+struct source_location
 {
+    const char* file      = nullptr; ///< Source file name, null if unknown.
+    uint32 line           = 0;       ///< Source line, zero if unknown.
+    call_site_state* site = nullptr; ///< State of the statement, null if unknown.
+};
+
 /// @brief Custom stream buffer
+///
+/// Short messages are kept in the inline storage. Longer messages spill into a thread-local
+/// buffer that keeps its capacity between messages, so logging does not allocate memory@n
+/// after the first long message on the thread.
 class log_buffer : public std::streambuf
 {
 public:
-    log_buffer(severity_level level, std::string tag);
+    log_buffer(severity_level level, std::string_view tag, source_location location = {});
 
     ~log_buffer() override;
 
@@ -61,19 +102,33 @@ protected:
     int sync() override;
 
 private:
+    static constexpr size_t inline_size = 256;
+
     severity_level m_level;
-    std::string m_tag;
-    std::vector<char_type> m_buffer;
+    std::string_view m_tag;
+    source_location m_location;
+    std::array<char_type, inline_size> m_inline{};
+    std::vector<char_type>* m_storage = nullptr;
+    std::vector<char_type> m_fallback;
+    bool m_thread_storage = false;
+
+    char_type* data() noexcept;
+    size_t capacity() const noexcept;
 
     void reset_pointers();
     void flush_buffer();
+    void release_storage() noexcept;
+    void move_from(log_buffer& other) noexcept;
 };
 
 /// @brief Custom output stream
+///
+/// The tag is not copied, it should outlive the stream.@n
+/// Disabled stream has no buffer attached, so output operators do not format anything.
 class log_ostream : public std::ostream
 {
 public:
-    explicit log_ostream(std::unique_ptr<std::streambuf> buffer);
+    log_ostream(severity_level level, std::string_view tag, bool enabled = true, source_location location = {});
 
     ~log_ostream() override;
 
@@ -83,10 +138,226 @@ public:
     log_ostream(log_ostream&& other) noexcept;
     log_ostream& operator=(log_ostream&& other) noexcept;
 
+    /// @brief Formats arguments directly into the message, see @ref utils::format.
+    ///
+    /// Invalid format string does not throw, the error description is logged instead.
+    ///
+    /// @param format_string Format string.
+    /// @param args Arguments.
+    ///
+    /// @return Reference to this stream.
+    template <typename... Args>
+    log_ostream& format(std::string_view format_string, const Args&... args);
+
+    /// @brief Formats arguments directly into the message using format string checked at compile time.
+    ///
+    /// @param format_string Format string created by @ref FRAMEWORK_FORMAT_STRING.
+    /// @param args Arguments.
+    ///
+    /// @return Reference to this stream.
+    template <typename S, typename... Args, std::enable_if_t<utils::format_details::is_compile_string_v<S>, int> = 0>
+    log_ostream& format(S format_string, const Args&... args);
+
 private:
-    std::unique_ptr<std::streambuf> m_buffer;
+    log_buffer m_buffer;
+
+    void write_format(std::string_view format_string, const utils::format_details::format_arg* args, usize count);
+    void write_format(const utils::format_details::format_segment* segments,
+                      usize count,
+                      const utils::format_details::format_arg* args);
 };
 
+/// @brief Keeps the current logger alive while it is used.
+///
+/// The outermost handle of a thread marks a read section in the thread record, then the logger@n
+/// is a single acquire load. `set_logger` waits for the sections that could see the previous@n
+/// logger and destroys it, a logger used by the calling thread is destroyed by its last handle.@n
+/// Handles can be released in any order by the thread that created them, the handle can't be moved.
+class logger_handle
+{
+public:
+    /// @brief Protects the current logger.
+    logger_handle();
+
+    /// @brief Releases the logger.
+    ~logger_handle();
+
+    logger_handle(const logger_handle&) = delete;
+    logger_handle& operator=(const logger_handle&) = delete;
+
+    logger_handle(logger_handle&&) = delete;
+    logger_handle& operator=(logger_handle&&) = delete;
+
+    /// @brief Returns the protected logger.
+    ///
+    /// @return Pointer to the logger.
+    logger_base* get() const noexcept
+    {
+        return m_logger;
+    }
+
+    /// @brief Accesses the protected logger.
+    ///
+    /// @return Pointer to the logger.
+    logger_base* operator->() const noexcept
+    {
+        return m_logger;
+    }
+
+    /// @brief Accesses the protected logger.
+    ///
+    /// @return Reference to the logger.
+    logger_base& operator*() const noexcept
+    {
+        return *m_logger;
+    }
+
+private:
+    logger_base* m_logger = nullptr;
+};
+
+/// @brief Relation between @ref timestamp_ticks and the system clock.
+struct tick_calibration
+{
+    uint64 ticks;                 ///< Ticks at the calibration moment.
+    uint64 nanoseconds;           ///< System clock nanoseconds since epoch at the calibration moment.
+    float64 nanoseconds_per_tick; ///< Tick duration.
+};
+
+/// @brief Returns cheap monotonic timestamp.
+///
+/// Uses the time stamp counter if available, use @ref calibration to convert it to time.
+///
+/// @return Timestamp ticks.
+inline uint64 timestamp_ticks() noexcept
+{
+#if defined(FRAMEWORK_LOG_TSC)
+    return FRAMEWORK_LOG_TSC();
+#else
+    return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// @brief Returns timestamp calibration, it never waits.
+///
+/// The measurement starts when the library is loaded. Calls during the first 20 ms get@n
+/// an estimate from the shorter interval, the first later call measures the final value once.
+///
+/// @return Calibration data.
+const tick_calibration& calibration();
+
+/// @brief Returns small sequential index of the calling thread.
+///
+/// @return Thread index, starting from zero.
+uint32 thread_index() noexcept;
+
+/// @brief Converts timestamp ticks to the system time.
+///
+/// @param ticks Timestamp ticks.
+///
+/// @return Nanoseconds since epoch.
+uint64 to_nanoseconds(uint64 ticks);
+
+/// @brief Creates record stamped with the current time and the calling thread.
+///
+/// @param level The message @ref severity_level
+/// @param tag Message tag.
+/// @param message Message itself.
+///
+/// @return Message record.
+record make_record(severity_level level, std::string_view tag, std::string_view message) noexcept;
+
+/// @brief Calculates fast string hash for the lookup tables of the loggers.
+///
+/// @param value The string.
+///
+/// @return Non zero hash value.
+inline uint64 string_hash(std::string_view value) noexcept
+{
+    constexpr uint64 multiplier = 0x9E3779B97F4A7C15;
+
+    // Processes eight characters at a time, the strings are hashed on every log call.
+    uint64 hash = 0xcbf29ce484222325 ^ value.size();
+
+    usize offset = 0;
+    for (; offset + sizeof(uint64) <= value.size(); offset += sizeof(uint64)) {
+        uint64 chunk = 0;
+        std::memcpy(&chunk, value.data() + offset, sizeof(uint64));
+        hash = (hash ^ chunk) * multiplier;
+        hash ^= hash >> 32;
+    }
+
+    // Empty views may have null data, which memcpy doesn't accept even for zero size.
+    uint64 tail = 0;
+    if (offset < value.size()) {
+        std::memcpy(&tail, value.data() + offset, value.size() - offset);
+    }
+
+    hash = (hash ^ tail) * multiplier;
+    hash ^= hash >> 32;
+
+    return hash != 0 ? hash : 1;
+}
+
+/// @brief Formats timestamps as `YYYY-MM-DD HH:MM:SS.uuuuuu` in UTC.
+///
+/// The date and time part is formatted once per second, so consecutive messages@n
+/// only update the microseconds.
+class timestamp_formatter
+{
+public:
+    /// @brief Formatted timestamp length.
+    static constexpr usize size = 26;
+
+    /// @brief Formats the timestamp.
+    ///
+    /// @param ticks Timestamp ticks.
+    ///
+    /// @return Formatted timestamp, valid until the next call.
+    std::string_view format(uint64 ticks);
+
+private:
+    uint64 m_second = ~uint64{0};
+    std::array<char, size> m_text{};
+};
+
+/// @brief Helper to turn a stream expression into `void` in the logging macros.
+struct voidify
+{
+    void operator&(const std::ostream& /*unused*/) const noexcept
+    {}
+};
+
+#pragma region definitions
+
+template <typename... Args>
+log_ostream& log_ostream::format(std::string_view format_string, const Args&... args)
+{
+    if (rdbuf() != nullptr) {
+        const utils::format_details::format_arg values[] = {utils::format_details::make_arg(args)..., {}};
+        write_format(format_string, values, sizeof...(Args));
+    }
+
+    return *this;
+}
+
+template <typename S, typename... Args, std::enable_if_t<utils::format_details::is_compile_string_v<S>, int>>
+log_ostream& log_ostream::format(S /*format_string*/, const Args&... args)
+{
+    static_assert(utils::format_details::check_format<Args...>(S::value()), "Invalid format string.");
+
+    using compiled = utils::format_details::compiled_format<S>;
+
+    if (rdbuf() != nullptr) {
+        const utils::format_details::format_arg values[] = {utils::format_details::make_arg(args)..., {}};
+        write_format(compiled::segments.data(), compiled::size, values);
+    }
+
+    return *this;
+}
+
+#pragma endregion
+
 } // namespace framework::log::log_details
 
 #endif
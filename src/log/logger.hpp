@@ -30,8 +30,12 @@
 #ifndef FRAMEWORK_LOG_LOGGER_HPP
 #define FRAMEWORK_LOG_LOGGER_HPP
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
+
+#include <common/types.hpp>
 
 namespace framework::log
 {
@@ -48,6 +52,28 @@ enum class severity_level
     fatal    ///< An unhandleable error that results in a program crash.
 };
 
+namespace log_details
+{
+struct call_site_state;
+} // namespace log_details
+
+/// @brief Log message with the context of its call site.
+///
+/// The timestamp is in ticks of `log_details::timestamp_ticks`, loggers convert it to time@n
+/// only when they output it.
+struct record
+{
+    severity_level level;     ///< The message @ref severity_level
+    std::string_view tag;     ///< Message tag. Describes message domain.
+    std::string_view message; ///< Message itself.
+    uint64 timestamp = 0;       ///< Timestamp ticks taken at the call site.
+    uint32 thread    = 0;       ///< Index of the thread that logged the message.
+    const char* file = nullptr; ///< Source file name, null if unknown.
+    uint32 line      = 0;       ///< Source line, zero if unknown.
+
+    log_details::call_site_state* site = nullptr; ///< State kept in the logging statement, null if unknown.
+};
+
 /// @brief Base class for logger implementations.
 ///
 /// Describes logger implementation methods.
@@ -83,8 +109,70 @@ public:
     /// @param tag Message tag. Describes message domain.
     /// @param message Message itself.
     virtual void add_message(severity_level level, const std::string& tag, const std::string& message) = 0;
+
+    /// @brief Add message to the log without copying it.
+    ///
+    /// In base implementation, copies the tag and the message and calls the `std::string`@n
+    /// overload. Override it to avoid memory allocations on the logging path.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    virtual void add_message(severity_level level, std::string_view tag, std::string_view message)
+    {
+        add_message(level, std::string(tag), std::string(message));
+    }
+
+    /// @brief Add message with its call site context to the log.
+    ///
+    /// Called by the logging interface functions. In base implementation, calls@n
+    /// the `std::string_view` overload, so the timestamp, thread and location are ignored.
+    ///
+    /// @param item Message record.
+    virtual void add_message(const record& item)
+    {
+        add_message(item.level, item.tag, item.message);
+    }
+
+    /// @brief Add several messages to the log.
+    ///
+    /// In base implementation, calls @ref add_message for each record. Override it@n
+    /// to write the whole batch under a single lock or with a single system call.
+    ///
+    /// @param records Pointer to the first record.
+    /// @param count Records count.
+    virtual void add_messages(const record* records, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            add_message(records[i]);
+        }
+    }
+
+    /// @brief Writes all buffered messages.
+    ///
+    /// In base implementation, does nothing
+    virtual void flush()
+    {}
 };
 
+/// @brief Returns severity level name.
+///
+/// @param level Severity level.
+///
+/// @return Lowercase level name, the same as printed into the stream.
+constexpr std::string_view level_name(severity_level level) noexcept
+{
+    switch (level) {
+        case severity_level::debug: return "debug";
+        case severity_level::info: return "info";
+        case severity_level::warning: return "warning";
+        case severity_level::error: return "error";
+        case severity_level::fatal: return "fatal";
+    }
+
+    return "";
+}
+
 /// @brief Helper function to print severity level name into the stream.
 ///
 /// @param ostream Output stream.
@@ -94,14 +182,7 @@ public:
 template <typename T>
 inline T& operator<<(T& ostream, severity_level level)
 {
-    switch (level) {
-        case severity_level::debug: ostream << "debug"; break;
-        case severity_level::info: ostream << "info"; break;
-        case severity_level::warning: ostream << "warning"; break;
-        case severity_level::error: ostream << "error"; break;
-        case severity_level::fatal: ostream << "fatal"; break;
-    }
-
+    ostream << level_name(level);
     return ostream;
 }
 /// @}
@@ -0,0 +1,291 @@
+/// @file
+/// @brief Rate limited logger implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+
+#include <log/log_details.hpp>
+#include <log/rate_limited_logger.hpp>
+
+namespace
+{
+using framework::uint64;
+using framework::usize;
+
+constexpr usize max_probes = 16;
+
+/// Low bits of the cached suppression tick hold the logger serial.
+constexpr uint64 serial_mask = 0xFFFF;
+
+std::atomic<uint64> loggers_count{0};
+
+uint64 call_site_key(const framework::log::record& item) noexcept
+{
+    uint64 key = 0;
+
+    if (item.file != nullptr) {
+        key = static_cast<uint64>(reinterpret_cast<std::uintptr_t>(item.file)) * 0x9E3779B97F4A7C15ULL;
+        key ^= static_cast<uint64>(item.line) * 0xC2B2AE3D27D4EB4FULL;
+    } else {
+        // FNV-1a of the tag.
+        key = 0xCBF29CE484222325ULL;
+        for (const char character : item.tag) {
+            key = (key ^ static_cast<unsigned char>(character)) * 0x100000001B3ULL;
+        }
+
+        key ^= static_cast<uint64>(item.level) + 1;
+    }
+
+    key ^= key >> 29;
+
+    // Zero marks an empty table cell.
+    return key != 0 ? key : 1;
+}
+
+/// @brief Formats `<prefix><count><suffix>` into the buffer.
+template <usize Size>
+std::string_view format_count(std::array<char, Size>& buffer,
+                              std::string_view prefix,
+                              uint64 count,
+                              std::string_view suffix)
+{
+    char* output = std::copy(prefix.begin(), prefix.end(), buffer.data());
+    output       = std::to_chars(output, buffer.data() + buffer.size(), count).ptr;
+    output       = std::copy(suffix.begin(), suffix.end(), output);
+
+    return std::string_view(buffer.data(), static_cast<usize>(output - buffer.data()));
+}
+
+} // namespace
+
+namespace framework::log
+{
+rate_limited_logger::rate_limited_logger(std::unique_ptr<logger_base> sink,
+                                         float64 rate,
+                                         usize burst,
+                                         bool collapse_repeats)
+    : m_sink(std::move(sink)),
+      m_serial(loggers_count.fetch_add(1, std::memory_order_relaxed) % serial_mask + 1),
+      m_collapse_repeats(collapse_repeats)
+{
+    if (rate > 0.0 || collapse_repeats) {
+        m_sites = std::make_unique<call_site[]>(max_call_sites);
+    }
+
+    if (rate > 0.0) {
+        const float64 interval = 1e9 / rate / log_details::calibration().nanoseconds_per_tick;
+
+        m_interval_ticks  = std::max(static_cast<uint64>(interval), uint64{1});
+        m_tolerance_ticks = m_interval_ticks * (std::max(burst, usize{1}) - 1);
+    }
+}
+
+rate_limited_logger::~rate_limited_logger()
+{
+    write_all_repeats();
+}
+
+void rate_limited_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void rate_limited_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    add_message(log_details::make_record(level, tag, message));
+}
+
+void rate_limited_logger::add_message(const record& item)
+{
+    if (suppressed(item)) {
+        return;
+    }
+
+    call_site* site = m_sites ? find_site(item) : nullptr;
+
+    if (site != nullptr && m_interval_ticks != 0) {
+        if (!try_pass(*site, item)) {
+            return;
+        }
+
+        if (site->suppressed.load(std::memory_order_relaxed) && site->suppressed.exchange(false)) {
+            record note  = item;
+            note.message = "similar messages suppressed\n";
+
+            forward(site, note);
+        }
+    }
+
+    forward(site, item);
+}
+
+void rate_limited_logger::flush()
+{
+    write_all_repeats();
+
+    m_sink->flush();
+}
+
+rate_limited_logger::call_site* rate_limited_logger::find_site(const record& item) noexcept
+{
+    const uint64 key = call_site_key(item);
+
+    for (usize probe = 0; probe < max_probes; ++probe) {
+        call_site& site = m_sites[(key + probe) & (max_call_sites - 1)];
+
+        uint64 current = site.key.load(std::memory_order_acquire);
+        if (current == key) {
+            return &site;
+        }
+
+        if (current == 0 && site.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+            return &site;
+        }
+
+        if (current == key) {
+            return &site;
+        }
+    }
+
+    return nullptr;
+}
+
+bool rate_limited_logger::suppressed(const record& item) const noexcept
+{
+    if (item.site == nullptr) {
+        return false;
+    }
+
+    // Cached by another logger or zero, when the serial doesn't match.
+    const uint64 until = item.site->suppressed_until.load(std::memory_order_relaxed);
+
+    return (until & serial_mask) == m_serial && item.timestamp < (until & ~serial_mask);
+}
+
+bool rate_limited_logger::try_pass(call_site& site, const record& item) noexcept
+{
+    const uint64 now = item.timestamp;
+
+    // Generic cell rate algorithm, the bucket is a single timestamp.
+    uint64 allowed_until = site.allowed_until.load(std::memory_order_relaxed);
+
+    while (true) {
+        if (allowed_until > now + m_tolerance_ticks) {
+            site.suppressed.store(true, std::memory_order_relaxed);
+
+            if (item.site != nullptr) {
+                // Rounded down, the rest of the suppression goes through the bucket.
+                const uint64 until = (allowed_until - m_tolerance_ticks) & ~serial_mask;
+                item.site->suppressed_until.store(until | m_serial, std::memory_order_relaxed);
+            }
+
+            return false;
+        }
+
+        const uint64 next = std::max(allowed_until, now) + m_interval_ticks;
+        if (site.allowed_until.compare_exchange_weak(allowed_until, next, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+void rate_limited_logger::forward(call_site* site, const record& item)
+{
+    if (!m_collapse_repeats || site == nullptr) {
+        m_sink->add_message(item);
+        return;
+    }
+
+    std::unique_lock lock(site->mutex);
+
+    if (site->last_record.level == item.level && site->last_tag == item.tag && site->last_message == item.message &&
+        !site->last_message.empty()) {
+        ++site->repeats;
+        return;
+    }
+
+    write_repeats(*site, lock);
+
+    site->last_tag.assign(item.tag);
+    site->last_message.assign(item.message);
+
+    site->last_record         = item;
+    site->last_record.tag     = site->last_tag;
+    site->last_record.message = site->last_message;
+
+    lock.unlock();
+
+    m_sink->add_message(item);
+}
+
+void rate_limited_logger::write_repeats(call_site& site, std::unique_lock<std::mutex>& lock)
+{
+    if (site.repeats == 0) {
+        return;
+    }
+
+    std::array<char, 64> buffer{};
+
+    // The tag is moved out, so the note stays valid when the site lock is released.
+    const std::string tag = std::move(site.last_tag);
+
+    record note  = site.last_record;
+    note.tag     = tag;
+    note.message = format_count(buffer, "last message repeated ", site.repeats, " times\n");
+
+    site.repeats = 0;
+    site.last_tag.clear();
+    site.last_message.clear();
+    site.last_record.tag     = {};
+    site.last_record.message = {};
+
+    lock.unlock();
+    m_sink->add_message(note);
+    lock.lock();
+}
+
+void rate_limited_logger::write_all_repeats()
+{
+    if (!m_collapse_repeats || !m_sites) {
+        return;
+    }
+
+    for (usize index = 0; index < max_call_sites; ++index) {
+        call_site& site = m_sites[index];
+
+        if (site.key.load(std::memory_order_acquire) != 0) {
+            std::unique_lock lock(site.mutex);
+            write_repeats(site, lock);
+        }
+    }
+}
+
+} // namespace framework::log
@@ -0,0 +1,141 @@
+/// @file
+/// @brief Implementation of logger that limits message rate and collapses repeated messages.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_RATE_LIMITED_LOGGER_HPP
+#define FRAMEWORK_LOG_RATE_LIMITED_LOGGER_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <common/types.hpp>
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Limits message rate of every call site and collapses repeated messages.
+///
+/// Each call site has a token bucket: `burst` messages pass at once, then at most `rate`@n
+/// messages per second. The call site is the source location of the logging macros,@n
+/// messages without location are limited per tag and level. The first suppressed message@n
+/// caches the end of the suppression in the @ref log_details::call_site_state of the logging@n
+/// macro, the following ones cost a single atomic load. The next passed message of the call site@n
+/// is preceded by a note that similar messages were suppressed.
+///
+/// Consecutive equal messages of a call site are passed once, the count of repeats is written@n
+/// before the next different message of the site or on @ref flush. Each call site has its own@n
+/// collapsing state, so threads logging from different sites don't contend.
+/// @code
+/// set_logger(std::make_unique<rate_limited_logger>(std::make_unique<stream_logger>(log_stream)));
+/// @endcode
+class rate_limited_logger : public logger_base
+{
+public:
+    /// @brief Maximum count of tracked call sites, messages of other sites are not limited or collapsed.
+    static constexpr usize max_call_sites = 1024;
+
+    /// @brief Creates rate limited logger.
+    ///
+    /// @param sink Logger that receives passed messages.
+    /// @param rate Messages per second of one call site, zero disables the limit.
+    /// @param burst Messages of one call site that pass at once.
+    /// @param collapse_repeats Collapse consecutive equal messages.
+    explicit rate_limited_logger(std::unique_ptr<logger_base> sink,
+                                 float64 rate          = 10.0,
+                                 usize burst           = 20,
+                                 bool collapse_repeats = true);
+
+    /// @brief Writes the pending repeats count.
+    ~rate_limited_logger() override;
+
+    rate_limited_logger(const rate_limited_logger&) = delete;
+    rate_limited_logger& operator=(const rate_limited_logger&) = delete;
+
+    rate_limited_logger(rate_limited_logger&&) = delete;
+    rate_limited_logger& operator=(rate_limited_logger&&) = delete;
+
+    /// @brief Passes message to the sink unless it is limited.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override;
+
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Passes message record to the sink unless it is limited.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Writes the pending repeats count and flushes the sink.
+    void flush() override;
+
+private:
+    struct call_site
+    {
+        std::atomic<uint64> key{0};
+        std::atomic<uint64> allowed_until{0}; ///< Theoretical arrival time of the next message.
+        std::atomic<bool> suppressed{false};
+
+        std::mutex mutex;                                  ///< Guards the repeats state below.
+        record last_record{severity_level::debug, {}, {}}; ///< Tag and message point to the strings below.
+        std::string last_tag;
+        std::string last_message;
+        usize repeats = 0;
+    };
+
+    call_site* find_site(const record& item) noexcept;
+    bool suppressed(const record& item) const noexcept;
+    bool try_pass(call_site& site, const record& item) noexcept;
+
+    void forward(call_site* site, const record& item);
+    void write_repeats(call_site& site, std::unique_lock<std::mutex>& lock);
+    void write_all_repeats();
+
+    std::unique_ptr<logger_base> m_sink;
+    std::unique_ptr<call_site[]> m_sites;
+
+    uint64 m_interval_ticks  = 0;
+    uint64 m_tolerance_ticks = 0;
+    uint64 m_serial; ///< Tags the suppression ticks cached in the call sites.
+    bool m_collapse_repeats;
+};
+
+/// @}
+
+} // namespace framework::log
+
+#endif
@@ -0,0 +1,323 @@
+/// @file
+/// @brief Ring logger implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <csignal>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <log/log_details.hpp>
+#include <log/ring_logger.hpp>
+
+namespace
+{
+using framework::log::ring_logger;
+using framework::log::severity_level;
+
+constexpr std::array<int, 5> crash_signals = {SIGSEGV,
+                                              SIGABRT,
+                                              SIGFPE,
+                                              SIGILL,
+#if defined(SIGBUS)
+                                              SIGBUS
+#else
+                                              SIGSEGV
+#endif
+};
+
+std::atomic<const ring_logger*> crash_logger{nullptr};
+std::atomic<int> crash_file{2};
+std::atomic<bool> crash_dumped{false}; ///< Set by the crash signals and @ref dump_crash_log.
+std::atomic<bool> fatal_dumped{false}; ///< Set by the first fatal message.
+
+#if defined(_WIN32)
+using signal_action = void (*)(int);
+#else
+using signal_action = struct sigaction;
+#endif
+
+/// Handlers that were installed before the crash handler, the crash handler calls them after the dump.
+std::array<signal_action, crash_signals.size()> previous_actions{};
+
+void dump_once(std::atomic<bool>& dumped) noexcept
+{
+    const ring_logger* logger = crash_logger.load(std::memory_order_acquire);
+    if (logger == nullptr || dumped.exchange(true)) {
+        return;
+    }
+
+    logger->dump(crash_file.load(std::memory_order_relaxed));
+}
+
+void write_all(int file, const char* data, framework::usize size) noexcept
+{
+    while (size > 0) {
+#if defined(_WIN32)
+        const int written = ::_write(file, data, static_cast<unsigned int>(std::min<framework::usize>(size, 0x40000000)));
+#else
+        const auto written = ::write(file, data, size);
+#endif
+        if (written <= 0) {
+            return;
+        }
+
+        data += written;
+        size -= static_cast<framework::usize>(written);
+    }
+}
+
+const signal_action* find_previous_action(int signal_number) noexcept
+{
+    for (framework::usize index = 0; index < crash_signals.size(); ++index) {
+        if (crash_signals[index] == signal_number) {
+            return &previous_actions[index];
+        }
+    }
+
+    return nullptr;
+}
+
+#if defined(_WIN32)
+extern "C" void crash_signal_handler(int signal_number)
+{
+    dump_once(crash_dumped);
+
+    const signal_action* previous = find_previous_action(signal_number);
+    if (previous != nullptr && *previous != SIG_DFL && *previous != SIG_IGN && *previous != SIG_ERR) {
+        (*previous)(signal_number);
+        return;
+    }
+
+    // Default action terminates the process as usual.
+    std::signal(signal_number, SIG_DFL);
+    std::raise(signal_number);
+}
+#else
+extern "C" void crash_signal_handler(int signal_number, siginfo_t* info, void* context)
+{
+    dump_once(crash_dumped);
+
+    const signal_action* previous = find_previous_action(signal_number);
+    if (previous != nullptr && (previous->sa_flags & SA_SIGINFO) != 0) {
+        previous->sa_sigaction(signal_number, info, context);
+        return;
+    }
+
+    if (previous != nullptr && previous->sa_handler != SIG_DFL && previous->sa_handler != SIG_IGN) {
+        previous->sa_handler(signal_number);
+        return;
+    }
+
+    // Default action terminates the process as usual. Ignored signal gets the default action too,
+    // otherwise the faulting instruction would be restarted forever.
+    struct sigaction action
+    {};
+    action.sa_handler = SIG_DFL;
+    sigemptyset(&action.sa_mask);
+
+    sigaction(signal_number, &action, nullptr);
+    std::raise(signal_number);
+}
+#endif
+
+void install_signal_handlers()
+{
+#if defined(_WIN32)
+    for (framework::usize index = 0; index < crash_signals.size(); ++index) {
+        const signal_action previous = std::signal(crash_signals[index], crash_signal_handler);
+
+        // The crash handler must not become its own previous handler.
+        if (previous != crash_signal_handler) {
+            previous_actions[index] = previous;
+        }
+    }
+#else
+    struct sigaction action
+    {};
+    action.sa_sigaction = crash_signal_handler;
+    action.sa_flags     = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+
+    for (framework::usize index = 0; index < crash_signals.size(); ++index) {
+        signal_action current{};
+        sigaction(crash_signals[index], nullptr, &current);
+
+        // The crash handler must not become its own previous handler.
+        if ((current.sa_flags & SA_SIGINFO) != 0 && current.sa_sigaction == crash_signal_handler) {
+            continue;
+        }
+
+        previous_actions[index] = current;
+        sigaction(crash_signals[index], &action, nullptr);
+    }
+#endif
+}
+
+} // namespace
+
+namespace framework::log
+{
+ring_logger::ring_logger(usize capacity)
+{
+    usize size = 4096;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    m_buffer = std::make_unique<char[]>(size);
+    m_mask   = size - 1;
+}
+
+ring_logger::~ring_logger()
+{
+    const ring_logger* self = this;
+    crash_logger.compare_exchange_strong(self, nullptr);
+}
+
+void ring_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void ring_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    add_message(log_details::make_record(level, tag, message));
+}
+
+void ring_logger::add_message(const record& item)
+{
+    const std::string_view name = level_name(item.level);
+
+    std::array<char, 16> thread{};
+    const auto thread_end = std::to_chars(thread.data(), thread.data() + thread.size(), item.thread).ptr;
+    const std::string_view thread_text(thread.data(), static_cast<usize>(thread_end - thread.data()));
+
+    const usize header_size = name.size() + thread_text.size() + item.tag.size() + 7;
+    const usize capacity    = m_mask + 1;
+
+    // Line never overwrites itself.
+    std::string_view message = item.message;
+    if (header_size + message.size() + 1 > capacity) {
+        message = message.substr(0, capacity > header_size + 1 ? capacity - header_size - 1 : 0);
+    }
+
+    const bool add_newline = message.empty() || message.back() != '\n';
+    const usize size       = header_size + message.size() + (add_newline ? 1 : 0);
+
+    uint64 position   = m_position.fetch_add(size, std::memory_order_relaxed);
+    const auto append = [this, &position](std::string_view text) {
+        put(position, text);
+        position += text.size();
+    };
+
+    append("[");
+    append(name);
+    append("] #");
+    append(thread_text);
+    append(" ");
+    append(item.tag);
+    append(": ");
+    append(message);
+    if (add_newline) {
+        append("\n");
+    }
+
+    if (item.level == severity_level::fatal && crash_logger.load(std::memory_order_acquire) == this) {
+        dump_once(fatal_dumped);
+    }
+}
+
+void ring_logger::dump(int file) const noexcept
+{
+    const uint64 position = m_position.load(std::memory_order_acquire);
+    const usize capacity  = m_mask + 1;
+
+    constexpr std::string_view header = "--- last log messages ---\n";
+    write_all(file, header.data(), header.size());
+
+    if (position <= capacity) {
+        write_all(file, m_buffer.get(), static_cast<usize>(position));
+        return;
+    }
+
+    // The oldest line is partially overwritten, start from the next one.
+    usize start     = static_cast<usize>(position) & m_mask;
+    usize remaining = capacity;
+    while (remaining > 0 && m_buffer[start] != '\n') {
+        start = (start + 1) & m_mask;
+        --remaining;
+    }
+
+    if (remaining <= 1) {
+        return;
+    }
+
+    start = (start + 1) & m_mask;
+    --remaining;
+
+    const usize first = std::min(remaining, capacity - start);
+    write_all(file, m_buffer.get() + start, first);
+    write_all(file, m_buffer.get(), remaining - first);
+}
+
+void ring_logger::install_crash_handler(int file)
+{
+    crash_file.store(file, std::memory_order_relaxed);
+    crash_logger.store(this, std::memory_order_release);
+
+    install_signal_handlers();
+}
+
+void ring_logger::put(uint64 position, std::string_view text) noexcept
+{
+    const usize start = static_cast<usize>(position) & m_mask;
+    const usize first = std::min(text.size(), m_mask + 1 - start);
+
+    std::memcpy(m_buffer.get() + start, text.data(), first);
+    std::memcpy(m_buffer.get(), text.data() + first, text.size() - first);
+}
+
+void dump_crash_log() noexcept
+{
+    // The fatal message that led here has dumped the log already.
+    if (fatal_dumped.load()) {
+        return;
+    }
+
+    dump_once(crash_dumped);
+}
+
+} // namespace framework::log
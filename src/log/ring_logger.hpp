@@ -0,0 +1,129 @@
+/// @file
+/// @brief Implementation of logger that keeps recent messages in memory for crash dumps.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_RING_LOGGER_HPP
+#define FRAMEWORK_LOG_RING_LOGGER_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <common/types.hpp>
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Keeps the last messages in a preallocated circular buffer.
+///
+/// Messages are formatted as `[level] #thread tag: message` lines and copied into@n
+/// the buffer after a single atomic position increment, the oldest lines are overwritten.@n
+/// Nothing is written to files until @ref dump is called.
+///
+/// @ref install_crash_handler makes the logger dump its content when the process@n
+/// receives `SIGSEGV`, `SIGABRT`, `SIGBUS`, `SIGFPE` or `SIGILL` and when the first@n
+/// @ref severity_level::fatal message is logged. The signal dump is written once and@n
+/// doesn't depend on the fatal message dump. After the dump the signal is passed to the@n
+/// handler installed before, or raised again with the default action.
+/// @code
+/// auto ring = std::make_unique<ring_logger>(64 * 1024);
+/// ring->install_crash_handler();
+/// set_logger(std::move(ring));
+/// @endcode
+class ring_logger : public logger_base
+{
+public:
+    /// @brief Creates ring logger.
+    ///
+    /// @param capacity Buffer size in bytes, rounded up to the power of two.
+    explicit ring_logger(usize capacity = 64 * 1024);
+
+    /// @brief Removes the crash handler target if it is this logger.
+    ~ring_logger() override;
+
+    ring_logger(const ring_logger&) = delete;
+    ring_logger& operator=(const ring_logger&) = delete;
+
+    ring_logger(ring_logger&&) = delete;
+    ring_logger& operator=(ring_logger&&) = delete;
+
+    /// @brief Copies message into the buffer.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override;
+
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Copies message record into the buffer.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Writes buffered lines from the oldest to the newest.
+    ///
+    /// Uses only async-signal-safe calls. Lines written concurrently with the dump can be torn.
+    ///
+    /// @param file File descriptor.
+    void dump(int file) const noexcept;
+
+    /// @brief Dumps this logger on crash signals and fatal messages.
+    ///
+    /// Replaces the previous crash handler target. Signal handlers installed since the last call@n
+    /// become the previous handlers.
+    ///
+    /// @param file File descriptor of the dump, standard error by default.
+    void install_crash_handler(int file = 2);
+
+private:
+    void put(uint64 position, std::string_view text) noexcept;
+
+    std::unique_ptr<char[]> m_buffer;
+    usize m_mask;
+
+    std::atomic<uint64> m_position{0};
+};
+
+/// @brief Dumps the logger registered with `ring_logger::install_crash_handler`.
+///
+/// Async-signal-safe, shares the once per process dump with the crash signals.@n
+/// Does nothing after a fatal message has dumped the log, so fatal error handlers may call it@n
+/// after logging the error.
+void dump_crash_log() noexcept;
+
+/// @}
+
+} // namespace framework::log
+
+#endif
@@ -27,18 +27,66 @@
 // SOFTWARE.
 // =============================================================================
 
+#include <algorithm>
+
 #include <log/stream_logger.hpp>
 
 namespace framework::log
 {
-stream_logger::stream_logger(std::ostream& stream) : m_output(stream)
+stream_logger::stream_logger(std::ostream& stream, bool print_context)
+    : m_output(stream), m_print_context(print_context)
 {}
 
 void stream_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void stream_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    add_message(log_details::make_record(level, tag, message));
+}
+
+void stream_logger::add_message(const record& item)
+{
+    std::lock_guard lock(m_output_mutex);
+
+    print(item);
+}
+
+void stream_logger::add_messages(const record* records, std::size_t count)
 {
     std::lock_guard lock(m_output_mutex);
 
-    m_output << "[" << level << "] " << tag << ": " << message;
+    for (std::size_t i = 0; i < count; ++i) {
+        print(records[i]);
+    }
+}
+
+void stream_logger::flush()
+{
+    std::lock_guard lock(m_output_mutex);
+
+    m_output.flush();
+}
+
+void stream_logger::print(const record& item)
+{
+    if (!m_print_context) {
+        m_output << "[" << item.level << "] " << item.tag << ": " << item.message;
+        return;
+    }
+
+    m_output << m_timestamp.format(item.timestamp) << " [" << item.level << "] #" << item.thread << " " << item.tag;
+
+    if (item.file != nullptr) {
+        std::string_view file = item.file;
+        file.remove_prefix(std::min(file.size(), file.find_last_of("/\\") + 1));
+
+        m_output << " (" << file << ":" << item.line << ")";
+    }
+
+    m_output << ": " << item.message;
 }
 
 } // namespace framework::log
@@ -30,9 +30,12 @@
 #ifndef FRAMEWORK_LOG_STREAM_LOGGER_HPP
 #define FRAMEWORK_LOG_STREAM_LOGGER_HPP
 
+#include <cstddef>
 #include <mutex>
 #include <ostream>
+#include <string_view>
 
+#include <log/log_details.hpp>
 #include <log/logger.hpp>
 
 namespace framework::log
@@ -41,13 +44,19 @@ namespace framework::log
 /// @{
 
 /// @brief Prints all messages to provided stream.
+///
+/// With the context enabled, lines look like@n
+/// `2018-01-01 12:00:00.000000 [info] #0 tag (file.cpp:42): message`,@n
+/// the location is printed only for messages of the `FRAMEWORK_LOG_*` macros.@n
+/// Otherwise lines are `[info] tag: message`.
 class stream_logger : public logger_base
 {
 public:
     /// @brief Creates stream logger.
     ///
     /// @param stream Output stream.
-    explicit stream_logger(std::ostream& stream);
+    /// @param print_context Print the timestamp, the thread index and the location of messages.
+    explicit stream_logger(std::ostream& stream, bool print_context = true);
 
     /// @brief Prints message to the stream.
     ///
@@ -56,9 +65,30 @@ public:
     /// @param message Message itself.
     void add_message(severity_level level, const std::string& tag, const std::string& message) override;
 
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Prints message record to the stream.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Prints messages to the stream under a single lock.
+    ///
+    /// @param records Pointer to the first record.
+    /// @param count Records count.
+    void add_messages(const record* records, std::size_t count) override;
+
+    /// @brief Flushes the stream.
+    void flush() override;
+
 private:
+    void print(const record& item);
+
     std::ostream& m_output;
     std::mutex m_output_mutex;
+    bool m_print_context;
+    log_details::timestamp_formatter m_timestamp; ///< Guarded by the output mutex.
 };
 
 /// @}
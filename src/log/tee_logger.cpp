@@ -0,0 +1,155 @@
+/// @file
+/// @brief Tee logger implementation.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <log/log_details.hpp>
+#include <log/tee_logger.hpp>
+
+namespace
+{
+bool contains(const std::vector<std::string>& values, const std::string& value)
+{
+    return std::find(values.begin(), values.end(), value) != values.end();
+}
+
+} // namespace
+
+namespace framework::log
+{
+void tee_logger::add_sink(std::unique_ptr<logger_base> sink, severity_level level, std::vector<std::string> tags)
+{
+    if (m_sinks.size() >= max_sinks) {
+        throw std::length_error("Too many log sinks.");
+    }
+
+    m_sinks.push_back({std::move(sink), level, std::move(tags)});
+
+    build_routes();
+}
+
+void tee_logger::add_message(severity_level level, const std::string& tag, const std::string& message)
+{
+    add_message(level, std::string_view(tag), std::string_view(message));
+}
+
+void tee_logger::add_message(severity_level level, std::string_view tag, std::string_view message)
+{
+    add_message(log_details::make_record(level, tag, message));
+}
+
+void tee_logger::add_message(const record& item)
+{
+    if (m_sinks.empty()) {
+        return;
+    }
+
+    uint64 mask = m_routes[tag_id(item.tag) * levels_count + static_cast<usize>(item.level)];
+
+    for (usize index = 0; mask != 0; ++index, mask >>= 1) {
+        if ((mask & 1) != 0) {
+            m_sinks[index].sink->add_message(item);
+        }
+    }
+}
+
+void tee_logger::flush()
+{
+    for (auto& info : m_sinks) {
+        info.sink->flush();
+    }
+}
+
+usize tee_logger::tag_id(std::string_view tag) const noexcept
+{
+    if (m_tags.empty()) {
+        return 0;
+    }
+
+    const usize mask = m_tag_slots.size() - 1;
+
+    for (usize slot = log_details::string_hash(tag) & mask;; slot = (slot + 1) & mask) {
+        const uint32 id = m_tag_slots[slot];
+        if (id == 0 || m_tags[id - 1] == tag) {
+            return id;
+        }
+    }
+}
+
+void tee_logger::build_routes()
+{
+    m_tags.clear();
+    for (const auto& info : m_sinks) {
+        for (const auto& tag : info.tags) {
+            if (!contains(m_tags, tag)) {
+                m_tags.push_back(tag);
+            }
+        }
+    }
+
+    // At least half of the slots stay empty, so lookups always stop.
+    usize capacity = 2;
+    while (capacity < m_tags.size() * 2) {
+        capacity <<= 1;
+    }
+
+    m_tag_slots.assign(capacity, 0);
+    for (usize index = 0; index < m_tags.size(); ++index) {
+        usize slot = log_details::string_hash(m_tags[index]) & (capacity - 1);
+        while (m_tag_slots[slot] != 0) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+
+        m_tag_slots[slot] = static_cast<uint32>(index + 1);
+    }
+
+    // Tag id zero stands for tags not mentioned in filters.
+    m_routes.assign((m_tags.size() + 1) * levels_count, 0);
+    for (usize id = 0; id <= m_tags.size(); ++id) {
+        for (usize level = 0; level < levels_count; ++level) {
+            uint64 mask = 0;
+
+            for (usize index = 0; index < m_sinks.size(); ++index) {
+                const auto& info = m_sinks[index];
+
+                const bool level_passed = level >= static_cast<usize>(info.level);
+                const bool tag_passed   = info.tags.empty() || (id > 0 && contains(info.tags, m_tags[id - 1]));
+
+                if (level_passed && tag_passed) {
+                    mask |= uint64{1} << index;
+                }
+            }
+
+            m_routes[id * levels_count + level] = mask;
+        }
+    }
+}
+
+} // namespace framework::log
@@ -0,0 +1,126 @@
+/// @file
+/// @brief Implementation of logger that passes messages to several loggers.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_LOG_TEE_LOGGER_HPP
+#define FRAMEWORK_LOG_TEE_LOGGER_HPP
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <common/types.hpp>
+#include <log/logger.hpp>
+
+namespace framework::log
+{
+/// @addtogroup log_logger
+/// @{
+
+/// @brief Passes messages to several loggers, each with its own severity and tag filter.
+///
+/// Filters are compiled into a routing table, that holds a mask of receiving sinks@n
+/// for every severity level and every tag mentioned in the filters. Dispatching a message@n
+/// takes one tag lookup and one table read, regardless of the sinks count.
+///
+/// Sinks should be added before the logger is used.
+/// @code
+/// auto logger = std::make_unique<tee_logger>();
+/// logger->add_sink(std::make_unique<file_logger>("errors.log"), severity_level::error);
+/// logger->add_sink(std::make_unique<stream_logger>(std::cerr), severity_level::debug, {"renderer"});
+/// set_logger(std::move(logger));
+/// @endcode
+class tee_logger : public logger_base
+{
+public:
+    /// @brief Maximum count of sinks.
+    static constexpr usize max_sinks = 64;
+
+    tee_logger() = default;
+
+    tee_logger(const tee_logger&) = delete;
+    tee_logger& operator=(const tee_logger&) = delete;
+
+    tee_logger(tee_logger&&) = delete;
+    tee_logger& operator=(tee_logger&&) = delete;
+
+    /// @brief Adds sink and rebuilds the routing table.
+    ///
+    /// @param sink Logger that receives messages.
+    /// @param level Minimum level of passed messages.
+    /// @param tags Tags of passed messages, empty list passes all tags.
+    ///
+    /// @throw std::length_error if there are @ref max_sinks sinks already.
+    void add_sink(std::unique_ptr<logger_base> sink,
+                  severity_level level          = severity_level::debug,
+                  std::vector<std::string> tags = {});
+
+    /// @brief Passes message to the sinks.
+    ///
+    /// @param level The message @ref severity_level
+    /// @param tag Message tag. Describes message domain.
+    /// @param message Message itself.
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override;
+
+    /// @copydoc add_message(severity_level,const std::string&,const std::string&)
+    void add_message(severity_level level, std::string_view tag, std::string_view message) override;
+
+    /// @brief Passes message record to the sinks.
+    ///
+    /// @param item Message record.
+    void add_message(const record& item) override;
+
+    /// @brief Flushes all sinks.
+    void flush() override;
+
+private:
+    static constexpr usize levels_count = 5;
+
+    struct sink_info
+    {
+        std::unique_ptr<logger_base> sink;
+        severity_level level;
+        std::vector<std::string> tags;
+    };
+
+    usize tag_id(std::string_view tag) const noexcept;
+    void build_routes();
+
+    std::vector<sink_info> m_sinks;
+
+    std::vector<std::string> m_tags; ///< Tags mentioned in filters, id is the index plus one.
+    std::vector<uint32> m_tag_slots; ///< Open addressing table of tag ids.
+    std::vector<uint64> m_routes;    ///< Sink masks indexed by tag id and level.
+};
+
+/// @}
+
+} // namespace framework::log
+
+#endif
@@ -74,6 +74,40 @@ inline constexpr vector<N, T> abs(const vector<N, T>& value)
 {
     return transform(value, ::framework::math::abs<T>);
 }
+
+#if defined(FRAMEWORK_MATH_SIMD_CONSTEXPR)
+/// @brief Creates a vector of the absolute values from the provided vector.
+///
+/// @param value Vector of float32 values.
+///
+/// @return A vector of the absolute values.
+inline constexpr vector<4, float32> abs(const vector<4, float32>& value) noexcept
+{
+    if (simd_details::is_constant_evaluated()) {
+        return transform(value, ::framework::math::abs<float32>);
+    }
+
+    vector<4, float32> result;
+    simd_details::store(result.data(), simd_details::abs(simd_details::load(value.data())));
+    return result;
+}
+
+/// @brief Creates a vector of the absolute values from the provided vector.
+///
+/// @param value Vector of int32 values.
+///
+/// @return A vector of the absolute values.
+inline constexpr vector<4, int32> abs(const vector<4, int32>& value) noexcept
+{
+    if (simd_details::is_constant_evaluated()) {
+        return transform(value, ::framework::math::abs<int32>);
+    }
+
+    vector<4, int32> result;
+    simd_details::store(result.data(), simd_details::abs(simd_details::load(value.data())));
+    return result;
+}
+#endif
 /// @}
 
 /// @name sign
@@ -365,6 +399,60 @@ inline constexpr vector<N, T> min(const vector<N, T>& a, const vector<N, T>& b)
 {
     return transform(a, b, ::framework::math::min<T>);
 }
+
+#if defined(FRAMEWORK_MATH_SIMD)
+/// @brief Compares two vectors by components and return a vector of smaller values.
+///
+/// @param a Vector of float32 values.
+/// @param b Vector of float32 values.
+///
+/// @return A vector of smaller values.
+inline vector<4, float32> min(const vector<4, float32>& a, const vector<4, float32>& b) noexcept
+{
+    vector<4, float32> result;
+    simd_details::store(result.data(), simd_details::min(simd_details::load(a.data()), simd_details::load(b.data())));
+    return result;
+}
+
+/// @brief Compares vector with scalar value and return a vector of smaller values.
+///
+/// @param a Vector of float32 values.
+/// @param b Scalar float32 value.
+///
+/// @return A vector of smaller values.
+inline vector<4, float32> min(const vector<4, float32>& a, float32 b) noexcept
+{
+    vector<4, float32> result;
+    simd_details::store(result.data(), simd_details::min(simd_details::load(a.data()), simd_details::splat(b)));
+    return result;
+}
+
+/// @brief Compares two vectors by components and return a vector of smaller values.
+///
+/// @param a Vector of int32 values.
+/// @param b Vector of int32 values.
+///
+/// @return A vector of smaller values.
+inline vector<4, int32> min(const vector<4, int32>& a, const vector<4, int32>& b) noexcept
+{
+    vector<4, int32> result;
+    simd_details::store(result.data(), simd_details::min(simd_details::load(a.data()), simd_details::load(b.data())));
+    return result;
+}
+
+/// @brief Compares vector with scalar value and return a vector of smaller values.
+///
+/// @param a Vector of int32 values.
+/// @param b Scalar int32 value.
+///
+/// @return A vector of smaller values.
+inline vector<4, int32> min(const vector<4, int32>& a, int32 b) noexcept
+{
+    vector<4, int32> result;
+    simd_details::store(result.data(), simd_details::min(simd_details::load(a.data()), simd_details::splat(b)));
+    return result;
+}
+#endif
 /// @}
 
 /// @name max
@@ -409,6 +497,60 @@ inline constexpr vector<N, T> max(const vector<N, T>& a, const vector<N, T>& b)
 {
     return transform(a, b, ::framework::math::max<T>);
 }
+
+#if defined(FRAMEWORK_MATH_SIMD)
+/// @brief Compares two vectors by components and return a vector of greater values.
+///
+/// @param a Vector of float32 values.
+/// @param b Vector of float32 values.
+///
+/// @return A vector of greater values.
+inline vector<4, float32> max(const vector<4, float32>& a, const vector<4, float32>& b) noexcept
+{
+    vector<4, float32> result;
+    simd_details::store(result.data(), simd_details::max(simd_details::load(a.data()), simd_details::load(b.data())));
+    return result;
+}
+
+/// @brief Compares vector with scalar value and return a vector of greater values.
+///
+/// @param a Vector of float32 values.
+/// @param b Scalar float32 value.
+///
+/// @return A vector of greater values.
+inline vector<4, float32> max(const vector<4, float32>& a, float32 b) noexcept
+{
+    vector<4, float32> result;
+    simd_details::store(result.data(), simd_details::max(simd_details::load(a.data()), simd_details::splat(b)));
+    return result;
+}
+
+/// @brief Compares two vectors by components and return a vector of greater values.
+///
+/// @param a Vector of int32 values.
+/// @param b Vector of int32 values.
+///
+/// @return A vector of greater values.
+inline vector<4, int32> max(const vector<4, int32>& a, const vector<4, int32>& b) noexcept
+{
+    vector<4, int32> result;
+    simd_details::store(result.data(), simd_details::max(simd_details::load(a.data()), simd_details::load(b.data())));
+    return result;
+}
+
+/// @brief Compares vector with scalar value and return a vector of greater values.
+///
+/// @param a Vector of int32 values.
+/// @param b Scalar int32 value.
+///
+/// @return A vector of greater values.
+inline vector<4, int32> max(const vector<4, int32>& a, int32 b) noexcept
+{
+    vector<4, int32> result;
+    simd_details::store(result.data(), simd_details::max(simd_details::load(a.data()), simd_details::splat(b)));
+    return result;
+}
+#endif
 /// @}
 
 /// @name clamp
@@ -695,6 +837,29 @@ inline vector<N, T> fma(const vector<N, T>& a, const vector<N, T>& b, const vect
 {
     return a * b + c;
 }
+
+#if defined(FRAMEWORK_MATH_SIMD)
+/// @brief Computes `(a * b) + z` for each component of the vector.
+///
+/// Uses fused multiply-add instruction if the target supports it.
+///
+/// @param a Vector of float32 values.
+/// @param b Vector of float32 values.
+/// @param c Vector of float32 values.
+///
+/// @return Vector which is equivalent to `(a * b) + c`.
+inline vector<4, float32> fma(const vector<4, float32>& a,
+                              const vector<4, float32>& b,
+                              const vector<4, float32>& c) noexcept
+{
+    vector<4, float32> result;
+    simd_details::store(result.data(),
+                        simd_details::fma(simd_details::load(a.data()),
+                                          simd_details::load(b.data()),
+                                          simd_details::load(c.data())));
+    return result;
+}
+#endif
 /// @}
 
 /// @name frexp
@@ -0,0 +1,208 @@
+/// @file
+/// @brief Contains dual quaternion type.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of dual_quaternion_type.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_DUAL_QUATERNION_TYPE_HPP
+#define FRAMEWORK_MATH_DETAILS_DUAL_QUATERNION_TYPE_HPP
+
+#include <common/types.hpp>
+#include <math/details/quaternion_type.hpp>
+#include <math/details/vector_type.hpp>
+
+namespace framework
+{
+namespace math
+{
+/// @addtogroup math_dual_quaternion_implementation
+/// @{
+
+/// @brief Dual quaternion type.
+///
+/// Represents a rigid transformation, i.e., rotation followed by translation, in 8 values.
+/// The real part is the rotation quaternion, the dual part is `0.5 * translation * real`.
+/// Unlike matrices, dual quaternions can be blended without introducing scale and shear.
+///
+/// @note Can be instantiated only with floating-point type.
+template <typename T>
+struct dual_quaternion final
+{
+    using value_type = T; ///< Value type
+
+    /// @brief Default constructor.
+    ///
+    /// Initializes identity transformation.
+    constexpr dual_quaternion() noexcept;
+
+    /// @brief Initializes dual quaternion with provided parts.
+    ///
+    /// @param real_value Value for the real part.
+    /// @param dual_value Value for the dual part.
+    constexpr dual_quaternion(const quaternion<T>& real_value, const quaternion<T>& dual_value) noexcept;
+
+    /// @brief Initializes dual quaternion from rotation and translation.
+    ///
+    /// @param rotation Unit rotation quaternion.
+    /// @param translation Translation applied after the rotation.
+    dual_quaternion(const quaternion<T>& rotation, const vector<3, T>& translation) noexcept;
+
+    quaternion<T> real; ///< The real part.
+    quaternion<T> dual; ///< The dual part.
+};
+
+/// @name Dual quaternion operators.
+/// @{
+
+/// @brief Addition operator.
+///
+/// @param lhs Dual quaternion.
+/// @param rhs Dual quaternion.
+///
+/// @return Component-wise sum of dual quaternions.
+template <typename T>
+inline dual_quaternion<T> operator+(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept;
+
+/// @brief Multiplication operator.
+///
+/// @param lhs Dual quaternion.
+/// @param rhs Scalar value.
+///
+/// @return Dual quaternion with both parts multiplied by the scalar.
+template <typename T>
+inline dual_quaternion<T> operator*(const dual_quaternion<T>& lhs, const T& rhs) noexcept;
+
+/// @brief Multiplication operator.
+///
+/// @param lhs Dual quaternion.
+/// @param rhs Dual quaternion.
+///
+/// @return Composition of transformations, rhs is applied first.
+template <typename T>
+inline dual_quaternion<T> operator*(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept;
+
+/// @brief Multiplication operator.
+///
+/// @param lhs Unit dual quaternion.
+/// @param rhs Point.
+///
+/// @return Transformed point.
+template <typename T>
+inline vector<3, T> operator*(const dual_quaternion<T>& lhs, const vector<3, T>& rhs) noexcept;
+
+/// @brief Equality operator.
+///
+/// @param lhs Dual quaternion to compare.
+/// @param rhs Dual quaternion to compare.
+///
+/// @return `true` if both parts are equal.
+template <typename T>
+inline constexpr bool operator==(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept;
+
+/// @brief Inequality operator.
+///
+/// @param lhs Dual quaternion to compare.
+/// @param rhs Dual quaternion to compare.
+///
+/// @return `true` if any part is not equal.
+template <typename T>
+inline constexpr bool operator!=(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept;
+/// @}
+
+/// @}
+
+#pragma region definitions
+
+template <typename T>
+inline constexpr dual_quaternion<T>::dual_quaternion() noexcept : real{}, dual{0, 0, 0, 0}
+{}
+
+template <typename T>
+inline constexpr dual_quaternion<T>::dual_quaternion(const quaternion<T>& real_value,
+                                                     const quaternion<T>& dual_value) noexcept
+    : real{real_value}, dual{dual_value}
+{}
+
+template <typename T>
+inline dual_quaternion<T>::dual_quaternion(const quaternion<T>& rotation, const vector<3, T>& translation) noexcept
+    : real{rotation}, dual{quaternion<T>(translation, T{0}) * rotation * T{0.5}}
+{}
+
+template <typename T>
+inline dual_quaternion<T> operator+(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept
+{
+    return dual_quaternion<T>(lhs.real + rhs.real, lhs.dual + rhs.dual);
+}
+
+template <typename T>
+inline dual_quaternion<T> operator*(const dual_quaternion<T>& lhs, const T& rhs) noexcept
+{
+    return dual_quaternion<T>(lhs.real * rhs, lhs.dual * rhs);
+}
+
+template <typename T>
+inline dual_quaternion<T> operator*(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept
+{
+    return dual_quaternion<T>(lhs.real * rhs.real, lhs.real * rhs.dual + lhs.dual * rhs.real);
+}
+
+template <typename T>
+inline vector<3, T> operator*(const dual_quaternion<T>& lhs, const vector<3, T>& rhs) noexcept
+{
+    // The translation is the imaginary part of `2 * dual * conjugate(real)`.
+    const quaternion<T>& r = lhs.real;
+    const quaternion<T>& d = lhs.dual;
+
+    const vector<3, T> translation(T{2} * (r.w * d.x - d.w * r.x + r.y * d.z - r.z * d.y),
+                                   T{2} * (r.w * d.y - d.w * r.y + r.z * d.x - r.x * d.z),
+                                   T{2} * (r.w * d.z - d.w * r.z + r.x * d.y - r.y * d.x));
+
+    return lhs.real * rhs + translation;
+}
+
+template <typename T>
+inline constexpr bool operator==(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept
+{
+    return lhs.real == rhs.real && lhs.dual == rhs.dual;
+}
+
+template <typename T>
+inline constexpr bool operator!=(const dual_quaternion<T>& lhs, const dual_quaternion<T>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+#pragma endregion
+
+} // namespace math
+
+} // namespace framework
+
+#endif
@@ -50,6 +50,13 @@ inline constexpr T dot(const vector<4, T>& a, const vector<4, T>& b)
     return (a.x * b.x) + (a.y * b.y) + (a.z * b.z) + (a.w * b.w);
 }
 
+#if defined(FRAMEWORK_MATH_SIMD)
+inline float32 dot(const vector<4, float32>& a, const vector<4, float32>& b) noexcept
+{
+    return simd_details::first(simd_details::dot(simd_details::load(a.data()), simd_details::load(b.data())));
+}
+#endif
+
 template <typename T>
 inline constexpr T dot(const vector<3, T>& a, const vector<3, T>& b)
 {
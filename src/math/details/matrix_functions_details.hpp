@@ -62,6 +62,24 @@ inline matrix<2, C, T> transpose(const matrix<C, 2, T>& value)
 {
     return matrix<2, C, T>{value.row(0), value.row(1)};
 }
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline matrix<4, 4, float32> transpose(const matrix<4, 4, float32>& value)
+{
+    simd_details::float4 c0 = simd_details::load(value[0].data());
+    simd_details::float4 c1 = simd_details::load(value[1].data());
+    simd_details::float4 c2 = simd_details::load(value[2].data());
+    simd_details::float4 c3 = simd_details::load(value[3].data());
+    simd_details::transpose(c0, c1, c2, c3);
+
+    matrix<4, 4, float32> result;
+    simd_details::store(result[0].data(), c0);
+    simd_details::store(result[1].data(), c1);
+    simd_details::store(result[2].data(), c2);
+    simd_details::store(result[3].data(), c3);
+    return result;
+}
+#endif
 /// @}
 
 /// @brief Realization of outer_product function.
@@ -306,6 +324,164 @@ inline matrix<2, 2, T> inverse_transpose(const matrix<2, 2, T>& m)
 }
 /// @}
 
+#if defined(FRAMEWORK_MATH_SSE2)
+/// @brief SIMD versions of inverse, affine_inverse and inverse_transpose.
+///
+/// Compute the same cofactors and determinant as the generic implementations
+/// lane by lane, in the same order of operations, so the results are equal
+/// to the generic ones. If the compiler contracts multiplications and additions
+/// into FMA, the results differ by at most 16 ULP of the largest element of the column.
+/// @{
+
+/// @brief Computes the 2x2 subfactors of two rows for the cofactors of the third one.
+///
+/// Lanes of y1, y2, y3 are the subfactors of columns (3, 2), (3, 2), (3, 1), (2, 1);
+/// (3, 1), (3, 0), (3, 0), (2, 0) and (2, 1), (2, 0), (1, 0), (1, 0) respectively.
+inline void subfactors(simd_details::float4 p,
+                       simd_details::float4 q,
+                       simd_details::float4& y1,
+                       simd_details::float4& y2,
+                       simd_details::float4& y3)
+{
+    using simd_details::mul;
+    using simd_details::sub;
+    using simd_details::swizzle;
+
+    const simd_details::float4 p3332 = swizzle<3, 3, 3, 2>(p);
+    const simd_details::float4 p2211 = swizzle<2, 2, 1, 1>(p);
+    const simd_details::float4 p1000 = swizzle<1, 0, 0, 0>(p);
+    const simd_details::float4 q3332 = swizzle<3, 3, 3, 2>(q);
+    const simd_details::float4 q2211 = swizzle<2, 2, 1, 1>(q);
+    const simd_details::float4 q1000 = swizzle<1, 0, 0, 0>(q);
+
+    y1 = sub(mul(p3332, q2211), mul(p2211, q3332));
+    y2 = sub(mul(p3332, q1000), mul(p1000, q3332));
+    y3 = sub(mul(p2211, q1000), mul(p1000, q2211));
+}
+
+/// @brief Computes the unsigned cofactors `(x1 * y1 - x2 * y2) + x3 * y3` for the row x.
+inline simd_details::float4 cofactors(simd_details::float4 x,
+                                      simd_details::float4 y1,
+                                      simd_details::float4 y2,
+                                      simd_details::float4 y3)
+{
+    using simd_details::mul;
+    using simd_details::swizzle;
+
+    const simd_details::float4 temp = simd_details::sub(mul(swizzle<1, 0, 0, 0>(x), y1),
+                                                        mul(swizzle<2, 2, 1, 1>(x), y2));
+    return simd_details::add(temp, mul(swizzle<3, 3, 3, 2>(x), y3));
+}
+
+/// @brief Computes columns of the adjugate matrix from rows of the matrix.
+inline void adjugate(simd_details::float4 row0,
+                     simd_details::float4 row1,
+                     simd_details::float4 row2,
+                     simd_details::float4 row3,
+                     simd_details::float4 (&columns)[4])
+{
+    const simd_details::float4 even = simd_details::set(-0.0f, 0.0f, -0.0f, 0.0f);
+    const simd_details::float4 odd  = simd_details::set(0.0f, -0.0f, 0.0f, -0.0f);
+
+    simd_details::float4 y1, y2, y3;
+
+    subfactors(row1, row2, y1, y2, y3);
+    columns[0] = simd_details::flip_signs(cofactors(row3, y1, y2, y3), even);
+
+    subfactors(row0, row2, y1, y2, y3);
+    columns[1] = simd_details::flip_signs(cofactors(row3, y1, y2, y3), odd);
+
+    subfactors(row0, row1, y1, y2, y3);
+    columns[2] = simd_details::flip_signs(cofactors(row3, y1, y2, y3), even);
+    columns[3] = simd_details::flip_signs(cofactors(row2, y1, y2, y3), odd);
+}
+
+inline matrix<4, 4, float32> inverse(const matrix<4, 4, float32>& m)
+{
+    simd_details::float4 row0 = simd_details::load(m[0].data());
+    simd_details::float4 row1 = simd_details::load(m[1].data());
+    simd_details::float4 row2 = simd_details::load(m[2].data());
+    simd_details::float4 row3 = simd_details::load(m[3].data());
+    simd_details::transpose(row0, row1, row2, row3);
+
+    simd_details::float4 columns[4];
+    adjugate(row0, row1, row2, row3, columns);
+
+    const simd_details::float4 det = simd_details::ordered_sum(simd_details::mul(row0, columns[0]));
+
+    matrix<4, 4, float32> result;
+    for (uint32 i = 0; i < 4; ++i) {
+        simd_details::store(result[i].data(), simd_details::div(columns[i], det));
+    }
+    return result;
+}
+
+inline matrix<4, 4, float32> affine_inverse(const matrix<4, 4, float32>& value)
+{
+    using simd_details::broadcast;
+    using simd_details::mul;
+    using simd_details::swizzle;
+
+    const simd_details::float4 a = simd_details::clear_last(simd_details::load(value[0].data()));
+    const simd_details::float4 b = simd_details::clear_last(simd_details::load(value[1].data()));
+    const simd_details::float4 c = simd_details::clear_last(simd_details::load(value[2].data()));
+
+    // Rows of the 3x3 adjugate are the cross products of the columns.
+    const auto cross = [](simd_details::float4 u, simd_details::float4 v) {
+        return simd_details::sub(mul(swizzle<1, 2, 0, 3>(u), swizzle<2, 0, 1, 3>(v)),
+                                 mul(swizzle<2, 0, 1, 3>(u), swizzle<1, 2, 0, 3>(v)));
+    };
+
+    simd_details::float4 c0 = cross(b, c);
+    simd_details::float4 c1 = cross(c, a);
+    simd_details::float4 c2 = cross(a, b);
+
+    simd_details::float4 det = simd_details::add(mul(broadcast<0>(a), c0), mul(broadcast<0>(b), c1));
+    det                      = broadcast<0>(simd_details::add(det, mul(broadcast<0>(c), c2)));
+
+    simd_details::float4 c3 = simd_details::splat(0.0f);
+    simd_details::transpose(c0, c1, c2, c3);
+
+    c0 = simd_details::div(c0, det);
+    c1 = simd_details::div(c1, det);
+    c2 = simd_details::div(c2, det);
+
+    const simd_details::float4 t = simd_details::load(value[3].data());
+    c3 = simd_details::add(mul(c0, broadcast<0>(t)), mul(c1, broadcast<1>(t)));
+    c3 = simd_details::add(c3, mul(c2, broadcast<2>(t)));
+
+    matrix<4, 4, float32> result;
+    simd_details::store(result[0].data(), simd_details::clear_last(c0));
+    simd_details::store(result[1].data(), simd_details::clear_last(c1));
+    simd_details::store(result[2].data(), simd_details::clear_last(c2));
+    simd_details::store(result[3].data(), simd_details::flip_signs(c3, simd_details::splat(-0.0f)));
+    result[3][3] = 1.0f;
+    return result;
+}
+
+inline matrix<4, 4, float32> inverse_transpose(const matrix<4, 4, float32>& m)
+{
+    simd_details::float4 row0 = simd_details::load(m[0].data());
+    simd_details::float4 row1 = simd_details::load(m[1].data());
+    simd_details::float4 row2 = simd_details::load(m[2].data());
+    simd_details::float4 row3 = simd_details::load(m[3].data());
+    simd_details::transpose(row0, row1, row2, row3);
+
+    simd_details::float4 columns[4];
+    adjugate(row0, row1, row2, row3, columns);
+    simd_details::transpose(columns[0], columns[1], columns[2], columns[3]);
+
+    const simd_details::float4 det = simd_details::ordered_sum(simd_details::mul(row0, columns[0]));
+
+    matrix<4, 4, float32> result;
+    for (uint32 i = 0; i < 4; ++i) {
+        simd_details::store(result[i].data(), simd_details::div(columns[i], det));
+    }
+    return result;
+}
+/// @}
+#endif
+
 } // namespace matrix_functions_details
 
 } // namespace math
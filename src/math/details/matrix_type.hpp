@@ -3445,6 +3445,81 @@ inline const vector<R, RT> operator*(const matrix<C, R, T>& lhs, const vector<C,
 
     return temp;
 }
+
+#if defined(FRAMEWORK_MATH_SIMD)
+/// @brief Multiplication operator.
+///
+/// SIMD version, the result matches the generic implementation. If the compiler
+/// contracts multiplications and additions into FMA, the results differ
+/// by at most 4 ULP of the largest element of the column.
+///
+/// @param lhs Matrix of floating-point type.
+/// @param rhs Matrix of floating-point type.
+///
+/// @return Product of two matrices.
+inline const matrix<4, 4, float32> operator*(const matrix<4, 4, float32>& lhs,
+                                             const matrix<4, 4, float32>& rhs) noexcept
+{
+    const simd_details::float4 c0 = simd_details::load(lhs[0].data());
+    const simd_details::float4 c1 = simd_details::load(lhs[1].data());
+    const simd_details::float4 c2 = simd_details::load(lhs[2].data());
+    const simd_details::float4 c3 = simd_details::load(lhs[3].data());
+
+    matrix<4, 4, float32> temp;
+
+    for (uint32 n = 0; n < 4; ++n) {
+        const simd_details::float4 column = simd_details::load(rhs[n].data());
+        simd_details::store(temp[n].data(), simd_details::combine(c0, c1, c2, c3, column));
+    }
+
+    return temp;
+}
+
+/// @brief Multiplication operator.
+///
+/// SIMD version, the result matches the generic implementation. If the compiler
+/// contracts multiplications and additions into FMA, the results differ
+/// by at most 4 ULP of the largest element of the column.
+///
+/// @param lhs Vector of floating-point type.
+/// @param rhs Matrix of floating-point type.
+///
+/// @return Product of vector and matrix.
+inline const vector<4, float32> operator*(const vector<4, float32>& lhs, const matrix<4, 4, float32>& rhs) noexcept
+{
+    simd_details::float4 r0 = simd_details::load(rhs[0].data());
+    simd_details::float4 r1 = simd_details::load(rhs[1].data());
+    simd_details::float4 r2 = simd_details::load(rhs[2].data());
+    simd_details::float4 r3 = simd_details::load(rhs[3].data());
+    simd_details::transpose(r0, r1, r2, r3);
+
+    vector<4, float32> temp;
+    simd_details::store(temp.data(), simd_details::combine(r0, r1, r2, r3, simd_details::load(lhs.data())));
+    return temp;
+}
+
+/// @brief Multiplication operator.
+///
+/// SIMD version, the result matches the generic implementation. If the compiler
+/// contracts multiplications and additions into FMA, the results differ
+/// by at most 4 ULP of the largest element of the column.
+///
+/// @param lhs Matrix of floating-point type.
+/// @param rhs Vector of floating-point type.
+///
+/// @return Product of vector and matrix.
+inline const vector<4, float32> operator*(const matrix<4, 4, float32>& lhs, const vector<4, float32>& rhs) noexcept
+{
+    const simd_details::float4 c0 = simd_details::load(lhs[0].data());
+    const simd_details::float4 c1 = simd_details::load(lhs[1].data());
+    const simd_details::float4 c2 = simd_details::load(lhs[2].data());
+    const simd_details::float4 c3 = simd_details::load(lhs[3].data());
+
+    vector<4, float32> temp;
+    simd_details::store(temp.data(), simd_details::combine(c0, c1, c2, c3, simd_details::load(rhs.data())));
+    return temp;
+}
+#endif
 /// @}
 
 /// @name Common binary operators with matrices and scalar values.
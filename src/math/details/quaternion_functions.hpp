@@ -0,0 +1,351 @@
+/// @file
+/// @brief Contains quaternion functions.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of quaternion_functions.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_QUATERNION_FUNCTIONS_HPP
+#define FRAMEWORK_MATH_DETAILS_QUATERNION_FUNCTIONS_HPP
+
+#include <cmath>
+
+#include <common/types.hpp>
+#include <math/details/matrix_type.hpp>
+#include <math/details/quaternion_functions_details.hpp>
+#include <math/details/quaternion_type.hpp>
+#include <math/details/relational_functions.hpp>
+#include <math/details/vector_type.hpp>
+
+namespace framework
+{
+namespace math
+{
+/// @addtogroup math_quaternion_functions
+/// @{
+
+/// @name angle_axis
+/// @{
+
+/// @brief Builds a rotation quaternion from an angle and an axis.
+///
+/// The rotation is the same as of the @ref rotate matrix function.
+///
+/// @param angle Rotation angle expressed in radians.
+/// @param axis Rotation axis, should be normalized.
+///
+/// @return The unit quaternion.
+template <typename T>
+inline quaternion<T> angle_axis(const T& angle, const vector<3, T>& axis)
+{
+    const T half = angle / T{2};
+    return quaternion<T>(axis * std::sin(half), std::cos(half));
+}
+/// @}
+
+/// @name quaternion_cast
+/// @{
+
+/// @brief Converts rotation matrix to quaternion.
+///
+/// @param m Orthonormal rotation matrix.
+///
+/// @return The unit quaternion.
+template <typename T>
+inline quaternion<T> quaternion_cast(const matrix<3, 3, T>& m)
+{
+    const T trace = m[0][0] + m[1][1] + m[2][2];
+
+    // Chooses the largest of the components to keep the square root argument far from zero.
+    if (trace > T{0}) {
+        const T s = std::sqrt(trace + T{1}) * T{2};
+        return quaternion<T>((m[1][2] - m[2][1]) / s, (m[2][0] - m[0][2]) / s, (m[0][1] - m[1][0]) / s, s / T{4});
+    }
+
+    if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+        const T s = std::sqrt(T{1} + m[0][0] - m[1][1] - m[2][2]) * T{2};
+        return quaternion<T>(s / T{4}, (m[0][1] + m[1][0]) / s, (m[2][0] + m[0][2]) / s, (m[1][2] - m[2][1]) / s);
+    }
+
+    if (m[1][1] > m[2][2]) {
+        const T s = std::sqrt(T{1} + m[1][1] - m[0][0] - m[2][2]) * T{2};
+        return quaternion<T>((m[0][1] + m[1][0]) / s, s / T{4}, (m[1][2] + m[2][1]) / s, (m[2][0] - m[0][2]) / s);
+    }
+
+    const T s = std::sqrt(T{1} + m[2][2] - m[0][0] - m[1][1]) * T{2};
+    return quaternion<T>((m[2][0] + m[0][2]) / s, (m[1][2] + m[2][1]) / s, s / T{4}, (m[0][1] - m[1][0]) / s);
+}
+
+/// @brief Converts rotation part of the matrix to quaternion.
+///
+/// @param m Matrix with orthonormal upper-left 3x3 part.
+///
+/// @return The unit quaternion.
+template <typename T>
+inline quaternion<T> quaternion_cast(const matrix<4, 4, T>& m)
+{
+    return quaternion_cast(matrix<3, 3, T>(m));
+}
+/// @}
+
+/// @name matrix3_cast
+/// @{
+
+/// @brief Converts quaternion to rotation matrix.
+///
+/// @param q Unit quaternion.
+///
+/// @return The rotation matrix.
+template <typename T>
+inline matrix<3, 3, T> matrix3_cast(const quaternion<T>& q)
+{
+    const T xx = q.x * q.x;
+    const T yy = q.y * q.y;
+    const T zz = q.z * q.z;
+    const T xy = q.x * q.y;
+    const T xz = q.x * q.z;
+    const T yz = q.y * q.z;
+    const T wx = q.w * q.x;
+    const T wy = q.w * q.y;
+    const T wz = q.w * q.z;
+
+    // clang-format off
+    return matrix<3, 3, T>(T{1} - T{2} * (yy + zz), T{2} * (xy + wz),        T{2} * (xz - wy),
+                           T{2} * (xy - wz),        T{1} - T{2} * (xx + zz), T{2} * (yz + wx),
+                           T{2} * (xz + wy),        T{2} * (yz - wx),        T{1} - T{2} * (xx + yy));
+    // clang-format on
+}
+/// @}
+
+/// @name matrix4_cast
+/// @{
+
+/// @brief Converts quaternion to rotation matrix.
+///
+/// @param q Unit quaternion.
+///
+/// @return The rotation matrix.
+template <typename T>
+inline matrix<4, 4, T> matrix4_cast(const quaternion<T>& q)
+{
+    return matrix<4, 4, T>(matrix3_cast(q));
+}
+/// @}
+
+/// @name dot
+/// @{
+
+/// @brief Computes the dot product of two quaternions.
+///
+/// @param a Quaternion.
+/// @param b Quaternion.
+///
+/// @return The dot product.
+template <typename T>
+inline T dot(const quaternion<T>& a, const quaternion<T>& b)
+{
+    return quaternion_functions_details::dot(a, b);
+}
+/// @}
+
+/// @name length
+/// @{
+
+/// @brief Computes the length of the quaternion.
+///
+/// @param value Quaternion.
+///
+/// @return The length, i.e., `sqrt(dot(value, value))`.
+template <typename T>
+inline T length(const quaternion<T>& value)
+{
+    return std::sqrt(quaternion_functions_details::dot(value, value));
+}
+/// @}
+
+/// @name normalize
+/// @{
+
+/// @brief Computes the unit quaternion of the same direction.
+///
+/// @param value Quaternion with non-zero length.
+///
+/// @return The unit quaternion.
+template <typename T>
+inline quaternion<T> normalize(const quaternion<T>& value)
+{
+    return quaternion_functions_details::normalize(value);
+}
+/// @}
+
+/// @name conjugate
+/// @{
+
+/// @brief Computes the conjugate quaternion.
+///
+/// @param value Quaternion.
+///
+/// @return The quaternion with negated imaginary part.
+template <typename T>
+inline constexpr quaternion<T> conjugate(const quaternion<T>& value)
+{
+    return quaternion<T>(-value.x, -value.y, -value.z, value.w);
+}
+/// @}
+
+/// @name inverse
+/// @{
+
+/// @brief Computes the inverse quaternion.
+///
+/// For the unit quaternions it is the same as @ref conjugate.
+///
+/// @param value Quaternion with non-zero length.
+///
+/// @return The inverse quaternion.
+template <typename T>
+inline quaternion<T> inverse(const quaternion<T>& value)
+{
+    return conjugate(value) / quaternion_functions_details::dot(value, value);
+}
+/// @}
+
+/// @name rotate
+/// @{
+
+/// @brief Rotates the vector by the quaternion.
+///
+/// @param q Unit quaternion.
+/// @param v Vector to rotate.
+///
+/// @return The rotated vector.
+template <typename T>
+inline vector<3, T> rotate(const quaternion<T>& q, const vector<3, T>& v)
+{
+    return q * v;
+}
+/// @}
+
+/// @name nlerp
+/// @{
+
+/// @brief Normalized linear interpolation of the rotations.
+///
+/// Takes the shortest path. Faster than @ref slerp but the angular speed is not constant.
+///
+/// @param from Unit quaternion of the start rotation.
+/// @param to Unit quaternion of the end rotation.
+/// @param t Interpolation weight in range [0, 1].
+///
+/// @return The interpolated unit quaternion.
+template <typename T>
+inline quaternion<T> nlerp(const quaternion<T>& from, const quaternion<T>& to, const T& t)
+{
+    return quaternion_functions_details::nlerp(from, to, t);
+}
+
+/// @brief Normalized linear interpolation of the arrays of rotations.
+///
+/// @param from Unit quaternions of the start rotations.
+/// @param to Unit quaternions of the end rotations.
+/// @param count Count of the quaternions.
+/// @param t Interpolation weight in range [0, 1].
+/// @param result Receives the interpolated quaternions, may be the same array as from or to.
+template <typename T>
+inline void nlerp(const quaternion<T>* from, const quaternion<T>* to, usize count, const T& t, quaternion<T>* result)
+{
+    for (usize i = 0; i < count; ++i) {
+        result[i] = quaternion_functions_details::nlerp(from[i], to[i], t);
+    }
+}
+/// @}
+
+/// @name slerp
+/// @{
+
+/// @brief Spherical linear interpolation of the rotations.
+///
+/// Takes the shortest path with constant angular speed. Falls back to @ref nlerp
+/// if the rotations are close.
+///
+/// @param from Unit quaternion of the start rotation.
+/// @param to Unit quaternion of the end rotation.
+/// @param t Interpolation weight in range [0, 1].
+///
+/// @return The interpolated unit quaternion.
+template <typename T>
+inline quaternion<T> slerp(const quaternion<T>& from, const quaternion<T>& to, const T& t)
+{
+    return quaternion_functions_details::slerp(from, to, t);
+}
+
+/// @brief Spherical linear interpolation of the arrays of rotations.
+///
+/// @param from Unit quaternions of the start rotations.
+/// @param to Unit quaternions of the end rotations.
+/// @param count Count of the quaternions.
+/// @param t Interpolation weight in range [0, 1].
+/// @param result Receives the interpolated quaternions, may be the same array as from or to.
+template <typename T>
+inline void slerp(const quaternion<T>* from, const quaternion<T>* to, usize count, const T& t, quaternion<T>* result)
+{
+    for (usize i = 0; i < count; ++i) {
+        result[i] = quaternion_functions_details::slerp(from[i], to[i], t);
+    }
+}
+/// @}
+
+/// @name almost_equal
+/// @{
+
+/// @brief Compares elements of two quaternions with desired precision.
+///
+/// The machine epsilon scaled to the magnitude of the values used and
+/// multiplied by the desired precision in ULPs (units in the last place) unless the result is subnormal.
+///
+/// @param a Floating-point quaternion.
+/// @param b Floating-point quaternion.
+/// @param ulp Units in the last place.
+///
+/// @return `true` if provided quaternions are equal, `false` otherwise.
+template <typename T>
+inline bool almost_equal(const quaternion<T>& a, const quaternion<T>& b, int32 ulp = 0)
+{
+    return almost_equal(a.x, b.x, ulp) && almost_equal(a.y, b.y, ulp) && almost_equal(a.z, b.z, ulp) &&
+           almost_equal(a.w, b.w, ulp);
+}
+/// @}
+
+/// @}
+
+} // namespace math
+
+} // namespace framework
+
+#endif
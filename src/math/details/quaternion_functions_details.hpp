@@ -0,0 +1,183 @@
+/// @file
+/// @brief Contains quaternion functions.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of quaternion_functions_details.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_QUATERNION_FUNCTIONS_DETAILS_HPP
+#define FRAMEWORK_MATH_DETAILS_QUATERNION_FUNCTIONS_DETAILS_HPP
+
+#include <cmath>
+
+#include <common/types.hpp>
+#include <math/details/quaternion_type.hpp>
+#include <math/details/simd_details.hpp>
+
+namespace framework
+{
+namespace math
+{
+namespace quaternion_functions_details
+{
+/// @brief Cosine of the angle between quaternions above which slerp falls back to nlerp.
+template <typename T>
+constexpr T slerp_threshold = T{0.9995};
+
+/// @brief Realization of dot function.
+/// @{
+template <typename T>
+inline T dot(const quaternion<T>& a, const quaternion<T>& b)
+{
+    return (a.x * b.x) + (a.y * b.y) + (a.z * b.z) + (a.w * b.w);
+}
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline float32 dot(const quaternion<float32>& a, const quaternion<float32>& b) noexcept
+{
+    return simd_details::first(simd_details::dot(simd_details::load(a.data()), simd_details::load(b.data())));
+}
+#endif
+/// @}
+
+/// @brief Realization of normalize function.
+/// @{
+template <typename T>
+inline quaternion<T> normalize(const quaternion<T>& value)
+{
+    return value * (T{1} / std::sqrt(quaternion_functions_details::dot(value, value)));
+}
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline quaternion<float32> normalize(const quaternion<float32>& value) noexcept
+{
+    const simd_details::float4 q     = simd_details::load(value.data());
+    const simd_details::float4 scale = simd_details::div(simd_details::splat(1.0f),
+                                                         simd_details::sqrt(simd_details::dot(q, q)));
+
+    quaternion<float32> result;
+    simd_details::store(result.data(), simd_details::mul(q, scale));
+    return result;
+}
+#endif
+/// @}
+
+/// @brief Realization of nlerp function.
+/// @{
+template <typename T>
+inline quaternion<T> nlerp(const quaternion<T>& from, const quaternion<T>& to, T t)
+{
+    const quaternion<T> target = quaternion_functions_details::dot(from, to) < T{0} ? -to : to;
+    return quaternion_functions_details::normalize(from + (target - from) * t);
+}
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline quaternion<float32> nlerp(const quaternion<float32>& from, const quaternion<float32>& to, float32 t) noexcept
+{
+    const simd_details::float4 a = simd_details::load(from.data());
+    const simd_details::float4 b = simd_details::load(to.data());
+
+    // Takes the shortest path by flipping the target if the dot product is negative.
+    const simd_details::float4 sign   = simd_details::negative_signs(simd_details::dot(a, b));
+    const simd_details::float4 target = simd_details::flip_signs(b, sign);
+    const simd_details::float4 value  = simd_details::add(a, simd_details::mul(simd_details::sub(target, a),
+                                                                                simd_details::splat(t)));
+    const simd_details::float4 scale  = simd_details::div(simd_details::splat(1.0f),
+                                                         simd_details::sqrt(simd_details::dot(value, value)));
+
+    quaternion<float32> result;
+    simd_details::store(result.data(), simd_details::mul(value, scale));
+    return result;
+}
+#endif
+/// @}
+
+/// @brief Realization of slerp function.
+/// @{
+template <typename T>
+inline quaternion<T> slerp(const quaternion<T>& from, const quaternion<T>& to, T t)
+{
+    T cos_theta          = quaternion_functions_details::dot(from, to);
+    quaternion<T> target = to;
+
+    if (cos_theta < T{0}) {
+        cos_theta = -cos_theta;
+        target    = -to;
+    }
+
+    if (cos_theta > slerp_threshold<T>) {
+        return quaternion_functions_details::normalize(from + (target - from) * t);
+    }
+
+    const T theta     = std::acos(cos_theta);
+    const T sin_theta = std::sin(theta);
+
+    return from * (std::sin((T{1} - t) * theta) / sin_theta) + target * (std::sin(t * theta) / sin_theta);
+}
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline quaternion<float32> slerp(const quaternion<float32>& from, const quaternion<float32>& to, float32 t) noexcept
+{
+    const simd_details::float4 a = simd_details::load(from.data());
+    const simd_details::float4 b = simd_details::load(to.data());
+
+    const simd_details::float4 cos_dot = simd_details::dot(a, b);
+    const simd_details::float4 target  = simd_details::flip_signs(b, simd_details::negative_signs(cos_dot));
+    const float32 cos_theta            = std::abs(simd_details::first(cos_dot));
+
+    simd_details::float4 value;
+    if (cos_theta > slerp_threshold<float32>) {
+        value = simd_details::add(a, simd_details::mul(simd_details::sub(target, a), simd_details::splat(t)));
+        value = simd_details::mul(value,
+                                  simd_details::div(simd_details::splat(1.0f),
+                                                    simd_details::sqrt(simd_details::dot(value, value))));
+    } else {
+        const float32 theta     = std::acos(cos_theta);
+        const float32 sin_theta = std::sin(theta);
+
+        const simd_details::float4 from_weight = simd_details::splat(std::sin((1.0f - t) * theta) / sin_theta);
+        const simd_details::float4 to_weight   = simd_details::splat(std::sin(t * theta) / sin_theta);
+
+        value = simd_details::add(simd_details::mul(a, from_weight), simd_details::mul(target, to_weight));
+    }
+
+    quaternion<float32> result;
+    simd_details::store(result.data(), value);
+    return result;
+}
+#endif
+/// @}
+
+} // namespace quaternion_functions_details
+
+} // namespace math
+
+} // namespace framework
+
+#endif
@@ -0,0 +1,503 @@
+/// @file
+/// @brief Contains quaternion type.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of quaternion_type.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_QUATERNION_TYPE_HPP
+#define FRAMEWORK_MATH_DETAILS_QUATERNION_TYPE_HPP
+
+#include <cassert>
+#include <type_traits>
+
+#include <common/types.hpp>
+#include <math/details/simd_details.hpp>
+#include <math/details/vector_type.hpp>
+#include <math/details/vector_type_details.hpp>
+
+namespace framework
+{
+namespace math
+{
+/// @addtogroup math_quaternion_implementation
+/// @{
+
+/// @brief Quaternion type.
+///
+/// Stores the imaginary part in x, y, z and the real part in w components.
+/// Has the same layout as vector<4, T>, float32 quaternion operations use SIMD instructions@n
+/// if `FRAMEWORK_MATH_SIMD` is defined.
+///
+/// @note Can be instantiated only with floating-point type.
+template <typename T>
+struct quaternion final
+{
+    static_assert(std::is_floating_point<T>::value, "Expected floating-point type.");
+
+    using value_type = T; ///< Value type
+
+    /// @brief Default constructor.
+    ///
+    /// Initializes identity quaternion {0, 0, 0, 1}.
+    constexpr quaternion() noexcept;
+
+    /// @brief Initializes quaternion with provided values.
+    ///
+    /// @param x_value Value for x component.
+    /// @param y_value Value for y component.
+    /// @param z_value Value for z component.
+    /// @param w_value Value for w component.
+    constexpr quaternion(const T& x_value, const T& y_value, const T& z_value, const T& w_value) noexcept;
+
+    /// @brief Initializes quaternion from the imaginary and the real parts.
+    ///
+    /// @param imaginary Vector to initialize x, y and z components.
+    /// @param real Value for w component.
+    constexpr quaternion(const vector<3, T>& imaginary, const T& real) noexcept;
+
+    /// @brief Initializes quaternion from vector of 4 components.
+    ///
+    /// @param other Vector to initialize x, y, z and w components.
+    explicit constexpr quaternion(const vector<4, T>& other) noexcept;
+
+    /// @brief Access operator.
+    ///
+    /// @param index Index of component.
+    ///
+    /// @return Reference to component of quaternion.
+    ///
+    /// @warning There is no size check. May cause memory access error.
+    value_type& operator[](uint32 index);
+
+    /// @brief Const access operator.
+    ///
+    /// @param index Index of component.
+    ///
+    /// @return Reference to constant component of quaternion.
+    ///
+    /// @warning There is no size check. May cause memory access error.
+    const value_type& operator[](uint32 index) const;
+
+    /// @brief Size of quaternion.
+    ///
+    /// @return Count of components in quaternion.
+    constexpr uint32 size() const noexcept;
+
+    /// @brief Provides direct access to internal content.
+    ///
+    /// @return A pointer to the x component.
+    value_type* data() noexcept;
+
+    /// @brief Provides direct access to internal content.
+    ///
+    /// @return A pointer to the x component.
+    const value_type* data() const noexcept;
+
+    value_type x; ///< The x component.
+    value_type y; ///< The y component.
+    value_type z; ///< The z component.
+    value_type w; ///< The w component.
+};
+
+/// @name Quaternion assign operators.
+/// @{
+
+/// @brief Addition assignment operator.
+///
+/// @param lhs Quaternion to add to.
+/// @param rhs Quaternion to add.
+///
+/// @return Reference to lhs.
+template <typename T>
+inline quaternion<T>& operator+=(quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Subtraction assignment operator.
+///
+/// @param lhs Quaternion to subtract from.
+/// @param rhs Quaternion to subtract.
+///
+/// @return Reference to lhs.
+template <typename T>
+inline quaternion<T>& operator-=(quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Multiplication assignment operator.
+///
+/// @param lhs Quaternion to multiply.
+/// @param rhs Quaternion to multiply by.
+///
+/// @return Reference to lhs, which contains Hamilton product `lhs * rhs`.
+template <typename T>
+inline quaternion<T>& operator*=(quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Multiplication assignment operator.
+///
+/// @param lhs Quaternion to multiply.
+/// @param rhs Scalar value to multiply by.
+///
+/// @return Reference to lhs.
+template <typename T>
+inline quaternion<T>& operator*=(quaternion<T>& lhs, const T& rhs) noexcept;
+
+/// @brief Division assignment operator.
+///
+/// @param lhs Quaternion to divide.
+/// @param rhs Scalar value to divide by.
+///
+/// @return Reference to lhs.
+template <typename T>
+inline quaternion<T>& operator/=(quaternion<T>& lhs, const T& rhs) noexcept;
+/// @}
+
+/// @name Quaternion operators.
+/// @{
+
+/// @brief Unary plus operator.
+///
+/// @param value Quaternion.
+///
+/// @return Copy of the quaternion.
+template <typename T>
+inline constexpr quaternion<T> operator+(const quaternion<T>& value) noexcept;
+
+/// @brief Unary minus operator.
+///
+/// @param value Quaternion.
+///
+/// @return Negated quaternion.
+template <typename T>
+inline constexpr quaternion<T> operator-(const quaternion<T>& value) noexcept;
+
+/// @brief Addition operator.
+///
+/// @param lhs Quaternion.
+/// @param rhs Quaternion.
+///
+/// @return Component-wise sum of quaternions.
+template <typename T>
+inline quaternion<T> operator+(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Subtraction operator.
+///
+/// @param lhs Quaternion.
+/// @param rhs Quaternion.
+///
+/// @return Component-wise difference of quaternions.
+template <typename T>
+inline quaternion<T> operator-(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Multiplication operator.
+///
+/// The product is the rotation rhs followed by the rotation lhs.
+///
+/// @param lhs Quaternion.
+/// @param rhs Quaternion.
+///
+/// @return Hamilton product of quaternions.
+template <typename T>
+inline quaternion<T> operator*(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Multiplication operator.
+///
+/// @param lhs Quaternion.
+/// @param rhs Scalar value.
+///
+/// @return Quaternion multiplied by scalar.
+template <typename T>
+inline quaternion<T> operator*(const quaternion<T>& lhs, const T& rhs) noexcept;
+
+/// @brief Multiplication operator.
+///
+/// @param lhs Scalar value.
+/// @param rhs Quaternion.
+///
+/// @return Quaternion multiplied by scalar.
+template <typename T>
+inline quaternion<T> operator*(const T& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Division operator.
+///
+/// @param lhs Quaternion.
+/// @param rhs Scalar value.
+///
+/// @return Quaternion divided by scalar.
+template <typename T>
+inline quaternion<T> operator/(const quaternion<T>& lhs, const T& rhs) noexcept;
+
+/// @brief Rotates vector by the unit quaternion.
+///
+/// @param lhs Unit quaternion.
+/// @param rhs Vector.
+///
+/// @return Rotated vector.
+template <typename T>
+inline vector<3, T> operator*(const quaternion<T>& lhs, const vector<3, T>& rhs) noexcept;
+
+/// @brief Equality operator.
+///
+/// @param lhs Quaternion.
+/// @param rhs Quaternion.
+///
+/// @return `true` if all components are equal.
+template <typename T>
+inline constexpr bool operator==(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+
+/// @brief Inequality operator.
+///
+/// @param lhs Quaternion.
+/// @param rhs Quaternion.
+///
+/// @return `true` if any component differs.
+template <typename T>
+inline constexpr bool operator!=(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept;
+/// @}
+
+/// @}
+
+#pragma region definitions
+
+template <typename T>
+inline constexpr quaternion<T>::quaternion() noexcept : x{0}, y{0}, z{0}, w{1}
+{}
+
+template <typename T>
+inline constexpr quaternion<T>::quaternion(const T& x_value,
+                                           const T& y_value,
+                                           const T& z_value,
+                                           const T& w_value) noexcept
+    : x{x_value}, y{y_value}, z{z_value}, w{w_value}
+{}
+
+template <typename T>
+inline constexpr quaternion<T>::quaternion(const vector<3, T>& imaginary, const T& real) noexcept
+    : x{imaginary.x}, y{imaginary.y}, z{imaginary.z}, w{real}
+{}
+
+template <typename T>
+inline constexpr quaternion<T>::quaternion(const vector<4, T>& other) noexcept
+    : x{other.x}, y{other.y}, z{other.z}, w{other.w}
+{}
+
+template <typename T>
+inline T& quaternion<T>::operator[](uint32 index)
+{
+    assert(index < size());
+    return data()[index];
+}
+
+template <typename T>
+inline const T& quaternion<T>::operator[](uint32 index) const
+{
+    assert(index < size());
+    return data()[index];
+}
+
+template <typename T>
+inline constexpr uint32 quaternion<T>::size() const noexcept
+{
+    return 4;
+}
+
+template <typename T>
+inline T* quaternion<T>::data() noexcept
+{
+    return &x;
+}
+
+template <typename T>
+inline const T* quaternion<T>::data() const noexcept
+{
+    return &x;
+}
+
+template <typename T>
+inline quaternion<T>& operator+=(quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    lhs.x += rhs.x;
+    lhs.y += rhs.y;
+    lhs.z += rhs.z;
+    lhs.w += rhs.w;
+    return lhs;
+}
+
+template <typename T>
+inline quaternion<T>& operator-=(quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    lhs.x -= rhs.x;
+    lhs.y -= rhs.y;
+    lhs.z -= rhs.z;
+    lhs.w -= rhs.w;
+    return lhs;
+}
+
+template <typename T>
+inline quaternion<T>& operator*=(quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    return lhs = lhs * rhs;
+}
+
+template <typename T>
+inline quaternion<T>& operator*=(quaternion<T>& lhs, const T& rhs) noexcept
+{
+    lhs.x *= rhs;
+    lhs.y *= rhs;
+    lhs.z *= rhs;
+    lhs.w *= rhs;
+    return lhs;
+}
+
+template <typename T>
+inline quaternion<T>& operator/=(quaternion<T>& lhs, const T& rhs) noexcept
+{
+    lhs.x /= rhs;
+    lhs.y /= rhs;
+    lhs.z /= rhs;
+    lhs.w /= rhs;
+    return lhs;
+}
+
+template <typename T>
+inline constexpr quaternion<T> operator+(const quaternion<T>& value) noexcept
+{
+    return value;
+}
+
+template <typename T>
+inline constexpr quaternion<T> operator-(const quaternion<T>& value) noexcept
+{
+    return quaternion<T>(-value.x, -value.y, -value.z, -value.w);
+}
+
+template <typename T>
+inline quaternion<T> operator+(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    quaternion<T> temp{lhs};
+    return temp += rhs;
+}
+
+template <typename T>
+inline quaternion<T> operator-(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    quaternion<T> temp{lhs};
+    return temp -= rhs;
+}
+
+template <typename T>
+inline quaternion<T> operator*(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    // The order of operations matches the SIMD version.
+    return quaternion<T>(lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+                         lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+                         lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w,
+                         lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z);
+}
+
+#if defined(FRAMEWORK_MATH_SSE2)
+inline quaternion<float32> operator*(const quaternion<float32>& lhs, const quaternion<float32>& rhs) noexcept
+{
+    using simd_details::broadcast;
+    using simd_details::flip_signs;
+    using simd_details::mul;
+    using simd_details::swizzle;
+
+    const simd_details::float4 a = simd_details::load(lhs.data());
+    const simd_details::float4 b = simd_details::load(rhs.data());
+
+    const simd_details::float4 b_wzyx = flip_signs(swizzle<3, 2, 1, 0>(b), simd_details::set(0.0f, -0.0f, 0.0f, -0.0f));
+    const simd_details::float4 b_zwxy = flip_signs(swizzle<2, 3, 0, 1>(b), simd_details::set(0.0f, 0.0f, -0.0f, -0.0f));
+    const simd_details::float4 b_yxwz = flip_signs(swizzle<1, 0, 3, 2>(b), simd_details::set(-0.0f, 0.0f, 0.0f, -0.0f));
+
+    simd_details::float4 result = mul(broadcast<3>(a), b);
+    result                      = simd_details::add(result, mul(broadcast<0>(a), b_wzyx));
+    result                      = simd_details::add(result, mul(broadcast<1>(a), b_zwxy));
+    result                      = simd_details::add(result, mul(broadcast<2>(a), b_yxwz));
+
+    quaternion<float32> temp;
+    simd_details::store(temp.data(), result);
+    return temp;
+}
+#endif
+
+template <typename T>
+inline quaternion<T> operator*(const quaternion<T>& lhs, const T& rhs) noexcept
+{
+    quaternion<T> temp{lhs};
+    return temp *= rhs;
+}
+
+template <typename T>
+inline quaternion<T> operator*(const T& lhs, const quaternion<T>& rhs) noexcept
+{
+    quaternion<T> temp{rhs};
+    return temp *= lhs;
+}
+
+template <typename T>
+inline quaternion<T> operator/(const quaternion<T>& lhs, const T& rhs) noexcept
+{
+    quaternion<T> temp{lhs};
+    return temp /= rhs;
+}
+
+template <typename T>
+inline vector<3, T> operator*(const quaternion<T>& lhs, const vector<3, T>& rhs) noexcept
+{
+    // v' = v + w * t + cross(q, t), where t = 2 * cross(q, v).
+    const vector<3, T> imaginary(lhs.x, lhs.y, lhs.z);
+
+    const vector<3, T> t(T{2} * (imaginary.y * rhs.z - rhs.y * imaginary.z),
+                         T{2} * (imaginary.z * rhs.x - rhs.z * imaginary.x),
+                         T{2} * (imaginary.x * rhs.y - rhs.x * imaginary.y));
+
+    return rhs + t * lhs.w +
+           vector<3, T>(imaginary.y * t.z - t.y * imaginary.z,
+                        imaginary.z * t.x - t.z * imaginary.x,
+                        imaginary.x * t.y - t.x * imaginary.y);
+}
+
+template <typename T>
+inline constexpr bool operator==(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    using vector_type_details::equals;
+    return equals(lhs.x, rhs.x) && equals(lhs.y, rhs.y) && equals(lhs.z, rhs.z) && equals(lhs.w, rhs.w);
+}
+
+template <typename T>
+inline constexpr bool operator!=(const quaternion<T>& lhs, const quaternion<T>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+#pragma endregion
+
+} // namespace math
+
+} // namespace framework
+
+#endif
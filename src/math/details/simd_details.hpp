@@ -0,0 +1,493 @@
+/// @file
+/// @brief SIMD backend of the math types.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of simd_details.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_SIMD_DETAILS_HPP
+#define FRAMEWORK_MATH_DETAILS_SIMD_DETAILS_HPP
+
+#include <common/types.hpp>
+
+#if !defined(FRAMEWORK_MATH_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FRAMEWORK_MATH_SSE2
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define FRAMEWORK_MATH_SSSE3
+#endif
+#if defined(__SSE4_1__) || defined(__AVX__)
+#include <smmintrin.h>
+#define FRAMEWORK_MATH_SSE41
+#endif
+#if defined(__FMA__) || defined(__AVX2__)
+#include <immintrin.h>
+#define FRAMEWORK_MATH_FMA
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define FRAMEWORK_MATH_NEON
+#endif
+#endif
+
+#if defined(FRAMEWORK_MATH_SSE2) || defined(FRAMEWORK_MATH_NEON)
+/// @brief Defined if vector<4, float32> and vector<4, int32> operations use SIMD instructions.
+///
+/// Define `FRAMEWORK_MATH_NO_SIMD` to use the generic scalar implementation.
+#define FRAMEWORK_MATH_SIMD
+#endif
+
+#if defined(FRAMEWORK_MATH_SIMD)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+/// @brief Defined if constexpr functions can switch to SIMD instructions outside of constant evaluation.
+///
+/// Otherwise constexpr functions keep the generic scalar implementation.
+#define FRAMEWORK_MATH_SIMD_CONSTEXPR
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#define FRAMEWORK_MATH_SIMD_CONSTEXPR
+#endif
+#endif
+
+namespace framework::math::simd_details
+{
+/// @brief Checks whether the call occurs within a constant-evaluated context.
+constexpr bool is_constant_evaluated() noexcept
+{
+#if defined(FRAMEWORK_MATH_SIMD_CONSTEXPR)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+#if defined(FRAMEWORK_MATH_SSE2)
+
+using float4 = __m128;  ///< 4 float32 values.
+using int4   = __m128i; ///< 4 int32 values.
+
+/// @name float4 operations.
+/// @{
+inline float4 load(const float32* data) noexcept
+{
+    return _mm_loadu_ps(data);
+}
+
+inline void store(float32* data, float4 value) noexcept
+{
+    _mm_storeu_ps(data, value);
+}
+
+/// @brief Stores the first three lanes.
+inline void store3(float32* data, float4 value) noexcept
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(data), value);
+    _mm_store_ss(data + 2, _mm_movehl_ps(value, value));
+}
+
+inline float4 splat(float32 value) noexcept
+{
+    return _mm_set1_ps(value);
+}
+
+inline float4 set(float32 x, float32 y, float32 z, float32 w) noexcept
+{
+    return _mm_setr_ps(x, y, z, w);
+}
+
+inline float4 add(float4 a, float4 b) noexcept
+{
+    return _mm_add_ps(a, b);
+}
+
+inline float4 sub(float4 a, float4 b) noexcept
+{
+    return _mm_sub_ps(a, b);
+}
+
+inline float4 mul(float4 a, float4 b) noexcept
+{
+    return _mm_mul_ps(a, b);
+}
+
+inline float4 div(float4 a, float4 b) noexcept
+{
+    return _mm_div_ps(a, b);
+}
+
+inline float4 sqrt(float4 value) noexcept
+{
+    return _mm_sqrt_ps(value);
+}
+
+inline float4 min(float4 a, float4 b) noexcept
+{
+    return _mm_min_ps(a, b);
+}
+
+inline float4 max(float4 a, float4 b) noexcept
+{
+    return _mm_max_ps(a, b);
+}
+
+inline float4 abs(float4 value) noexcept
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+}
+
+/// @brief Computes `a * b + c`, fused if the target supports FMA.
+inline float4 fma(float4 a, float4 b, float4 c) noexcept
+{
+#if defined(FRAMEWORK_MATH_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+/// @brief Computes dot product and stores it in all lanes.
+inline float4 dot(float4 a, float4 b) noexcept
+{
+#if defined(FRAMEWORK_MATH_SSE41)
+    return _mm_dp_ps(a, b, 0xFF);
+#else
+    const float4 product = _mm_mul_ps(a, b);
+    const float4 pairs   = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+#endif
+}
+
+inline float32 first(float4 value) noexcept
+{
+    return _mm_cvtss_f32(value);
+}
+
+/// @brief Copies the lane to all lanes.
+template <int32 I>
+inline float4 broadcast(float4 value) noexcept
+{
+    return _mm_shuffle_ps(value, value, _MM_SHUFFLE(I, I, I, I));
+}
+
+/// @brief Creates vector of the lanes `(value[X], value[Y], value[Z], value[W])`.
+template <int32 X, int32 Y, int32 Z, int32 W>
+inline float4 swizzle(float4 value) noexcept
+{
+    return _mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+/// @brief Flips signs of the lanes where the mask has the sign bit set.
+inline float4 flip_signs(float4 value, float4 mask) noexcept
+{
+    return _mm_xor_ps(value, mask);
+}
+
+/// @brief Creates mask with the sign bit set in the lanes which are less than zero.
+inline float4 negative_signs(float4 value) noexcept
+{
+    return _mm_and_ps(_mm_cmplt_ps(value, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+}
+
+/// @brief Sets the last lane to zero.
+inline float4 clear_last(float4 value) noexcept
+{
+    return _mm_and_ps(value, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+}
+
+/// @brief Computes `((v[0] + v[1]) + v[2]) + v[3]` in the scalar order and stores it in all lanes.
+inline float4 ordered_sum(float4 value) noexcept
+{
+    float4 sum = _mm_add_ss(value, broadcast<1>(value));
+    sum        = _mm_add_ss(sum, broadcast<2>(value));
+    sum        = _mm_add_ss(sum, broadcast<3>(value));
+    return broadcast<0>(sum);
+}
+
+/// @brief Transposes 4x4 matrix stored as 4 vectors.
+inline void transpose(float4& c0, float4& c1, float4& c2, float4& c3) noexcept
+{
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+}
+/// @}
+
+/// @name int4 operations.
+/// @{
+inline int4 load(const int32* data) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+inline void store(int32* data, int4 value) noexcept
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+}
+
+inline int4 splat(int32 value) noexcept
+{
+    return _mm_set1_epi32(value);
+}
+
+inline int4 add(int4 a, int4 b) noexcept
+{
+    return _mm_add_epi32(a, b);
+}
+
+inline int4 sub(int4 a, int4 b) noexcept
+{
+    return _mm_sub_epi32(a, b);
+}
+
+inline int4 mul(int4 a, int4 b) noexcept
+{
+#if defined(FRAMEWORK_MATH_SSE41)
+    return _mm_mullo_epi32(a, b);
+#else
+    const int4 even = _mm_mul_epu32(a, b);
+    const int4 odd  = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+
+inline int4 min(int4 a, int4 b) noexcept
+{
+#if defined(FRAMEWORK_MATH_SSE41)
+    return _mm_min_epi32(a, b);
+#else
+    const int4 less = _mm_cmplt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(less, a), _mm_andnot_si128(less, b));
+#endif
+}
+
+inline int4 max(int4 a, int4 b) noexcept
+{
+#if defined(FRAMEWORK_MATH_SSE41)
+    return _mm_max_epi32(a, b);
+#else
+    const int4 greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+#endif
+}
+
+inline int4 abs(int4 value) noexcept
+{
+#if defined(FRAMEWORK_MATH_SSSE3)
+    return _mm_abs_epi32(value);
+#else
+    const int4 sign = _mm_srai_epi32(value, 31);
+    return _mm_sub_epi32(_mm_xor_si128(value, sign), sign);
+#endif
+}
+/// @}
+
+#elif defined(FRAMEWORK_MATH_NEON)
+
+using float4 = float32x4_t; ///< 4 float32 values.
+using int4   = int32x4_t;   ///< 4 int32 values.
+
+/// @name float4 operations.
+/// @{
+inline float4 load(const float32* data) noexcept
+{
+    return vld1q_f32(data);
+}
+
+inline void store(float32* data, float4 value) noexcept
+{
+    vst1q_f32(data, value);
+}
+
+/// @brief Stores the first three lanes.
+inline void store3(float32* data, float4 value) noexcept
+{
+    vst1_f32(data, vget_low_f32(value));
+    vst1q_lane_f32(data + 2, value, 2);
+}
+
+inline float4 splat(float32 value) noexcept
+{
+    return vdupq_n_f32(value);
+}
+
+inline float4 add(float4 a, float4 b) noexcept
+{
+    return vaddq_f32(a, b);
+}
+
+inline float4 sub(float4 a, float4 b) noexcept
+{
+    return vsubq_f32(a, b);
+}
+
+inline float4 mul(float4 a, float4 b) noexcept
+{
+    return vmulq_f32(a, b);
+}
+
+inline float4 div(float4 a, float4 b) noexcept
+{
+    return vdivq_f32(a, b);
+}
+
+inline float4 sqrt(float4 value) noexcept
+{
+    return vsqrtq_f32(value);
+}
+
+inline float4 min(float4 a, float4 b) noexcept
+{
+    return vminq_f32(a, b);
+}
+
+inline float4 max(float4 a, float4 b) noexcept
+{
+    return vmaxq_f32(a, b);
+}
+
+inline float4 abs(float4 value) noexcept
+{
+    return vabsq_f32(value);
+}
+
+/// @brief Computes `a * b + c` in one instruction.
+inline float4 fma(float4 a, float4 b, float4 c) noexcept
+{
+    return vfmaq_f32(c, a, b);
+}
+
+/// @brief Computes dot product and stores it in all lanes.
+inline float4 dot(float4 a, float4 b) noexcept
+{
+    return vdupq_n_f32(vaddvq_f32(vmulq_f32(a, b)));
+}
+
+inline float32 first(float4 value) noexcept
+{
+    return vgetq_lane_f32(value, 0);
+}
+
+/// @brief Copies the lane to all lanes.
+template <int32 I>
+inline float4 broadcast(float4 value) noexcept
+{
+    return vdupq_laneq_f32(value, I);
+}
+
+/// @brief Flips signs of the lanes where the mask has the sign bit set.
+inline float4 flip_signs(float4 value, float4 mask) noexcept
+{
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(value), vreinterpretq_u32_f32(mask)));
+}
+
+/// @brief Creates mask with the sign bit set in the lanes which are less than zero.
+inline float4 negative_signs(float4 value) noexcept
+{
+    return vreinterpretq_f32_u32(vandq_u32(vcltq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_u32(0x80000000u)));
+}
+
+/// @brief Transposes 4x4 matrix stored as 4 vectors.
+inline void transpose(float4& c0, float4& c1, float4& c2, float4& c3) noexcept
+{
+    const float32x4x2_t t01 = vtrnq_f32(c0, c1);
+    const float32x4x2_t t23 = vtrnq_f32(c2, c3);
+
+    c0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    c1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    c2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    c3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+/// @}
+
+/// @name int4 operations.
+/// @{
+inline int4 load(const int32* data) noexcept
+{
+    return vld1q_s32(data);
+}
+
+inline void store(int32* data, int4 value) noexcept
+{
+    vst1q_s32(data, value);
+}
+
+inline int4 splat(int32 value) noexcept
+{
+    return vdupq_n_s32(value);
+}
+
+inline int4 add(int4 a, int4 b) noexcept
+{
+    return vaddq_s32(a, b);
+}
+
+inline int4 sub(int4 a, int4 b) noexcept
+{
+    return vsubq_s32(a, b);
+}
+
+inline int4 mul(int4 a, int4 b) noexcept
+{
+    return vmulq_s32(a, b);
+}
+
+inline int4 min(int4 a, int4 b) noexcept
+{
+    return vminq_s32(a, b);
+}
+
+inline int4 max(int4 a, int4 b) noexcept
+{
+    return vmaxq_s32(a, b);
+}
+
+inline int4 abs(int4 value) noexcept
+{
+    return vabsq_s32(value);
+}
+/// @}
+
+#endif
+
+#if defined(FRAMEWORK_MATH_SIMD)
+/// @brief Computes `((c0 * w[0] + c1 * w[1]) + c2 * w[2]) + c3 * w[3]` in the scalar order.
+inline float4 combine(float4 c0, float4 c1, float4 c2, float4 c3, float4 weights) noexcept
+{
+    float4 result = mul(c0, broadcast<0>(weights));
+    result        = add(result, mul(c1, broadcast<1>(weights)));
+    result        = add(result, mul(c2, broadcast<2>(weights)));
+    return add(result, mul(c3, broadcast<3>(weights)));
+}
+#endif
+
+} // namespace framework::math::simd_details
+
+#endif
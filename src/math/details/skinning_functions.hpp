@@ -0,0 +1,243 @@
+/// @file
+/// @brief Contains transformation, dual quaternion and skinning functions.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of skinning_functions.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_SKINNING_FUNCTIONS_HPP
+#define FRAMEWORK_MATH_DETAILS_SKINNING_FUNCTIONS_HPP
+
+#include <cmath>
+
+#include <common/parallel_details.hpp>
+#include <common/types.hpp>
+#include <math/details/dual_quaternion_type.hpp>
+#include <math/details/matrix_type.hpp>
+#include <math/details/quaternion_functions.hpp>
+#include <math/details/quaternion_type.hpp>
+#include <math/details/skinning_functions_details.hpp>
+#include <math/details/transformation_type.hpp>
+#include <math/details/vector_type.hpp>
+
+namespace framework
+{
+namespace math
+{
+/// @addtogroup math_skinning_functions
+/// @{
+
+/// @name inverse
+/// @{
+
+/// @brief Computes the inverse transformation.
+///
+/// Exact only if the scale is uniform.
+///
+/// @param value Transformation with non-zero scale.
+///
+/// @return The inverse transformation.
+template <typename T>
+inline transformation<T> inverse(const transformation<T>& value)
+{
+    const vector<3, T> scale     = T{1} / value.scale;
+    const quaternion<T> rotation = conjugate(value.rotation);
+
+    return transformation<T>(-(scale * (rotation * value.translation)), rotation, scale);
+}
+
+/// @brief Computes the inverse of the unit dual quaternion.
+///
+/// @param value Unit dual quaternion.
+///
+/// @return The inverse dual quaternion.
+template <typename T>
+inline dual_quaternion<T> inverse(const dual_quaternion<T>& value)
+{
+    return dual_quaternion<T>(conjugate(value.real), conjugate(value.dual));
+}
+/// @}
+
+/// @name normalize
+/// @{
+
+/// @brief Computes the unit dual quaternion.
+///
+/// Scales both parts to the unit real part and makes the dual part orthogonal to it.
+///
+/// @param value Dual quaternion with non-zero real part.
+///
+/// @return The unit dual quaternion.
+template <typename T>
+inline dual_quaternion<T> normalize(const dual_quaternion<T>& value)
+{
+    const T scale            = T{1} / length(value.real);
+    const quaternion<T> real = value.real * scale;
+    const quaternion<T> dual = value.dual * scale;
+
+    return dual_quaternion<T>(real, dual - real * dot(real, dual));
+}
+/// @}
+
+/// @name dual_quaternion_cast
+/// @{
+
+/// @brief Converts transformation to dual quaternion.
+///
+/// The scale is ignored.
+///
+/// @param value Transformation.
+///
+/// @return The dual quaternion with the same rotation and translation.
+template <typename T>
+inline dual_quaternion<T> dual_quaternion_cast(const transformation<T>& value)
+{
+    return dual_quaternion<T>(value.rotation, value.translation);
+}
+/// @}
+
+/// @name matrix4_cast
+/// @{
+
+/// @brief Converts transformation to matrix.
+///
+/// @param value Transformation.
+///
+/// @return The matrix equal to `translate * rotate * scale`.
+template <typename T>
+inline matrix<4, 4, T> matrix4_cast(const transformation<T>& value)
+{
+    const matrix<3, 3, T> rotation = matrix3_cast(value.rotation);
+
+    return matrix<4, 4, T>(vector<4, T>(rotation[0] * value.scale[0], T{0}),
+                           vector<4, T>(rotation[1] * value.scale[1], T{0}),
+                           vector<4, T>(rotation[2] * value.scale[2], T{0}),
+                           vector<4, T>(value.translation, T{1}));
+}
+
+/// @brief Converts unit dual quaternion to matrix.
+///
+/// @param value Unit dual quaternion.
+///
+/// @return The matrix equal to `translate * rotate`.
+template <typename T>
+inline matrix<4, 4, T> matrix4_cast(const dual_quaternion<T>& value)
+{
+    matrix<4, 4, T> result = matrix4_cast(value.real);
+    result[3]              = vector<4, T>(value * vector<3, T>{0}, T{1});
+    return result;
+}
+/// @}
+
+/// @name linear_blend_skinning
+/// @{
+
+/// @brief Transforms array of points by weighted sums of the bone matrices.
+///
+/// Each point is affected by four bones, weights of unused bones should be zero.
+/// Arrays larger than a few tens of thousands of points may be split between threads.
+///
+/// @param bones Bone matrices.
+/// @param bone_indices Indices of the bones affecting each point.
+/// @param bone_weights Weights of the bones affecting each point, should sum to one.
+/// @param points Points to transform.
+/// @param count Count of the points.
+/// @param result Receives the transformed points, may be the same array as points.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void linear_blend_skinning(const matrix<4, 4, T>* bones,
+                                  const vector<4, uint32>* bone_indices,
+                                  const vector<4, T>* bone_weights,
+                                  const vector<3, T>* points,
+                                  usize count,
+                                  vector<3, T>* result,
+                                  usize thread_count = 1)
+{
+    const usize blocks_count = utils::parallel_details::count_blocks(count,
+                                                                     thread_count,
+                                                                     skinning_functions_details::parallel_block_min);
+
+    utils::parallel_details::parallel_for(count, blocks_count, [&](usize /*index*/, usize begin, usize size) {
+        skinning_functions_details::linear_blend(bones,
+                                                 bone_indices + begin,
+                                                 bone_weights + begin,
+                                                 points + begin,
+                                                 size,
+                                                 result + begin);
+    });
+}
+/// @}
+
+/// @name dual_quaternion_skinning
+/// @{
+
+/// @brief Transforms array of points by normalized weighted sums of the bone dual quaternions.
+///
+/// Each point is affected by four bones, weights of unused bones should be zero.
+/// Unlike @ref linear_blend_skinning preserves the volume near the joints.
+/// Arrays larger than a few tens of thousands of points may be split between threads.
+///
+/// @param bones Unit bone dual quaternions.
+/// @param bone_indices Indices of the bones affecting each point.
+/// @param bone_weights Weights of the bones affecting each point.
+/// @param points Points to transform.
+/// @param count Count of the points.
+/// @param result Receives the transformed points, may be the same array as points.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void dual_quaternion_skinning(const dual_quaternion<T>* bones,
+                                     const vector<4, uint32>* bone_indices,
+                                     const vector<4, T>* bone_weights,
+                                     const vector<3, T>* points,
+                                     usize count,
+                                     vector<3, T>* result,
+                                     usize thread_count = 1)
+{
+    const usize blocks_count = utils::parallel_details::count_blocks(count,
+                                                                     thread_count,
+                                                                     skinning_functions_details::parallel_block_min);
+
+    utils::parallel_details::parallel_for(count, blocks_count, [&](usize /*index*/, usize begin, usize size) {
+        skinning_functions_details::dual_quaternion_blend(bones,
+                                                          bone_indices + begin,
+                                                          bone_weights + begin,
+                                                          points + begin,
+                                                          size,
+                                                          result + begin);
+    });
+}
+/// @}
+
+/// @}
+
+} // namespace math
+
+} // namespace framework
+
+#endif
@@ -0,0 +1,183 @@
+/// @file
+/// @brief Contains details of skinning functions.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of skinning_functions_details.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_SKINNING_FUNCTIONS_DETAILS_HPP
+#define FRAMEWORK_MATH_DETAILS_SKINNING_FUNCTIONS_DETAILS_HPP
+
+#include <cmath>
+
+#include <common/types.hpp>
+#include <math/details/dual_quaternion_type.hpp>
+#include <math/details/matrix_type.hpp>
+#include <math/details/quaternion_functions_details.hpp>
+#include <math/details/simd_details.hpp>
+#include <math/details/vector_type.hpp>
+
+namespace framework::math::skinning_functions_details
+{
+/// @brief Minimal count of points processed by one thread.
+constexpr usize parallel_block_min = 64 * 1024;
+
+/// @brief Computes `vector<3, T>(blended * vector<4, T>(input[i], 1))` for each point,
+/// where blended is the weighted sum of the bone matrices.
+template <typename T>
+inline void linear_blend(const matrix<4, 4, T>* bones,
+                         const vector<4, uint32>* indices,
+                         const vector<4, T>* weights,
+                         const vector<3, T>* input,
+                         usize count,
+                         vector<3, T>* output)
+{
+    for (usize i = 0; i < count; ++i) {
+        const vector<4, uint32>& index = indices[i];
+        const vector<4, T>& weight     = weights[i];
+
+        const matrix<4, 4, T> blended = bones[index[0]] * weight[0] + bones[index[1]] * weight[1] +
+                                        bones[index[2]] * weight[2] + bones[index[3]] * weight[3];
+
+        output[i] = vector<3, T>(blended * vector<4, T>(input[i], T{1}));
+    }
+}
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline void linear_blend(const matrix<4, 4, float32>* bones,
+                         const vector<4, uint32>* indices,
+                         const vector<4, float32>* weights,
+                         const vector<3, float32>* input,
+                         usize count,
+                         vector<3, float32>* output)
+{
+    simd_details::float4 columns[4];
+
+    for (usize i = 0; i < count; ++i) {
+        const vector<4, uint32>& index    = indices[i];
+        const simd_details::float4 weight = simd_details::load(weights[i].data());
+
+        const matrix<4, 4, float32>& b0 = bones[index[0]];
+        const matrix<4, 4, float32>& b1 = bones[index[1]];
+        const matrix<4, 4, float32>& b2 = bones[index[2]];
+        const matrix<4, 4, float32>& b3 = bones[index[3]];
+
+        for (uint32 c = 0; c < 4; ++c) {
+            columns[c] = simd_details::combine(simd_details::load(b0[c].data()),
+                                               simd_details::load(b1[c].data()),
+                                               simd_details::load(b2[c].data()),
+                                               simd_details::load(b3[c].data()),
+                                               weight);
+        }
+
+        const float32* value = input[i].data();
+
+        simd_details::float4 result = simd_details::mul(columns[0], simd_details::splat(value[0]));
+        result = simd_details::add(result, simd_details::mul(columns[1], simd_details::splat(value[1])));
+        result = simd_details::add(result, simd_details::mul(columns[2], simd_details::splat(value[2])));
+        simd_details::store3(output[i].data(), simd_details::add(result, columns[3]));
+    }
+}
+#endif
+
+/// @brief Computes the normalized weighted sum of the bone dual quaternions.
+///
+/// The bones are flipped to the hemisphere of the first one to take the shortest path.
+/// @{
+template <typename T>
+inline dual_quaternion<T> blend(const dual_quaternion<T>* bones,
+                                const vector<4, uint32>& index,
+                                const vector<4, T>& weight)
+{
+    const dual_quaternion<T>& first = bones[index[0]];
+    dual_quaternion<T> result       = first * weight[0];
+
+    for (uint32 j = 1; j < 4; ++j) {
+        const dual_quaternion<T>& bone = bones[index[j]];
+        const bool flip                = quaternion_functions_details::dot(first.real, bone.real) < T{0};
+        const T signed_weight          = flip ? -weight[j] : weight[j];
+
+        result = result + bone * signed_weight;
+    }
+
+    return result * (T{1} / std::sqrt(quaternion_functions_details::dot(result.real, result.real)));
+}
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline dual_quaternion<float32> blend(const dual_quaternion<float32>* bones,
+                                      const vector<4, uint32>& index,
+                                      const vector<4, float32>& weight)
+{
+    const dual_quaternion<float32>& first = bones[index[0]];
+
+    const simd_details::float4 first_real   = simd_details::load(first.real.data());
+    const simd_details::float4 first_weight = simd_details::splat(weight[0]);
+
+    simd_details::float4 real = simd_details::mul(first_real, first_weight);
+    simd_details::float4 dual = simd_details::mul(simd_details::load(first.dual.data()), first_weight);
+
+    for (uint32 j = 1; j < 4; ++j) {
+        const dual_quaternion<float32>& bone = bones[index[j]];
+
+        const simd_details::float4 bone_real = simd_details::load(bone.real.data());
+        const simd_details::float4 sign      = simd_details::negative_signs(simd_details::dot(first_real, bone_real));
+        const simd_details::float4 signed_weight = simd_details::flip_signs(simd_details::splat(weight[j]), sign);
+
+        real = simd_details::add(real, simd_details::mul(bone_real, signed_weight));
+        dual = simd_details::add(dual, simd_details::mul(simd_details::load(bone.dual.data()), signed_weight));
+    }
+
+    const simd_details::float4 scale = simd_details::div(simd_details::splat(1.0f),
+                                                         simd_details::sqrt(simd_details::dot(real, real)));
+
+    dual_quaternion<float32> result;
+    simd_details::store(result.real.data(), simd_details::mul(real, scale));
+    simd_details::store(result.dual.data(), simd_details::mul(dual, scale));
+    return result;
+}
+#endif
+/// @}
+
+/// @brief Transforms each point by the blended bone dual quaternion.
+template <typename T>
+inline void dual_quaternion_blend(const dual_quaternion<T>* bones,
+                                  const vector<4, uint32>* indices,
+                                  const vector<4, T>* weights,
+                                  const vector<3, T>* input,
+                                  usize count,
+                                  vector<3, T>* output)
+{
+    for (usize i = 0; i < count; ++i) {
+        output[i] = skinning_functions_details::blend(bones, indices[i], weights[i]) * input[i];
+    }
+}
+
+} // namespace framework::math::skinning_functions_details
+
+#endif
@@ -37,9 +37,11 @@
 #include <cassert>
 #include <limits>
 
+#include <common/parallel_details.hpp>
 #include <math/details/common_functions.hpp>
 #include <math/details/matrix_functions.hpp>
 #include <math/details/matrix_type.hpp>
+#include <math/details/transform_functions_details.hpp>
 #include <math/details/trigonometric_functions.hpp>
 
 namespace framework
@@ -535,6 +537,127 @@ inline matrix<4, 4, T> look_at(const vector<3, T>& eye, const vector<3, T>& cent
 }
 /// @}
 
+/// @name transform_points
+/// @{
+
+/// @brief Transforms array of points by the matrix.
+///
+/// Computes `vector<3, T>(m * vector<4, T>(points[i], 1))`, the perspective divide is not applied.
+/// Arrays larger than a few tens of thousands of points may be split between threads.
+///
+/// @param m Transform matrix.
+/// @param points Points to transform.
+/// @param count Count of the points.
+/// @param result Receives the transformed points, may be the same array as points.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void transform_points(const matrix<4, 4, T>& m,
+                             const vector<3, T>* points,
+                             usize count,
+                             vector<3, T>* result,
+                             usize thread_count = 1)
+{
+    const usize blocks_count = utils::parallel_details::count_blocks(count,
+                                                                     thread_count,
+                                                                     transform_functions_details::parallel_block_min);
+
+    utils::parallel_details::parallel_for(count, blocks_count, [&](usize /*index*/, usize begin, usize size) {
+        transform_functions_details::transform(m, points + begin, size, result + begin, T{1});
+    });
+}
+
+/// @brief Transforms array of points by the matrix in place.
+///
+/// @param m Transform matrix.
+/// @param points Points to transform.
+/// @param count Count of the points.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void transform_points(const matrix<4, 4, T>& m, vector<3, T>* points, usize count, usize thread_count = 1)
+{
+    transform_points(m, static_cast<const vector<3, T>*>(points), count, points, thread_count);
+}
+/// @}
+
+/// @name transform_vectors
+/// @{
+
+/// @brief Transforms array of direction vectors by the matrix.
+///
+/// Computes `vector<3, T>(m * vector<4, T>(vectors[i], 0))`, so the translation is ignored.
+///
+/// @param m Transform matrix.
+/// @param vectors Vectors to transform.
+/// @param count Count of the vectors.
+/// @param result Receives the transformed vectors, may be the same array as vectors.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void transform_vectors(const matrix<4, 4, T>& m,
+                              const vector<3, T>* vectors,
+                              usize count,
+                              vector<3, T>* result,
+                              usize thread_count = 1)
+{
+    const usize blocks_count = utils::parallel_details::count_blocks(count,
+                                                                     thread_count,
+                                                                     transform_functions_details::parallel_block_min);
+
+    utils::parallel_details::parallel_for(count, blocks_count, [&](usize /*index*/, usize begin, usize size) {
+        transform_functions_details::transform(m, vectors + begin, size, result + begin, T{0});
+    });
+}
+
+/// @brief Transforms array of direction vectors by the matrix in place.
+///
+/// @param m Transform matrix.
+/// @param vectors Vectors to transform.
+/// @param count Count of the vectors.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void transform_vectors(const matrix<4, 4, T>& m, vector<3, T>* vectors, usize count, usize thread_count = 1)
+{
+    transform_vectors(m, static_cast<const vector<3, T>*>(vectors), count, vectors, thread_count);
+}
+/// @}
+
+/// @name transform_normals
+/// @{
+
+/// @brief Transforms array of normals by the matrix.
+///
+/// Normals are multiplied by the inverse transpose of the upper-left 3x3 part of the matrix,
+/// which is computed once. The results are not normalized.
+///
+/// @param m Transform matrix.
+/// @param normals Normals to transform.
+/// @param count Count of the normals.
+/// @param result Receives the transformed normals, may be the same array as normals.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void transform_normals(const matrix<4, 4, T>& m,
+                              const vector<3, T>* normals,
+                              usize count,
+                              vector<3, T>* result,
+                              usize thread_count = 1)
+{
+    const matrix<4, 4, T> normal_matrix(inverse_transpose(matrix<3, 3, T>(m)));
+
+    transform_vectors(normal_matrix, normals, count, result, thread_count);
+}
+
+/// @brief Transforms array of normals by the matrix in place.
+///
+/// @param m Transform matrix.
+/// @param normals Normals to transform.
+/// @param count Count of the normals.
+/// @param thread_count Maximum number of threads, `0` means hardware concurrency.
+template <typename T>
+inline void transform_normals(const matrix<4, 4, T>& m, vector<3, T>* normals, usize count, usize thread_count = 1)
+{
+    transform_normals(m, static_cast<const vector<3, T>*>(normals), count, normals, thread_count);
+}
+/// @}
+
 /// @}
 
 } // namespace math
@@ -0,0 +1,83 @@
+/// @file
+/// @brief Contains batch transform kernels.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of transform_functions_details.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_TRANSFORM_FUNCTIONS_DETAILS_HPP
+#define FRAMEWORK_MATH_DETAILS_TRANSFORM_FUNCTIONS_DETAILS_HPP
+
+#include <common/types.hpp>
+#include <math/details/matrix_type.hpp>
+#include <math/details/simd_details.hpp>
+#include <math/details/vector_type.hpp>
+
+namespace framework::math::transform_functions_details
+{
+/// @brief Minimal count of vectors processed by one thread.
+constexpr usize parallel_block_min = 64 * 1024;
+
+/// @brief Computes `m * vector(input[i], w)` for each vector.
+///
+/// The output may be the same array as the input.
+template <typename T>
+inline void transform(const matrix<4, 4, T>& m, const vector<3, T>* input, usize count, vector<3, T>* output, T w)
+{
+    for (usize i = 0; i < count; ++i) {
+        output[i] = vector<3, T>(m * vector<4, T>(input[i], w));
+    }
+}
+
+#if defined(FRAMEWORK_MATH_SIMD)
+inline void transform(const matrix<4, 4, float32>& m,
+                      const vector<3, float32>* input,
+                      usize count,
+                      vector<3, float32>* output,
+                      float32 w)
+{
+    const simd_details::float4 c0 = simd_details::load(m[0].data());
+    const simd_details::float4 c1 = simd_details::load(m[1].data());
+    const simd_details::float4 c2 = simd_details::load(m[2].data());
+    const simd_details::float4 c3 = simd_details::mul(simd_details::load(m[3].data()), simd_details::splat(w));
+
+    for (usize i = 0; i < count; ++i) {
+        const float32* value = input[i].data();
+
+        simd_details::float4 result = simd_details::mul(c0, simd_details::splat(value[0]));
+        result                      = simd_details::add(result, simd_details::mul(c1, simd_details::splat(value[1])));
+        result                      = simd_details::add(result, simd_details::mul(c2, simd_details::splat(value[2])));
+        simd_details::store3(output[i].data(), simd_details::add(result, c3));
+    }
+}
+#endif
+
+} // namespace framework::math::transform_functions_details
+
+#endif
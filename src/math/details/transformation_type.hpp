@@ -0,0 +1,164 @@
+/// @file
+/// @brief Contains transformation type.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of transformation_type.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_TRANSFORMATION_TYPE_HPP
+#define FRAMEWORK_MATH_DETAILS_TRANSFORMATION_TYPE_HPP
+
+#include <common/types.hpp>
+#include <math/details/quaternion_type.hpp>
+#include <math/details/vector_type.hpp>
+
+namespace framework
+{
+namespace math
+{
+/// @addtogroup math_transformation_implementation
+/// @{
+
+/// @brief Transformation type.
+///
+/// Stores scale, rotation and translation, which are applied in this order.
+/// Takes 10 values instead of 16 of the equivalent `matrix<4, 4, T>`.
+///
+/// @note Composition and inverse are exact only if the scale is uniform,
+/// the non-uniform scale combined with rotation produces shear, which is not representable.
+template <typename T>
+struct transformation final
+{
+    using value_type = T; ///< Value type
+
+    /// @brief Default constructor.
+    ///
+    /// Initializes identity transformation.
+    constexpr transformation() noexcept;
+
+    /// @brief Initializes transformation with provided parts.
+    ///
+    /// @param translation_value Value for the translation.
+    /// @param rotation_value Value for the rotation, should be normalized.
+    /// @param scale_value Value for the scale.
+    constexpr transformation(const vector<3, T>& translation_value,
+                             const quaternion<T>& rotation_value,
+                             const vector<3, T>& scale_value = vector<3, T>{1}) noexcept;
+
+    vector<3, T> translation; ///< The translation.
+    quaternion<T> rotation;   ///< The rotation.
+    vector<3, T> scale;       ///< The scale.
+};
+
+/// @name Transformation operators.
+/// @{
+
+/// @brief Multiplication operator.
+///
+/// @param lhs Transformation.
+/// @param rhs Transformation.
+///
+/// @return Composition of transformations, rhs is applied first.
+template <typename T>
+inline transformation<T> operator*(const transformation<T>& lhs, const transformation<T>& rhs) noexcept;
+
+/// @brief Multiplication operator.
+///
+/// @param lhs Transformation.
+/// @param rhs Point.
+///
+/// @return Transformed point.
+template <typename T>
+inline vector<3, T> operator*(const transformation<T>& lhs, const vector<3, T>& rhs) noexcept;
+
+/// @brief Equality operator.
+///
+/// @param lhs Transformation to compare.
+/// @param rhs Transformation to compare.
+///
+/// @return `true` if all parts are equal.
+template <typename T>
+inline constexpr bool operator==(const transformation<T>& lhs, const transformation<T>& rhs) noexcept;
+
+/// @brief Inequality operator.
+///
+/// @param lhs Transformation to compare.
+/// @param rhs Transformation to compare.
+///
+/// @return `true` if any part is not equal.
+template <typename T>
+inline constexpr bool operator!=(const transformation<T>& lhs, const transformation<T>& rhs) noexcept;
+/// @}
+
+/// @}
+
+#pragma region definitions
+
+template <typename T>
+inline constexpr transformation<T>::transformation() noexcept : translation{0}, rotation{}, scale{1}
+{}
+
+template <typename T>
+inline constexpr transformation<T>::transformation(const vector<3, T>& translation_value,
+                                                   const quaternion<T>& rotation_value,
+                                                   const vector<3, T>& scale_value) noexcept
+    : translation{translation_value}, rotation{rotation_value}, scale{scale_value}
+{}
+
+template <typename T>
+inline transformation<T> operator*(const transformation<T>& lhs, const transformation<T>& rhs) noexcept
+{
+    return transformation<T>(lhs * rhs.translation, lhs.rotation * rhs.rotation, lhs.scale * rhs.scale);
+}
+
+template <typename T>
+inline vector<3, T> operator*(const transformation<T>& lhs, const vector<3, T>& rhs) noexcept
+{
+    return lhs.rotation * (lhs.scale * rhs) + lhs.translation;
+}
+
+template <typename T>
+inline constexpr bool operator==(const transformation<T>& lhs, const transformation<T>& rhs) noexcept
+{
+    return lhs.translation == rhs.translation && lhs.rotation == rhs.rotation && lhs.scale == rhs.scale;
+}
+
+template <typename T>
+inline constexpr bool operator!=(const transformation<T>& lhs, const transformation<T>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+#pragma endregion
+
+} // namespace math
+
+} // namespace framework
+
+#endif
@@ -0,0 +1,540 @@
+/// @file
+/// @brief Contains structure-of-arrays vector stream and its bulk functions.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of vector_stream.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_VECTOR_STREAM_HPP
+#define FRAMEWORK_MATH_DETAILS_VECTOR_STREAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <common/types.hpp>
+#include <math/details/matrix_type.hpp>
+#include <math/details/vector_stream_details.hpp>
+#include <math/details/vector_type.hpp>
+
+namespace framework
+{
+namespace math
+{
+/// @addtogroup math_vector_stream
+/// @{
+
+/// @brief Structure-of-arrays storage of vectors.
+///
+/// Keeps each component in a separate array aligned to the cache line. The arrays are padded
+/// to the whole aligned blocks, so bulk functions process them without scalar tails.
+/// Values of the padding lanes are unspecified.
+///
+/// @tparam N Count of the vector components.
+/// @tparam T Type of the vector components.
+template <uint32 N, typename T>
+class vector_stream final
+{
+public:
+    static_assert(N >= 2 && N <= 4, "Expected 2, 3 or 4 components.");
+    static_assert(std::is_arithmetic<T>::value, "Expected floating-point or integer type.");
+
+    using value_type  = T;            ///< Type of the vector components.
+    using vector_type = vector<N, T>; ///< Type of the stored vectors.
+
+    /// @brief Count of values in one aligned block of the component arrays.
+    static constexpr usize lanes = vector_stream_details::lanes<T>;
+
+    /// @brief Default constructor.
+    vector_stream() = default;
+
+    /// @brief Creates stream of zero vectors.
+    ///
+    /// @param size Count of the vectors.
+    explicit vector_stream(usize size);
+
+    /// @brief Creates stream from the list of vectors.
+    ///
+    /// @param values Vectors to store.
+    vector_stream(std::initializer_list<vector_type> values);
+
+    /// @brief Creates stream from the range of vectors.
+    ///
+    /// @param first Beginning of the range.
+    /// @param last End of the range.
+    template <typename Iterator>
+    vector_stream(Iterator first, Iterator last);
+
+    /// @brief Count of the stored vectors.
+    ///
+    /// @return Stream size.
+    usize size() const noexcept;
+
+    /// @brief Size of the component arrays including the padding lanes.
+    ///
+    /// @return Size rounded up to the count of lanes.
+    usize aligned_size() const noexcept;
+
+    /// @brief Checks if the stream is empty.
+    ///
+    /// @return `true` if the stream has no vectors.
+    bool empty() const noexcept;
+
+    /// @brief Resizes the stream, new vectors are zero.
+    ///
+    /// @param size New count of the vectors.
+    void resize(usize size);
+
+    /// @brief Removes all vectors.
+    void clear() noexcept;
+
+    /// @brief Adds vector to the end of the stream.
+    ///
+    /// @param value Vector to add.
+    void push_back(const vector_type& value);
+
+    /// @brief Gathers the vector from the component arrays.
+    ///
+    /// @param index Index of the vector.
+    ///
+    /// @return The vector.
+    vector_type get(usize index) const;
+
+    /// @brief Scatters the vector to the component arrays.
+    ///
+    /// @param index Index of the vector.
+    /// @param value New value of the vector.
+    void set(usize index, const vector_type& value);
+
+    /// @brief Array of the component values.
+    ///
+    /// @param component Index of the component.
+    ///
+    /// @return Pointer to the aligned array of aligned_size() values.
+    T* data(uint32 component) noexcept;
+
+    /// @copydoc vector_stream::data(uint32)
+    const T* data(uint32 component) const noexcept;
+
+    /// @brief Copies vectors to the array of structures.
+    ///
+    /// @param out Output iterator of vector_type values.
+    ///
+    /// @return Iterator past the last copied vector.
+    template <typename OutputIterator>
+    OutputIterator copy_to(OutputIterator out) const;
+
+private:
+    std::array<vector_stream_details::aligned_vector<T>, N> m_components;
+    usize m_size = 0;
+};
+
+/// @name Bulk geometric functions
+/// @{
+
+/// @brief Computes dot products of the vectors of two streams.
+///
+/// @param lhs Stream of floating-point or integral type.
+/// @param rhs Stream of the same size.
+/// @param result Receives `dot(lhs[i], rhs[i])`, resized to the stream size.
+template <uint32 N, typename T>
+void dot(const vector_stream<N, T>& lhs, const vector_stream<N, T>& rhs, std::vector<T>& result);
+
+/// @brief Computes lengths of the vectors of the stream.
+///
+/// @param value Stream of floating-point type.
+/// @param result Receives `length(value[i])`, resized to the stream size.
+template <uint32 N, typename T>
+void length(const vector_stream<N, T>& value, std::vector<T>& result);
+
+/// @brief Computes cross products of the vectors of two streams.
+///
+/// @param lhs Stream of floating-point or integral type.
+/// @param rhs Stream of the same size.
+/// @param result Receives `cross(lhs[i], rhs[i])`, may be one of the arguments.
+template <typename T>
+void cross(const vector_stream<3, T>& lhs, const vector_stream<3, T>& rhs, vector_stream<3, T>& result);
+
+/// @brief Normalizes the vectors of the stream.
+///
+/// @param value Stream of floating-point type.
+/// @param result Receives `normalize(value[i])`, may be the argument.
+template <uint32 N, typename T>
+void normalize(const vector_stream<N, T>& value, vector_stream<N, T>& result);
+/// @}
+
+/// @name Bulk common functions
+/// @{
+
+/// @brief Linearly interpolates the vectors of two streams.
+///
+/// @param a Stream of floating-point type.
+/// @param b Stream of the same size.
+/// @param t Interpolation weight.
+/// @param result Receives `mix(a[i], b[i], t)`, may be one of the arguments.
+template <uint32 N, typename T>
+void mix(const vector_stream<N, T>& a, const vector_stream<N, T>& b, T t, vector_stream<N, T>& result);
+
+/// @brief Constrains the vectors of the stream to lie between two values.
+///
+/// @param value Stream of floating-point or integral type.
+/// @param min_value The lower end of the range.
+/// @param max_value The upper end of the range.
+/// @param result Receives `clamp(value[i], min_value, max_value)`, may be the argument.
+template <uint32 N, typename T>
+void clamp(const vector_stream<N, T>& value, T min_value, T max_value, vector_stream<N, T>& result);
+
+/// @brief Constrains each component of the vectors of the stream.
+///
+/// @param value Stream of floating-point or integral type.
+/// @param min_value The lower end of the range.
+/// @param max_value The upper end of the range.
+/// @param result Receives `clamp(value[i], min_value, max_value)`, may be the argument.
+template <uint32 N, typename T>
+void clamp(const vector_stream<N, T>& value,
+           const vector<N, T>& min_value,
+           const vector<N, T>& max_value,
+           vector_stream<N, T>& result);
+/// @}
+
+/// @name Bulk matrix functions
+/// @{
+
+/// @brief Multiplies the vectors of the stream by the matrix.
+///
+/// @param lhs Matrix of floating-point or integral type.
+/// @param rhs Stream of floating-point or integral type.
+/// @param result Receives `lhs * rhs[i]`, may be the argument.
+template <uint32 N, typename T>
+void multiply(const matrix<N, N, T>& lhs, const vector_stream<N, T>& rhs, vector_stream<N, T>& result);
+/// @}
+
+/// @}
+
+#pragma region definitions
+
+template <uint32 N, typename T>
+inline vector_stream<N, T>::vector_stream(usize size)
+{
+    resize(size);
+}
+
+template <uint32 N, typename T>
+inline vector_stream<N, T>::vector_stream(std::initializer_list<vector_type> values)
+    : vector_stream(values.begin(), values.end())
+{}
+
+template <uint32 N, typename T>
+template <typename Iterator>
+inline vector_stream<N, T>::vector_stream(Iterator first, Iterator last)
+{
+    resize(static_cast<usize>(std::distance(first, last)));
+
+    for (usize index = 0; first != last; ++first, ++index) {
+        set(index, *first);
+    }
+}
+
+template <uint32 N, typename T>
+inline usize vector_stream<N, T>::size() const noexcept
+{
+    return m_size;
+}
+
+template <uint32 N, typename T>
+inline usize vector_stream<N, T>::aligned_size() const noexcept
+{
+    return m_components[0].size();
+}
+
+template <uint32 N, typename T>
+inline bool vector_stream<N, T>::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+template <uint32 N, typename T>
+inline void vector_stream<N, T>::resize(usize size)
+{
+    const usize aligned = (size + lanes - 1) / lanes * lanes;
+
+    // Padding lanes can hold results of the bulk functions, so they are zeroed on growth too.
+    const usize first = std::min(size, m_size);
+
+    for (auto& component : m_components) {
+        std::fill(component.begin() + static_cast<ptrdiff>(first), component.end(), T{0});
+        component.resize(aligned, T{0});
+    }
+
+    m_size = size;
+}
+
+template <uint32 N, typename T>
+inline void vector_stream<N, T>::clear() noexcept
+{
+    for (auto& component : m_components) {
+        component.clear();
+    }
+
+    m_size = 0;
+}
+
+template <uint32 N, typename T>
+inline void vector_stream<N, T>::push_back(const vector_type& value)
+{
+    if (m_size == aligned_size()) {
+        for (auto& component : m_components) {
+            component.resize(m_size + lanes, T{0});
+        }
+    }
+
+    set(m_size++, value);
+}
+
+template <uint32 N, typename T>
+inline typename vector_stream<N, T>::vector_type vector_stream<N, T>::get(usize index) const
+{
+    assert(index < m_size);
+
+    vector_type result;
+    for (uint32 c = 0; c < N; ++c) {
+        result[c] = m_components[c][index];
+    }
+    return result;
+}
+
+template <uint32 N, typename T>
+inline void vector_stream<N, T>::set(usize index, const vector_type& value)
+{
+    assert(index < m_size);
+
+    for (uint32 c = 0; c < N; ++c) {
+        m_components[c][index] = value[c];
+    }
+}
+
+template <uint32 N, typename T>
+inline T* vector_stream<N, T>::data(uint32 component) noexcept
+{
+    return m_components[component].data();
+}
+
+template <uint32 N, typename T>
+inline const T* vector_stream<N, T>::data(uint32 component) const noexcept
+{
+    return m_components[component].data();
+}
+
+template <uint32 N, typename T>
+template <typename OutputIterator>
+inline OutputIterator vector_stream<N, T>::copy_to(OutputIterator out) const
+{
+    for (usize index = 0; index < m_size; ++index, ++out) {
+        *out = get(index);
+    }
+    return out;
+}
+
+template <uint32 N, typename T>
+inline void dot(const vector_stream<N, T>& lhs, const vector_stream<N, T>& rhs, std::vector<T>& result)
+{
+    using pack = vector_stream_details::pack<T>;
+
+    assert(lhs.size() == rhs.size());
+
+    result.resize(lhs.aligned_size());
+
+    vector_stream_details::for_each_pack<T>(lhs.aligned_size(), [&](usize i) {
+        typename pack::type sum = pack::mul(pack::load(lhs.data(0) + i), pack::load(rhs.data(0) + i));
+        for (uint32 c = 1; c < N; ++c) {
+            sum = pack::add(sum, pack::mul(pack::load(lhs.data(c) + i), pack::load(rhs.data(c) + i)));
+        }
+        pack::store(result.data() + i, sum);
+    });
+
+    result.resize(lhs.size());
+}
+
+template <uint32 N, typename T>
+inline void length(const vector_stream<N, T>& value, std::vector<T>& result)
+{
+    using pack = vector_stream_details::pack<T>;
+
+    static_assert(std::is_floating_point<T>::value, "Expected floating-point type.");
+
+    result.resize(value.aligned_size());
+
+    vector_stream_details::for_each_pack<T>(value.aligned_size(), [&](usize i) {
+        typename pack::type sum = pack::mul(pack::load(value.data(0) + i), pack::load(value.data(0) + i));
+        for (uint32 c = 1; c < N; ++c) {
+            sum = pack::add(sum, pack::mul(pack::load(value.data(c) + i), pack::load(value.data(c) + i)));
+        }
+        pack::store(result.data() + i, pack::sqrt(sum));
+    });
+
+    result.resize(value.size());
+}
+
+template <typename T>
+inline void cross(const vector_stream<3, T>& lhs, const vector_stream<3, T>& rhs, vector_stream<3, T>& result)
+{
+    using pack = vector_stream_details::pack<T>;
+
+    assert(lhs.size() == rhs.size());
+
+    result.resize(lhs.size());
+
+    vector_stream_details::for_each_pack<T>(lhs.aligned_size(), [&](usize i) {
+        const typename pack::type ax = pack::load(lhs.data(0) + i);
+        const typename pack::type ay = pack::load(lhs.data(1) + i);
+        const typename pack::type az = pack::load(lhs.data(2) + i);
+        const typename pack::type bx = pack::load(rhs.data(0) + i);
+        const typename pack::type by = pack::load(rhs.data(1) + i);
+        const typename pack::type bz = pack::load(rhs.data(2) + i);
+
+        pack::store(result.data(0) + i, pack::sub(pack::mul(ay, bz), pack::mul(by, az)));
+        pack::store(result.data(1) + i, pack::sub(pack::mul(az, bx), pack::mul(bz, ax)));
+        pack::store(result.data(2) + i, pack::sub(pack::mul(ax, by), pack::mul(bx, ay)));
+    });
+}
+
+template <uint32 N, typename T>
+inline void normalize(const vector_stream<N, T>& value, vector_stream<N, T>& result)
+{
+    using pack = vector_stream_details::pack<T>;
+
+    static_assert(std::is_floating_point<T>::value, "Expected floating-point type.");
+
+    result.resize(value.size());
+
+    vector_stream_details::for_each_pack<T>(value.aligned_size(), [&](usize i) {
+        typename pack::type components[N];
+        for (uint32 c = 0; c < N; ++c) {
+            components[c] = pack::load(value.data(c) + i);
+        }
+
+        typename pack::type sum = pack::mul(components[0], components[0]);
+        for (uint32 c = 1; c < N; ++c) {
+            sum = pack::add(sum, pack::mul(components[c], components[c]));
+        }
+
+        const typename pack::type scale = pack::div(pack::splat(T{1}), pack::sqrt(sum));
+        for (uint32 c = 0; c < N; ++c) {
+            pack::store(result.data(c) + i, pack::mul(components[c], scale));
+        }
+    });
+}
+
+template <uint32 N, typename T>
+inline void mix(const vector_stream<N, T>& a, const vector_stream<N, T>& b, T t, vector_stream<N, T>& result)
+{
+    using pack = vector_stream_details::pack<T>;
+
+    assert(a.size() == b.size());
+
+    result.resize(a.size());
+
+    const typename pack::type weight = pack::splat(t);
+
+    for (uint32 c = 0; c < N; ++c) {
+        vector_stream_details::for_each_pack<T>(a.aligned_size(), [&](usize i) {
+            const typename pack::type from = pack::load(a.data(c) + i);
+            const typename pack::type to   = pack::load(b.data(c) + i);
+            pack::store(result.data(c) + i, pack::add(from, pack::mul(weight, pack::sub(to, from))));
+        });
+    }
+}
+
+template <uint32 N, typename T>
+inline void clamp(const vector_stream<N, T>& value, T min_value, T max_value, vector_stream<N, T>& result)
+{
+    clamp(value, vector<N, T>(min_value), vector<N, T>(max_value), result);
+}
+
+template <uint32 N, typename T>
+inline void clamp(const vector_stream<N, T>& value,
+                  const vector<N, T>& min_value,
+                  const vector<N, T>& max_value,
+                  vector_stream<N, T>& result)
+{
+    using pack = vector_stream_details::pack<T>;
+
+    result.resize(value.size());
+
+    for (uint32 c = 0; c < N; ++c) {
+        const typename pack::type low  = pack::splat(min_value[c]);
+        const typename pack::type high = pack::splat(max_value[c]);
+
+        vector_stream_details::for_each_pack<T>(value.aligned_size(), [&](usize i) {
+            pack::store(result.data(c) + i, pack::min(pack::max(pack::load(value.data(c) + i), low), high));
+        });
+    }
+}
+
+template <uint32 N, typename T>
+inline void multiply(const matrix<N, N, T>& lhs, const vector_stream<N, T>& rhs, vector_stream<N, T>& result)
+{
+    using pack = vector_stream_details::pack<T>;
+
+    result.resize(rhs.size());
+
+    typename pack::type m[N][N];
+    for (uint32 c = 0; c < N; ++c) {
+        for (uint32 r = 0; r < N; ++r) {
+            m[c][r] = pack::splat(lhs[c][r]);
+        }
+    }
+
+    vector_stream_details::for_each_pack<T>(rhs.aligned_size(), [&](usize i) {
+        typename pack::type components[N];
+        for (uint32 c = 0; c < N; ++c) {
+            components[c] = pack::load(rhs.data(c) + i);
+        }
+
+        for (uint32 r = 0; r < N; ++r) {
+            typename pack::type sum = pack::mul(m[0][r], components[0]);
+            for (uint32 c = 1; c < N; ++c) {
+                sum = pack::add(sum, pack::mul(m[c][r], components[c]));
+            }
+            pack::store(result.data(r) + i, sum);
+        }
+    });
+}
+
+#pragma endregion
+
+} // namespace math
+
+} // namespace framework
+
+#endif
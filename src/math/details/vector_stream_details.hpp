@@ -0,0 +1,225 @@
+/// @file
+/// @brief Storage and lane helpers of the vector streams.
+/// @author Fedorov Alexey
+/// @date 16.10.2026
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#ifndef FRAMEWORK_MATH_DETAILS
+#error You should include math/math.hpp instead of vector_stream_details.hpp
+#endif
+
+#ifndef FRAMEWORK_MATH_DETAILS_VECTOR_STREAM_DETAILS_HPP
+#define FRAMEWORK_MATH_DETAILS_VECTOR_STREAM_DETAILS_HPP
+
+#include <cmath>
+#include <new>
+#include <vector>
+
+#include <common/types.hpp>
+#include <math/details/simd_details.hpp>
+
+namespace framework::math::vector_stream_details
+{
+/// @brief Alignment of the stream components, one cache line.
+constexpr usize alignment = 64;
+
+/// @brief Count of values in one aligned block, component arrays are padded to it.
+template <typename T>
+constexpr usize lanes = alignment / sizeof(T);
+
+/// @brief Allocator of the aligned component arrays.
+template <typename T>
+struct aligned_allocator
+{
+    using value_type = T;
+
+    aligned_allocator() noexcept = default;
+
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U>&) noexcept
+    {}
+
+    T* allocate(usize count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{alignment}));
+    }
+
+    void deallocate(T* pointer, usize) noexcept
+    {
+        ::operator delete(pointer, std::align_val_t{alignment});
+    }
+
+    template <typename U>
+    bool operator==(const aligned_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const aligned_allocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+template <typename T>
+using aligned_vector = std::vector<T, aligned_allocator<T>>;
+
+/// @brief Operations on a pack of lanes, the generic version processes one lane.
+template <typename T>
+struct pack
+{
+    using type = T;
+
+    static constexpr usize width = 1;
+
+    static type load(const T* data) noexcept
+    {
+        return *data;
+    }
+
+    static void store(T* data, type value) noexcept
+    {
+        *data = value;
+    }
+
+    static type splat(T value) noexcept
+    {
+        return value;
+    }
+
+    static type add(type a, type b) noexcept
+    {
+        return a + b;
+    }
+
+    static type sub(type a, type b) noexcept
+    {
+        return a - b;
+    }
+
+    static type mul(type a, type b) noexcept
+    {
+        return a * b;
+    }
+
+    static type div(type a, type b) noexcept
+    {
+        return a / b;
+    }
+
+    static type sqrt(type value) noexcept
+    {
+        return static_cast<type>(std::sqrt(value));
+    }
+
+    static type min(type a, type b) noexcept
+    {
+        return (a < b) ? a : b;
+    }
+
+    static type max(type a, type b) noexcept
+    {
+        return (a > b) ? a : b;
+    }
+};
+
+#if defined(FRAMEWORK_MATH_SIMD)
+template <>
+struct pack<float32>
+{
+    using type = simd_details::float4;
+
+    static constexpr usize width = 4;
+
+    static type load(const float32* data) noexcept
+    {
+        return simd_details::load(data);
+    }
+
+    static void store(float32* data, type value) noexcept
+    {
+        simd_details::store(data, value);
+    }
+
+    static type splat(float32 value) noexcept
+    {
+        return simd_details::splat(value);
+    }
+
+    static type add(type a, type b) noexcept
+    {
+        return simd_details::add(a, b);
+    }
+
+    static type sub(type a, type b) noexcept
+    {
+        return simd_details::sub(a, b);
+    }
+
+    static type mul(type a, type b) noexcept
+    {
+        return simd_details::mul(a, b);
+    }
+
+    static type div(type a, type b) noexcept
+    {
+        return simd_details::div(a, b);
+    }
+
+    static type sqrt(type value) noexcept
+    {
+        return simd_details::sqrt(value);
+    }
+
+    static type min(type a, type b) noexcept
+    {
+        return simd_details::min(a, b);
+    }
+
+    static type max(type a, type b) noexcept
+    {
+        return simd_details::max(a, b);
+    }
+};
+#endif
+
+/// @brief Calls the function with index of each pack of the padded stream.
+///
+/// Iterates over the aligned blocks, so the inner loop over packs of the block can be unrolled.
+template <typename T, typename Function>
+inline void for_each_pack(usize aligned_size, Function&& function)
+{
+    for (usize block = 0; block < aligned_size; block += lanes<T>) {
+        for (usize index = block; index < block + lanes<T>; index += pack<T>::width) {
+            function(index);
+        }
+    }
+}
+
+} // namespace framework::math::vector_stream_details
+
+#endif
@@ -37,6 +37,7 @@
 #include <cassert>
 
 #include <common/types.hpp>
+#include <math/details/simd_details.hpp>
 #include <math/details/vector_type_details.hpp>
 
 namespace framework
@@ -54,6 +55,9 @@ struct vector;
 
 /// @brief Vector<4, T> type specialization.
 ///
+/// Operations of float32 and int32 vectors use SIMD instructions if `FRAMEWORK_MATH_SIMD` is defined.@n
+/// The instructions load and store unaligned, so the vectors keep the alignment of their components.
+///
 /// @note Can be instantiated only with arithmetic type.
 template <typename T>
 struct vector<4, T> final
@@ -891,6 +895,221 @@ inline vector<N, T>& operator/=(vector<N, T>& lhs, const U& rhs) noexcept
 }
 /// @}
 
+#if defined(FRAMEWORK_MATH_SIMD)
+
+/// @name SIMD assignment operators for vector<4, float32>.
+/// @{
+
+/// @brief Addition assignment operator.
+///
+/// @param lhs First addend.
+/// @param rhs Second addend.
+///
+/// @return Reference to sum of two vectors.
+template <typename U>
+inline vector<4, float32>& operator+=(vector<4, float32>& lhs, const vector<4, U>& rhs) noexcept
+{
+    const vector<4, float32> value{rhs};
+    simd_details::store(lhs.data(),
+                        simd_details::add(simd_details::load(lhs.data()), simd_details::load(value.data())));
+    return lhs;
+}
+
+/// @brief Subtractions assignment operator.
+///
+/// @param lhs Vector to subtract from.
+/// @param rhs Vector to subtract.
+///
+/// @return Reference to difference of two vectors.
+template <typename U>
+inline vector<4, float32>& operator-=(vector<4, float32>& lhs, const vector<4, U>& rhs) noexcept
+{
+    const vector<4, float32> value{rhs};
+    simd_details::store(lhs.data(),
+                        simd_details::sub(simd_details::load(lhs.data()), simd_details::load(value.data())));
+    return lhs;
+}
+
+/// @brief Multiplication assignment operator.
+///
+/// @param lhs First multiplier.
+/// @param rhs Second multiplier.
+///
+/// @return Reference to product of two vectors.
+template <typename U>
+inline vector<4, float32>& operator*=(vector<4, float32>& lhs, const vector<4, U>& rhs) noexcept
+{
+    const vector<4, float32> value{rhs};
+    simd_details::store(lhs.data(),
+                        simd_details::mul(simd_details::load(lhs.data()), simd_details::load(value.data())));
+    return lhs;
+}
+
+/// @brief Division assignment operator.
+///
+/// @param lhs Dividend vector.
+/// @param rhs Divider vector.
+///
+/// @return Reference to quotient of two vectors.
+template <typename U>
+inline vector<4, float32>& operator/=(vector<4, float32>& lhs, const vector<4, U>& rhs) noexcept
+{
+    const vector<4, float32> value{rhs};
+    simd_details::store(lhs.data(),
+                        simd_details::div(simd_details::load(lhs.data()), simd_details::load(value.data())));
+    return lhs;
+}
+
+/// @brief Addition assignment operator.
+///
+/// @param lhs First addend.
+/// @param rhs Second addend.
+///
+/// @return Reference to sum of vector and scalar value.
+template <typename U, typename std::enable_if<std::is_arithmetic<U>::value, int32>::type = 0>
+inline vector<4, float32>& operator+=(vector<4, float32>& lhs, const U& rhs) noexcept
+{
+    const auto value = simd_details::splat(vector_type_details::cast_to<float32>::from(rhs));
+    simd_details::store(lhs.data(), simd_details::add(simd_details::load(lhs.data()), value));
+    return lhs;
+}
+
+/// @brief Subtractions assignment operator.
+///
+/// @param lhs Vector to subtract from.
+/// @param rhs Scalar value to subtract.
+///
+/// @return Reference to difference of vector and scalar value.
+template <typename U, typename std::enable_if<std::is_arithmetic<U>::value, int32>::type = 0>
+inline vector<4, float32>& operator-=(vector<4, float32>& lhs, const U& rhs) noexcept
+{
+    const auto value = simd_details::splat(vector_type_details::cast_to<float32>::from(rhs));
+    simd_details::store(lhs.data(), simd_details::sub(simd_details::load(lhs.data()), value));
+    return lhs;
+}
+
+/// @brief Multiplication assignment operator.
+///
+/// @param lhs First multiplier.
+/// @param rhs Second multiplier.
+///
+/// @return Reference to product of vector and scalar value.
+template <typename U, typename std::enable_if<std::is_arithmetic<U>::value, int32>::type = 0>
+inline vector<4, float32>& operator*=(vector<4, float32>& lhs, const U& rhs) noexcept
+{
+    const auto value = simd_details::splat(vector_type_details::cast_to<float32>::from(rhs));
+    simd_details::store(lhs.data(), simd_details::mul(simd_details::load(lhs.data()), value));
+    return lhs;
+}
+
+/// @brief Division assignment operator.
+///
+/// @param lhs Dividend vector.
+/// @param rhs Divider scalar value.
+///
+/// @return Reference to quotient of vector and scalar value.
+template <typename U, typename std::enable_if<std::is_arithmetic<U>::value, int32>::type = 0>
+inline vector<4, float32>& operator/=(vector<4, float32>& lhs, const U& rhs) noexcept
+{
+    const auto value = simd_details::splat(vector_type_details::cast_to<float32>::from(rhs));
+    simd_details::store(lhs.data(), simd_details::div(simd_details::load(lhs.data()), value));
+    return lhs;
+}
+/// @}
+
+/// @name SIMD assignment operators for vector<4, int32>.
+/// @{
+
+/// @brief Addition assignment operator.
+///
+/// @param lhs First addend.
+/// @param rhs Second addend.
+///
+/// @return Reference to sum of two vectors.
+template <typename U>
+inline vector<4, int32>& operator+=(vector<4, int32>& lhs, const vector<4, U>& rhs) noexcept
+{
+    const vector<4, int32> value{rhs};
+    simd_details::store(lhs.data(),
+                        simd_details::add(simd_details::load(lhs.data()), simd_details::load(value.data())));
+    return lhs;
+}
+
+/// @brief Subtractions assignment operator.
+///
+/// @param lhs Vector to subtract from.
+/// @param rhs Vector to subtract.
+///
+/// @return Reference to difference of two vectors.
+template <typename U>
+inline vector<4, int32>& operator-=(vector<4, int32>& lhs, const vector<4, U>& rhs) noexcept
+{
+    const vector<4, int32> value{rhs};
+    simd_details::store(lhs.data(),
+                        simd_details::sub(simd_details::load(lhs.data()), simd_details::load(value.data())));
+    return lhs;
+}
+
+/// @brief Multiplication assignment operator.
+///
+/// @param lhs First multiplier.
+/// @param rhs Second multiplier.
+///
+/// @return Reference to product of two vectors.
+template <typename U>
+inline vector<4, int32>& operator*=(vector<4, int32>& lhs, const vector<4, U>& rhs) noexcept
+{
+    const vector<4, int32> value{rhs};
+    simd_details::store(lhs.data(),
+                        simd_details::mul(simd_details::load(lhs.data()), simd_details::load(value.data())));
+    return lhs;
+}
+
+/// @brief Addition assignment operator.
+///
+/// @param lhs First addend.
+/// @param rhs Second addend.
+///
+/// @return Reference to sum of vector and scalar value.
+template <typename U, typename std::enable_if<std::is_arithmetic<U>::value, int32>::type = 0>
+inline vector<4, int32>& operator+=(vector<4, int32>& lhs, const U& rhs) noexcept
+{
+    const auto value = simd_details::splat(vector_type_details::cast_to<int32>::from(rhs));
+    simd_details::store(lhs.data(), simd_details::add(simd_details::load(lhs.data()), value));
+    return lhs;
+}
+
+/// @brief Subtractions assignment operator.
+///
+/// @param lhs Vector to subtract from.
+/// @param rhs Scalar value to subtract.
+///
+/// @return Reference to difference of vector and scalar value.
+template <typename U, typename std::enable_if<std::is_arithmetic<U>::value, int32>::type = 0>
+inline vector<4, int32>& operator-=(vector<4, int32>& lhs, const U& rhs) noexcept
+{
+    const auto value = simd_details::splat(vector_type_details::cast_to<int32>::from(rhs));
+    simd_details::store(lhs.data(), simd_details::sub(simd_details::load(lhs.data()), value));
+    return lhs;
+}
+
+/// @brief Multiplication assignment operator.
+///
+/// @param lhs First multiplier.
+/// @param rhs Second multiplier.
+///
+/// @return Reference to product of vector and scalar value.
+template <typename U, typename std::enable_if<std::is_arithmetic<U>::value, int32>::type = 0>
+inline vector<4, int32>& operator*=(vector<4, int32>& lhs, const U& rhs) noexcept
+{
+    const auto value = simd_details::splat(vector_type_details::cast_to<int32>::from(rhs));
+    simd_details::store(lhs.data(), simd_details::mul(simd_details::load(lhs.data()), value));
+    return lhs;
+}
+/// @}
+
+#endif
+
 /// @name Common binary operators for vector and vector.
 /// @{
 
@@ -39,13 +39,19 @@
 
 #include <math/details/common_functions.hpp>
 #include <math/details/constants.hpp>
+#include <math/details/dual_quaternion_type.hpp>
 #include <math/details/exponential_functions.hpp>
 #include <math/details/geometric_functions.hpp>
 #include <math/details/matrix_functions.hpp>
 #include <math/details/matrix_type.hpp>
+#include <math/details/quaternion_functions.hpp>
+#include <math/details/quaternion_type.hpp>
 #include <math/details/relational_functions.hpp>
+#include <math/details/skinning_functions.hpp>
 #include <math/details/transform_functions.hpp>
+#include <math/details/transformation_type.hpp>
 #include <math/details/trigonometric_functions.hpp>
+#include <math/details/vector_stream.hpp>
 #include <math/details/vector_type.hpp>
 
 #undef FRAMEWORK_MATH_DETAILS
@@ -61,13 +67,19 @@
 /// @defgroup math_predefined_constants Predefined constants
 /// @defgroup math_vector_implementation Vector type
 /// @defgroup math_matrix_implementation Matrix type
+/// @defgroup math_quaternion_implementation Quaternion type
+/// @defgroup math_dual_quaternion_implementation Dual quaternion type
+/// @defgroup math_transformation_implementation Transformation type
 /// @defgroup math_common_functions Common functions
 /// @defgroup math_exponential_functions Exponential functions
 /// @defgroup math_geometric_functions Geometric functions
 /// @defgroup math_matrix_functions Matrix functions
+/// @defgroup math_quaternion_functions Quaternion functions
 /// @defgroup math_relational_functions Relational functions
+/// @defgroup math_skinning_functions Skinning functions
 /// @defgroup math_transform_functions Transform functions
 /// @defgroup math_trigonometric_functions Trigonometric functions
+/// @defgroup math_vector_stream Vector streams
 
 /// @}
 
@@ -137,6 +149,38 @@ using matrix4x3f = matrix<4, 3, float32>; ///< Matrix with 4 columns and 4 rows
 
 /// @}
 
+/// @name Vector stream types.
+/// @{
+
+using vector_stream2d = vector_stream<2, float64>; ///< Stream of vectors of 2 float64 values.
+using vector_stream3d = vector_stream<3, float64>; ///< Stream of vectors of 3 float64 values.
+using vector_stream4d = vector_stream<4, float64>; ///< Stream of vectors of 4 float64 values.
+
+using vector_stream2f = vector_stream<2, float32>; ///< Stream of vectors of 2 float32 values.
+using vector_stream3f = vector_stream<3, float32>; ///< Stream of vectors of 3 float32 values.
+using vector_stream4f = vector_stream<4, float32>; ///< Stream of vectors of 4 float32 values.
+
+/// @}
+
+/// @name Quaternion types.
+/// @{
+
+using quaterniond = quaternion<float64>; ///< Quaternion of float64 values.
+using quaternionf = quaternion<float32>; ///< Quaternion of float32 values.
+
+using dual_quaterniond = dual_quaternion<float64>; ///< Dual quaternion of float64 values.
+using dual_quaternionf = dual_quaternion<float32>; ///< Dual quaternion of float32 values.
+
+/// @}
+
+/// @name Transformation types.
+/// @{
+
+using transformationd = transformation<float64>; ///< Transformation of float64 values.
+using transformationf = transformation<float32>; ///< Transformation of float32 values.
+
+/// @}
+
 } // namespace framework::math
 
 /// @}
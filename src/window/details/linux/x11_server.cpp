@@ -29,6 +29,7 @@
 
 #include <common/types.hpp>
 #include <log/log.hpp>
+#include <log/ring_logger.hpp>
 #include <window/details/linux/x11_server.hpp>
 
 namespace
@@ -45,6 +46,11 @@ std::weak_ptr<x11_server>& server_instance()
 
 [[noreturn]] ::framework::int32 fatal_error_handler(Display* /*unused*/) {
     ::framework::log::fatal(log_tag) << "Fatal error occurred." << std::endl;
+
+    // Buffered messages and the crash log are lost otherwise.
+    ::framework::log::logger()->flush();
+    ::framework::log::dump_crash_log();
+
     std::terminate();
 }
 
@@ -56,7 +62,7 @@ int error_handler(Display* display, XErrorEvent* event)
         char buffer[length];
         XGetErrorText(display, event->error_code, buffer, length);
 
-        ::framework::log::error(log_tag) << buffer << std::endl;
+        FRAMEWORK_LOG_ERROR(log_tag) << buffer << std::endl;
     }
 
     return 0;
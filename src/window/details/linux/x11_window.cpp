@@ -326,7 +326,7 @@ void x11_window::process_events()
 void x11_window::iconify()
 {
     if (XIconifyWindow(m_server->display(), m_window, static_cast<int>(m_server->default_screen())) == 0) {
-        ::framework::log::warning(log_tag) << "Failed to iconify window." << std::endl;
+        FRAMEWORK_LOG_WARNING(log_tag) << "Failed to iconify window." << std::endl;
         return;
     }
 
@@ -730,7 +730,7 @@ void x11_window::process(XPropertyEvent event)
 
 void x11_window::process(XAnyEvent event)
 {
-    ::framework::log::debug(log_tag) << "Got event: " << event_type_string(event) << std::endl;
+    FRAMEWORK_LOG_DEBUG(log_tag) << "Got event: " << event_type_string(event) << std::endl;
 }
 
 #pragma endregion
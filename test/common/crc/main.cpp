@@ -23,9 +23,73 @@
 // SOFTWARE.
 // =============================================================================
 
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
 #include <common/crc.hpp>
+#include <common/utils.hpp>
 #include <unit_test/suite.hpp>
 
+namespace
+{
+using namespace framework::utils;
+
+constexpr framework::uint8 check_data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+#if defined(FRAMEWORK_CRC_CONSTEXPR)
+// clang-format off
+static_assert(0xF4 == crc8::calculate(std::begin(check_data), std::end(check_data)), "CRC-8 Failed.");
+static_assert(0xDA == crc8_cdma2000::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/CDMA2000 Failed.");
+static_assert(0x15 == crc8_darc::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/DARC Failed.");
+static_assert(0xBC == crc8_dvb_s2::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/DVB-S2 Failed.");
+static_assert(0x97 == crc8_ebu::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/EBU Failed.");
+static_assert(0x7E == crc8_i_code::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/I-CODE Failed.");
+static_assert(0xA1 == crc8_itu::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/ITU Failed.");
+static_assert(0xA1 == crc8_maxim::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/MAXIM Failed.");
+static_assert(0xD0 == crc8_rohc::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/ROHC Failed.");
+static_assert(0x25 == crc8_wcdma::calculate(std::begin(check_data), std::end(check_data)), "CRC-8/WCDMA Failed.");
+static_assert(0x29B1 == crc16_ccitt_false::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/CCITT-FALSE Failed.");
+static_assert(0xBB3D == crc16_arc::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/ARC Failed.");
+static_assert(0xE5CC == crc16_aug_ccitt::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/AUG-CCITT Failed.");
+static_assert(0xFEE8 == crc16_buypas::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/BUYPAS Failed.");
+static_assert(0x4C06 == crc16_cdma2000::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/CDMA2000 Failed.");
+static_assert(0x9ECF == crc16_dds_110::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/DDS-110 Failed.");
+static_assert(0x007E == crc16_dect_r::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/DECT-R Failed.");
+static_assert(0x007F == crc16_dect_x::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/DECT-X Failed.");
+static_assert(0xD64E == crc16_genibus::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/GENIBUS Failed.");
+static_assert(0x44C2 == crc16_maxim::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/MAXIM Failed.");
+static_assert(0x6F91 == crc16_mcrf4xx::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/MCRF4XX Failed.");
+static_assert(0x63D0 == crc16_riello::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/RIELLO Failed.");
+static_assert(0xD0DB == crc16_t0_dif::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/T0-DIF Failed.");
+static_assert(0x0FB3 == crc16_teledisk::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/TELEDISK Failed.");
+static_assert(0x26B1 == crc16_tms37157::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/TMS37157 Failed.");
+static_assert(0xB4C8 == crc16_usb::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/USB Failed.");
+static_assert(0xBF05 == crc16_a::calculate(std::begin(check_data), std::end(check_data)), "CRC-A Failed.");
+static_assert(0x2189 == crc16_kermit::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/KERMIT Failed.");
+static_assert(0x4B37 == crc16_modbus::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/MODBUS Failed.");
+static_assert(0x906E == crc16_x_25::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/X-25 Failed.");
+static_assert(0x31C3 == crc16_xmodem::calculate(std::begin(check_data), std::end(check_data)), "CRC-16/XMODEM Failed.");
+static_assert(0xCBF43926 == crc32::calculate(std::begin(check_data), std::end(check_data)), "CRC-32 Failed.");
+static_assert(0xFC891918 == crc32_bzip2::calculate(std::begin(check_data), std::end(check_data)), "CRC-32/BZIP2 Failed.");
+static_assert(0xE3069283 == crc32c::calculate(std::begin(check_data), std::end(check_data)), "CRC-32C Failed.");
+static_assert(0x87315576 == crc32d::calculate(std::begin(check_data), std::end(check_data)), "CRC-32D Failed.");
+static_assert(0x0376E6E7 == crc32_mpeg_2::calculate(std::begin(check_data), std::end(check_data)), "CRC-32/MPEG-2 Failed.");
+static_assert(0x765E7680 == crc32_posix::calculate(std::begin(check_data), std::end(check_data)), "CRC-32/POSIX Failed.");
+static_assert(0x3010BF7F == crc32q::calculate(std::begin(check_data), std::end(check_data)), "CRC-32Q Failed.");
+static_assert(0x340BC6D9 == crc32_jamcrc::calculate(std::begin(check_data), std::end(check_data)), "CRC-32/JAMCRC Failed.");
+static_assert(0xBD0BE338 == crc32_xfer::calculate(std::begin(check_data), std::end(check_data)), "CRC-32/XFER Failed.");
+
+static_assert(0x6C40DF5F0B497347 == crc64_ecma_182::calculate(std::begin(check_data), std::end(check_data)), "CRC-64/ECMA-182 Failed.");
+static_assert(0xB90956C775A41001 == crc64_go_iso::calculate(std::begin(check_data), std::end(check_data)), "CRC-64/GO-ISO Failed.");
+static_assert(0x995DC9BBDF1939FA == crc64_xz::calculate(std::begin(check_data), std::end(check_data)), "CRC-64/XZ Failed.");
+// clang-format on
+#endif
+
+} // namespace
+
 class crc_test : public framework::unit_test::suite
 {
 public:
@@ -34,6 +98,11 @@ public:
         add_test([this]() { crc8(); }, "crc8");
         add_test([this]() { crc16(); }, "crc16");
         add_test([this]() { crc32(); }, "crc32");
+        add_test([this]() { crc64(); }, "crc64");
+        add_test([this]() { contiguous_data(); }, "contiguous_data");
+        add_test([this]() { state(); }, "state");
+        add_test([this]() { combine(); }, "combine");
+        add_test([this]() { parallel(); }, "parallel");
     }
 
 private:
@@ -104,6 +173,148 @@ private:
         TEST_ASSERT(0xBD0BE338 == crc32_xfer::calculate(data.begin(), data.end()), "CRC-32/XFER Failed.");
         // clang-format on
     }
+
+    void crc64()
+    {
+        using namespace framework::utils;
+
+        std::vector<framework::uint8> data = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+        // clang-format off
+        TEST_ASSERT(0x6C40DF5F0B497347 == crc64_ecma_182::calculate(data.begin(), data.end()), "CRC-64/ECMA-182 Failed.");
+        TEST_ASSERT(0xB90956C775A41001 == crc64_go_iso::calculate(data.begin(), data.end()), "CRC-64/GO-ISO Failed.");
+        TEST_ASSERT(0x995DC9BBDF1939FA == crc64_xz::calculate(data.begin(), data.end()), "CRC-64/XZ Failed.");
+        // clang-format on
+    }
+
+    void contiguous_data()
+    {
+        using namespace framework::utils;
+
+        const std::vector<framework::uint32> numbers = random_numbers<framework::uint32>(0, 255, 4099);
+        const std::vector<framework::uint8> data(numbers.begin(), numbers.end());
+
+        for (framework::usize offset : {0, 3}) {
+            for (framework::usize size : {0, 1, 7, 8, 9, 15, 16, 17, 33, 63, 64, 65, 79, 80, 1000, 4096}) {
+                const framework::uint8* pointer = data.data() + offset;
+                const std::list<framework::uint8> list(pointer, pointer + size);
+
+                // clang-format off
+                TEST_ASSERT(crc8::calculate(list.begin(), list.end()) == crc8::calculate(pointer, size), "CRC-8 Failed.");
+                TEST_ASSERT(crc8_darc::calculate(list.begin(), list.end()) == crc8_darc::calculate(pointer, size), "CRC-8/DARC Failed.");
+                TEST_ASSERT(crc16_buypas::calculate(list.begin(), list.end()) == crc16_buypas::calculate(pointer, size), "CRC-16/BUYPAS Failed.");
+                TEST_ASSERT(crc16_usb::calculate(list.begin(), list.end()) == crc16_usb::calculate(pointer, size), "CRC-16/USB Failed.");
+                TEST_ASSERT(crc32::calculate(list.begin(), list.end()) == crc32::calculate(pointer, size), "CRC-32 Failed.");
+                TEST_ASSERT(crc32_bzip2::calculate(list.begin(), list.end()) == crc32_bzip2::calculate(pointer, size), "CRC-32/BZIP2 Failed.");
+                TEST_ASSERT(crc32c::calculate(list.begin(), list.end()) == crc32c::calculate(pointer, size), "CRC-32C Failed.");
+                TEST_ASSERT(crc32d::calculate(list.begin(), list.end()) == crc32d::calculate(pointer, size), "CRC-32D Failed.");
+                TEST_ASSERT(crc32_jamcrc::calculate(list.begin(), list.end()) == crc32_jamcrc::calculate(pointer, size), "CRC-32/JAMCRC Failed.");
+                TEST_ASSERT(crc64_ecma_182::calculate(list.begin(), list.end()) == crc64_ecma_182::calculate(pointer, size), "CRC-64/ECMA-182 Failed.");
+                TEST_ASSERT(crc64_go_iso::calculate(list.begin(), list.end()) == crc64_go_iso::calculate(pointer, size), "CRC-64/GO-ISO Failed.");
+                TEST_ASSERT(crc64_xz::calculate(list.begin(), list.end()) == crc64_xz::calculate(pointer, size), "CRC-64/XZ Failed.");
+                // clang-format on
+            }
+        }
+    }
+
+    void state()
+    {
+        using framework::utils::random_numbers;
+
+        const std::vector<framework::uint32> numbers = random_numbers<framework::uint32>(0, 255, 1000);
+        const std::vector<framework::uint8> data(numbers.begin(), numbers.end());
+
+        check_state<framework::utils::crc8_maxim>(data, "CRC-8/MAXIM Failed.");
+        check_state<framework::utils::crc16_ccitt_false>(data, "CRC-16/CCITT-FALSE Failed.");
+        check_state<framework::utils::crc16_x_25>(data, "CRC-16/X-25 Failed.");
+        check_state<framework::utils::crc32>(data, "CRC-32 Failed.");
+        check_state<framework::utils::crc32c>(data, "CRC-32C Failed.");
+        check_state<framework::utils::crc32_posix>(data, "CRC-32/POSIX Failed.");
+        check_state<framework::utils::crc64_xz>(data, "CRC-64/XZ Failed.");
+    }
+
+    void combine()
+    {
+        using framework::utils::random_numbers;
+
+        const std::vector<framework::uint32> numbers = random_numbers<framework::uint32>(0, 255, 300);
+        const std::vector<framework::uint8> data(numbers.begin(), numbers.end());
+
+        check_combine<framework::utils::crc8>(data, "CRC-8 Failed.");
+        check_combine<framework::utils::crc8_rohc>(data, "CRC-8/ROHC Failed.");
+        check_combine<framework::utils::crc16_dds_110>(data, "CRC-16/DDS-110 Failed.");
+        check_combine<framework::utils::crc16_usb>(data, "CRC-16/USB Failed.");
+        check_combine<framework::utils::crc32>(data, "CRC-32 Failed.");
+        check_combine<framework::utils::crc32_bzip2>(data, "CRC-32/BZIP2 Failed.");
+        check_combine<framework::utils::crc32c>(data, "CRC-32C Failed.");
+        check_combine<framework::utils::crc32_xfer>(data, "CRC-32/XFER Failed.");
+        check_combine<framework::utils::crc64_ecma_182>(data, "CRC-64/ECMA-182 Failed.");
+        check_combine<framework::utils::crc64_go_iso>(data, "CRC-64/GO-ISO Failed.");
+    }
+
+    void parallel()
+    {
+        using framework::utils::random_numbers;
+
+        const std::vector<framework::uint32> numbers = random_numbers<framework::uint32>(0, 255, 2 * 1024 * 1024 + 13);
+        const std::vector<framework::uint8> data(numbers.begin(), numbers.end());
+
+        check_parallel<framework::utils::crc8_darc>(data, "CRC-8/DARC Failed.");
+        check_parallel<framework::utils::crc16_genibus>(data, "CRC-16/GENIBUS Failed.");
+        check_parallel<framework::utils::crc32>(data, "CRC-32 Failed.");
+        check_parallel<framework::utils::crc32c>(data, "CRC-32C Failed.");
+        check_parallel<framework::utils::crc32_mpeg_2>(data, "CRC-32/MPEG-2 Failed.");
+        check_parallel<framework::utils::crc64_xz>(data, "CRC-64/XZ Failed.");
+    }
+
+    template <typename Crc>
+    void check_state(const std::vector<framework::uint8>& data, const std::string& message)
+    {
+        const auto expected = Crc::calculate(data.begin(), data.end());
+
+        for (framework::usize chunk_size : {1, 3, 16, 100, 999}) {
+            typename Crc::state crc_state;
+
+            for (framework::usize offset = 0; offset < data.size(); offset += chunk_size) {
+                const framework::usize size = std::min(chunk_size, data.size() - offset);
+                crc_state.feed(data.data() + offset, size);
+            }
+
+            TEST_ASSERT(expected == crc_state.finalize(), message);
+        }
+
+        typename Crc::state crc_state;
+        crc_state.feed(data.begin(), data.begin() + 10);
+        crc_state.reset();
+        crc_state.feed(data.begin(), data.end());
+
+        TEST_ASSERT(expected == crc_state.finalize(), message);
+    }
+
+    template <typename Crc>
+    void check_combine(const std::vector<framework::uint8>& data, const std::string& message)
+    {
+        const auto expected = Crc::calculate(data.data(), data.size());
+
+        for (framework::usize split = 0; split <= data.size(); ++split) {
+            const auto crc_a = Crc::calculate(data.data(), split);
+            const auto crc_b = Crc::calculate(data.data() + split, data.size() - split);
+
+            TEST_ASSERT(expected == Crc::combine(crc_a, crc_b, data.size() - split), message);
+        }
+    }
+
+    template <typename Crc>
+    void check_parallel(const std::vector<framework::uint8>& data, const std::string& message)
+    {
+        const auto expected = Crc::calculate(data.data(), data.size());
+
+        for (framework::usize thread_count : {0, 1, 2, 3, 4, 7}) {
+            TEST_ASSERT(expected == Crc::calculate_parallel(data.data(), data.size(), thread_count), message);
+        }
+
+        TEST_ASSERT(Crc::calculate(data.data(), 100) == Crc::calculate_parallel(data.data(), 100, 4), message);
+    }
 };
 
 int main()
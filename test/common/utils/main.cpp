@@ -23,7 +23,9 @@
 // SOFTWARE.
 // =============================================================================
 
+#include <functional>
 #include <limits>
+#include <string>
 
 #include <common/utils.hpp>
 #include <unit_test/suite.hpp>
@@ -66,39 +68,116 @@ private:
     }
 };
 
-/*
 class format_string_test : public framework::unit_test::suite
 {
 public:
     format_string_test() : suite("format_string_test")
     {
-        add_test([this]() { type_foramting(); }, "type_formating");
+        add_test([this]() { type_formating(); }, "type_formating");
+        add_test([this]() { spec_formating(); }, "spec_formating");
+        add_test([this]() { compile_time_format(); }, "compile_time_format");
+        add_test([this]() { format_errors(); }, "format_errors");
     }
 
 private:
-    void type_foramting()
+    struct point
+    {
+        int x;
+        int y;
+    };
+
+    friend std::ostream& operator<<(std::ostream& stream, const point& p)
+    {
+        return stream << "(" << p.x << ", " << p.y << ")";
+    }
+
+    void type_formating()
     {
         using framework::utils::format;
 
         TEST_ASSERT(format("{0}", 1) == "1", "Wrong number formating.");
+        TEST_ASSERT(format("{}", -42ll) == "-42", "Wrong number formating.");
+        TEST_ASSERT(format("{}", 18446744073709551615ull) == "18446744073709551615", "Wrong number formating.");
 
-        TEST_ASSERT(format("{0}", 1.123456789) == "1.12346", "Wrong floating-point number formating.");
+        TEST_ASSERT(format("{0}", 1.123456789) == "1.123456789", "Wrong floating-point number formating.");
+        TEST_ASSERT(format("{}", 0.1f) == "0.1", "Wrong floating-point number formating.");
 
         TEST_ASSERT(format("{0}", "string") == "string", "Wrong string formating.");
+        TEST_ASSERT(format("{}", std::string("string")) == "string", "Wrong string formating.");
+        TEST_ASSERT(format("{} {}", true, 'c') == "true c", "Wrong bool or char formating.");
+        TEST_ASSERT(format("{}", point{1, 2}) == "(1, 2)", "Wrong custom type formating.");
+        TEST_ASSERT(format("{}", nullptr) == "0x0", "Wrong pointer formating.");
 
         TEST_ASSERT(format("{{{0}}}", "string") == "{string}", "Wrong braces formating.");
         TEST_ASSERT(format("{0}}}", "string") == "string}", "Wrong braces formating.");
         TEST_ASSERT(format("{{{0}", "string") == "{string", "Wrong braces formating.");
+        TEST_ASSERT(format("{1} {0}", "a", "b") == "b a", "Wrong argument indexing.");
+    }
+
+    void spec_formating()
+    {
+        using framework::utils::format;
+
+        TEST_ASSERT(format("{:.3f}", 1.23456) == "1.235", "Wrong precision.");
+        TEST_ASSERT(format("{:e}", 1.5) == "1.500000e+00", "Wrong scientific formating.");
+        TEST_ASSERT(format("{:.2E}", 1234.5) == "1.23E+03", "Wrong scientific formating.");
+        TEST_ASSERT(format("{:08.2f}", -3.14159) == "-0003.14", "Wrong zero padding.");
+        TEST_ASSERT(format("{:+}", 5) == "+5", "Wrong sign.");
+
+        TEST_ASSERT(format("{:x} {:X} {:o} {:b}", 255, 255, 8, 5) == "ff FF 10 101", "Wrong integer base.");
+        TEST_ASSERT(format("{:#06x}", 255) == "0x00ff", "Wrong alternate form.");
+        TEST_ASSERT(format("{:c}", 65) == "A", "Wrong character formating.");
+
+        TEST_ASSERT(format("{:>6}", "ab") == "    ab", "Wrong alignment.");
+        TEST_ASSERT(format("{:6}", "ab") == "ab    ", "Wrong alignment.");
+        TEST_ASSERT(format("{:*^6}", "ab") == "**ab**", "Wrong alignment.");
+        TEST_ASSERT(format("{:6}", 42) == "    42", "Wrong alignment.");
+        TEST_ASSERT(format("{:<8}|", point{1, 2}) == "(1, 2)  |", "Wrong alignment.");
+        TEST_ASSERT(format("{:.3}", "abcdef") == "abc", "Wrong string precision.");
+    }
+
+    void compile_time_format()
+    {
+        using framework::utils::format;
+
+        TEST_ASSERT(format(FRAMEWORK_FORMAT_STRING("{}: {:.3f}"), "value", 1.23456) == "value: 1.235",
+                    "Wrong compile time formating.");
+        TEST_ASSERT(format(FRAMEWORK_FORMAT_STRING("{{{:>4}}}"), 7) == "{   7}", "Wrong compile time formating.");
+        TEST_ASSERT(format(FRAMEWORK_FORMAT_STRING("")).empty(), "Wrong compile time formating.");
+
+        static_assert(framework::utils::format_details::check_format<int, float>("{} {:.2f}"),
+                      "Format string should be valid.");
+    }
+
+    void format_errors()
+    {
+        using framework::utils::format;
+
+        error_test([] { format("{{0}}}", "string"); }, "Single '}' in format string");
+        error_test([] { format("0}}}", "string"); }, "Single '}' in format string");
+        error_test([] { format("{{{0", "string"); }, "'}' expected");
+        error_test([] { format("{1}", "string"); }, "Argument index out of range");
+        error_test([] { format("{0} {}", 1, 2); },
+                   "Cannot switch from manual field specification mode to automatic field numbering");
+        error_test([] { format("{:d}", "string"); }, "Format specifier does not match the argument type");
+        error_test([] { format("{:.}", 1.0); }, "Precision value expected after '.'");
+        error_test([] { format("{:.2}", 1); }, "Precision requires floating-point or string argument");
+    }
+
+    void error_test(const std::function<void()>& function, const std::string& message)
+    {
+        try {
+            function();
+        } catch (const framework::utils::format_error& error) {
+            TEST_ASSERT(message == error.what(), "Wrong error message: " + std::string(error.what()));
+            return;
+        }
 
-        // ERROR_TEST(make_string("{{0}}}", "string"), "Single '}' in format string");
-        // ERROR_TEST(make_string("{{{0}}", "string"), "Single '}' in format string");
-        // ERROR_TEST(make_string("0}}}", "string"), "Single '}' in format string");
-        // ERROR_TEST(make_string("{{{0", "string"), "'}' expected");
+        TEST_FAIL("Format error is not thrown.");
     }
 };
-*/
 
 int main()
 {
-    return run_tests(random_numbers_test());
+    return run_tests(random_numbers_test(), format_string_test());
 }
@@ -0,0 +1,335 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <log/log.hpp>
+#include <log/stream_logger.hpp>
+#include <unit_test/suite.hpp>
+
+namespace
+{
+std::atomic<std::size_t> allocations_count{0};
+
+void* allocate(std::size_t size) noexcept
+{
+    allocations_count.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocate(std::size_t size, std::align_val_t alignment) noexcept
+{
+    allocations_count.fetch_add(1, std::memory_order_relaxed);
+
+    const auto align = static_cast<std::size_t>(alignment);
+    size             = size == 0 ? align : (size + align - 1) / align * align;
+#if defined(_WIN32)
+    return _aligned_malloc(size, align);
+#else
+    return std::aligned_alloc(align, size);
+#endif
+}
+
+void deallocate(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void deallocate(void* pointer, std::align_val_t /*alignment*/) noexcept
+{
+#if defined(_WIN32)
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+template <typename... Args>
+void* allocate_or_throw(Args... args)
+{
+    if (void* pointer = allocate(args...)) {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+// The whole set is replaced, so every form of new is paired with the matching delete.
+// GCC can't see that through the replacement and warns about malloc memory passed to delete.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    return allocate_or_throw(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate_or_throw(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate_or_throw(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate_or_throw(size, alignment);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept
+{
+    return allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept
+{
+    return allocate(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t& /*tag*/) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t& /*tag*/) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, alignment);
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, alignment);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, alignment);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, alignment);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept
+{
+    deallocate(pointer, alignment);
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept
+{
+    deallocate(pointer, alignment);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+using ::framework::log::info;
+using ::framework::log::logger_base;
+using ::framework::log::set_logger;
+using ::framework::log::severity_level;
+using ::framework::log::stream_logger;
+
+namespace
+{
+constexpr char log_tag[] = "allocations";
+
+class counting_logger : public logger_base
+{
+public:
+    explicit counting_logger(std::vector<std::string>& messages) : m_messages(messages)
+    {}
+
+    void add_message(severity_level level, const std::string& tag, const std::string& message) override
+    {
+        add_message(level, std::string_view(tag), std::string_view(message));
+    }
+
+    void add_message(severity_level /*level*/, std::string_view /*tag*/, std::string_view message) override
+    {
+        if (m_messages.size() < m_messages.capacity()) {
+            m_messages.emplace_back(message);
+        }
+    }
+
+private:
+    std::vector<std::string>& m_messages;
+};
+
+class null_buffer : public std::streambuf
+{
+protected:
+    int overflow(int character) override
+    {
+        return character;
+    }
+
+    std::streamsize xsputn(const char* /*data*/, std::streamsize count) override
+    {
+        return count;
+    }
+};
+
+struct nested
+{};
+
+std::ostream& operator<<(std::ostream& stream, nested /*value*/)
+{
+    info(log_tag) << std::string(1000, 'b') << std::endl;
+    return stream << "nested";
+}
+
+} // namespace
+
+class allocations_test : public framework::unit_test::suite
+{
+public:
+    allocations_test() : suite("allocations_test")
+    {
+        add_test([this]() { short_message(); }, "short_message");
+        add_test([this]() { long_message(); }, "long_message");
+        add_test([this]() { stream_logger_message(); }, "stream_logger_message");
+        add_test([this]() { nested_message(); }, "nested_message");
+    }
+
+private:
+    void short_message()
+    {
+        std::vector<std::string> messages;
+        set_logger(std::make_unique<counting_logger>(messages));
+
+        info(log_tag) << "warm up " << 1 << " " << 0.5f << std::endl;
+
+        const std::size_t before = allocations_count.load();
+
+        for (int i = 0; i < 100; ++i) {
+            info(log_tag) << "value " << i << " " << 0.5f << std::endl;
+        }
+
+        TEST_ASSERT(allocations_count.load() == before, "Short messages should not allocate memory.");
+    }
+
+    void long_message()
+    {
+        std::vector<std::string> messages;
+        set_logger(std::make_unique<counting_logger>(messages));
+
+        const std::string text(4000, 'a');
+
+        info(log_tag) << text << std::endl;
+
+        const std::size_t before = allocations_count.load();
+
+        for (int i = 0; i < 100; ++i) {
+            info(log_tag) << text << i << std::endl;
+        }
+
+        TEST_ASSERT(allocations_count.load() == before, "Long messages should reuse thread storage.");
+    }
+
+    void stream_logger_message()
+    {
+        null_buffer buffer;
+        std::ostream output(&buffer);
+        set_logger(std::make_unique<stream_logger>(output, false));
+
+        info(log_tag) << "warm up" << std::endl;
+
+        const std::size_t before = allocations_count.load();
+
+        for (int i = 0; i < 100; ++i) {
+            info(log_tag) << "value " << i << std::endl;
+        }
+
+        TEST_ASSERT(allocations_count.load() == before, "Stream logger should not allocate memory.");
+    }
+
+    void nested_message()
+    {
+        std::vector<std::string> messages;
+        messages.reserve(2);
+        set_logger(std::make_unique<counting_logger>(messages));
+
+        info(log_tag) << std::string(1000, 'a') << nested() << std::endl;
+
+        TEST_ASSERT(messages.size() == 2, "Wrong messages count.");
+        TEST_ASSERT(messages[0] == std::string(1000, 'b') + "\n", "Nested message is not correct.");
+        TEST_ASSERT(messages[1] == std::string(1000, 'a') + "nested\n", "Outer message is not correct.");
+    }
+};
+
+int main()
+{
+    return run_tests(allocations_test());
+}
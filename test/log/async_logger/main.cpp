@@ -0,0 +1,211 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log/async_logger.hpp>
+#include <log/stream_logger.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::log::async_logger;
+using ::framework::log::logger_base;
+using ::framework::log::overflow_policy;
+using ::framework::log::severity_level;
+using ::framework::log::stream_logger;
+
+namespace
+{
+/// Stores messages and can hold the writer thread inside add_message.
+class gate_logger : public logger_base
+{
+public:
+    using logger_base::add_message;
+
+    void add_message(severity_level /*level*/, const std::string& /*tag*/, const std::string& message) override
+    {
+        std::unique_lock lock(m_mutex);
+
+        m_messages.push_back(message);
+        m_entered = true;
+        m_condition.notify_all();
+        m_condition.wait(lock, [this]() { return m_open; });
+    }
+
+    void close()
+    {
+        std::lock_guard lock(m_mutex);
+        m_open = false;
+    }
+
+    void open()
+    {
+        std::lock_guard lock(m_mutex);
+        m_open = true;
+        m_condition.notify_all();
+    }
+
+    void wait_entered()
+    {
+        std::unique_lock lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_entered; });
+    }
+
+    std::vector<std::string> messages()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_messages;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<std::string> m_messages;
+    bool m_open    = true;
+    bool m_entered = false;
+};
+
+} // namespace
+
+class async_logger_test : public framework::unit_test::suite
+{
+public:
+    async_logger_test() : suite("async_logger_test")
+    {
+        add_test([this]() { message_order(); }, "message_order");
+        add_test([this]() { block_policy(); }, "block_policy");
+        add_test([this]() { drop_newest_policy(); }, "drop_newest_policy");
+        add_test([this]() { drop_oldest_policy(); }, "drop_oldest_policy");
+    }
+
+private:
+    void message_order()
+    {
+        std::stringstream log_stream;
+        std::stringstream log_test;
+
+        async_logger logger(std::make_unique<stream_logger>(log_stream, false), 8);
+
+        for (int i = 0; i < 1000; ++i) {
+            logger.add_message(severity_level::info, name(), "message " + std::to_string(i) + "\n");
+            log_test << "[" << severity_level::info << "] " << name() << ": message " << i << "\n";
+        }
+
+        logger.flush();
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Log messages are not correct.");
+        TEST_ASSERT(logger.dropped_count() == 0, "Messages should not be dropped.");
+    }
+
+    void block_policy()
+    {
+        constexpr int threads_count  = 4;
+        constexpr int messages_count = 1000;
+
+        std::stringstream log_stream;
+        async_logger logger(std::make_unique<stream_logger>(log_stream, false), 16, overflow_policy::block);
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread) {
+            threads.emplace_back([this, &logger, thread]() {
+                for (int i = 0; i < messages_count; ++i) {
+                    logger.add_message(severity_level::info, name(), std::to_string(thread) + "\n");
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        logger.flush();
+
+        std::string line;
+        int lines_count = 0;
+        while (std::getline(log_stream, line)) {
+            ++lines_count;
+        }
+
+        TEST_ASSERT(lines_count == threads_count * messages_count, "Messages are lost.");
+        TEST_ASSERT(logger.dropped_count() == 0, "Messages should not be dropped.");
+    }
+
+    void drop_newest_policy()
+    {
+        auto sink         = std::make_unique<gate_logger>();
+        gate_logger* gate = sink.get();
+
+        async_logger logger(std::move(sink), 4, overflow_policy::drop_newest);
+
+        gate->close();
+        logger.add_message(severity_level::info, name(), "0");
+        gate->wait_entered();
+
+        for (int i = 1; i <= 8; ++i) {
+            logger.add_message(severity_level::info, name(), std::to_string(i));
+        }
+
+        gate->open();
+        logger.flush();
+
+        const std::vector<std::string> expected = {"0", "1", "2", "3", "4"};
+
+        TEST_ASSERT(gate->messages() == expected, "Wrong messages are dropped.");
+        TEST_ASSERT(logger.dropped_count() == 4, "Wrong dropped messages count.");
+    }
+
+    void drop_oldest_policy()
+    {
+        auto sink         = std::make_unique<gate_logger>();
+        gate_logger* gate = sink.get();
+
+        async_logger logger(std::move(sink), 4, overflow_policy::drop_oldest);
+
+        gate->close();
+        logger.add_message(severity_level::info, name(), "0");
+        gate->wait_entered();
+
+        for (int i = 1; i <= 8; ++i) {
+            logger.add_message(severity_level::info, name(), std::to_string(i));
+        }
+
+        gate->open();
+        logger.flush();
+
+        const std::vector<std::string> expected = {"0", "5", "6", "7", "8"};
+
+        TEST_ASSERT(gate->messages() == expected, "Wrong messages are dropped.");
+        TEST_ASSERT(logger.dropped_count() == 4, "Wrong dropped messages count.");
+    }
+};
+
+int main()
+{
+    return run_tests(async_logger_test());
+}
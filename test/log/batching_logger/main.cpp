@@ -0,0 +1,271 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <log/batching_logger.hpp>
+#include <log/stream_logger.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::log::batching_logger;
+using ::framework::log::logger_base;
+using ::framework::log::record;
+using ::framework::log::severity_level;
+using ::framework::log::stream_logger;
+
+namespace
+{
+/// Remembers sizes of received batches.
+struct batches_info
+{
+    std::mutex mutex;
+    std::vector<std::size_t> sizes;
+    std::vector<std::string> messages;
+
+    std::vector<std::size_t> get_sizes()
+    {
+        std::lock_guard lock(mutex);
+        return sizes;
+    }
+
+    std::vector<std::string> get_messages()
+    {
+        std::lock_guard lock(mutex);
+        return messages;
+    }
+};
+
+class counting_logger : public logger_base
+{
+public:
+    explicit counting_logger(batches_info& info) : m_info(info)
+    {}
+
+    void add_message(severity_level /*level*/, const std::string& /*tag*/, const std::string& message) override
+    {
+        std::lock_guard lock(m_info.mutex);
+
+        m_info.sizes.push_back(1);
+        m_info.messages.push_back(message);
+    }
+
+    void add_messages(const record* records, std::size_t count) override
+    {
+        std::lock_guard lock(m_info.mutex);
+
+        m_info.sizes.push_back(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            m_info.messages.emplace_back(records[i].message);
+        }
+    }
+
+private:
+    batches_info& m_info;
+};
+
+/// Logs back into the batching logger from the sink.
+class echo_logger : public logger_base
+{
+public:
+    explicit echo_logger(batches_info& info) : m_info(info)
+    {}
+
+    void add_message(severity_level /*level*/, const std::string& /*tag*/, const std::string& message) override
+    {
+        std::lock_guard lock(m_info.mutex);
+        m_info.messages.push_back(message);
+    }
+
+    void add_messages(const record* records, std::size_t count) override
+    {
+        {
+            std::lock_guard lock(m_info.mutex);
+            for (std::size_t i = 0; i < count; ++i) {
+                m_info.messages.emplace_back(records[i].message);
+            }
+        }
+
+        if (owner != nullptr && count > 0 && records[0].message != "echo") {
+            owner->add_message(severity_level::error, std::string_view("echo"), std::string_view("echo"));
+            owner->flush();
+        }
+    }
+
+    logger_base* owner = nullptr;
+
+private:
+    batches_info& m_info;
+};
+
+} // namespace
+
+class batching_logger_test : public framework::unit_test::suite
+{
+public:
+    batching_logger_test() : suite("batching_logger_test")
+    {
+        add_test([this]() { batch_size(); }, "batch_size");
+        add_test([this]() { severity_flush(); }, "severity_flush");
+        add_test([this]() { interval_flush(); }, "interval_flush");
+        add_test([this]() { thread_exit(); }, "thread_exit");
+        add_test([this]() { stream_output(); }, "stream_output");
+        add_test([this]() { logging_sink(); }, "logging_sink");
+    }
+
+private:
+    void batch_size()
+    {
+        batches_info info;
+
+        {
+            batching_logger logger(std::make_unique<counting_logger>(info), 4, std::chrono::hours(1));
+
+            for (int i = 0; i < 10; ++i) {
+                logger.add_message(severity_level::info, name(), std::to_string(i));
+            }
+
+            TEST_ASSERT(info.get_sizes() == std::vector<std::size_t>({4, 4}), "Batches are not full.");
+
+            logger.flush();
+
+            TEST_ASSERT(info.get_sizes() == std::vector<std::size_t>({4, 4, 2}), "Flush doesn't write batch.");
+        }
+
+        const std::vector<std::string> expected = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"};
+        TEST_ASSERT(info.get_messages() == expected, "Messages are not correct.");
+    }
+
+    void severity_flush()
+    {
+        batches_info info;
+        batching_logger logger(std::make_unique<counting_logger>(info), 64, std::chrono::hours(1));
+
+        logger.add_message(severity_level::warning, name(), "1");
+        logger.add_message(severity_level::info, name(), "2");
+
+        TEST_ASSERT(info.get_sizes().empty(), "Batch is written too early.");
+
+        logger.add_message(severity_level::error, name(), "3");
+
+        TEST_ASSERT(info.get_sizes() == std::vector<std::size_t>({3}), "Error doesn't write batch.");
+
+        logger.add_message(severity_level::fatal, name(), "4");
+
+        TEST_ASSERT(info.get_sizes() == std::vector<std::size_t>({3, 1}), "Fatal doesn't write batch.");
+    }
+
+    void interval_flush()
+    {
+        batches_info info;
+        batching_logger logger(std::make_unique<counting_logger>(info), 64, std::chrono::milliseconds(10));
+
+        logger.add_message(severity_level::info, name(), "1");
+        logger.add_message(severity_level::info, name(), "2");
+
+        // No more messages, the flusher writes the batch.
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (info.get_sizes().empty() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        TEST_ASSERT(info.get_sizes() == std::vector<std::size_t>({2}), "Interval doesn't write batch.");
+    }
+
+    void thread_exit()
+    {
+        constexpr int threads_count  = 4;
+        constexpr int messages_count = 100;
+
+        batches_info info;
+        batching_logger logger(std::make_unique<counting_logger>(info), 64, std::chrono::hours(1));
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread) {
+            threads.emplace_back([this, &logger]() {
+                for (int i = 0; i < messages_count; ++i) {
+                    logger.add_message(severity_level::info, name(), std::to_string(i));
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        std::size_t total = 0;
+        for (auto size : info.get_sizes()) {
+            TEST_ASSERT(size <= 64, "Batch is too large.");
+            total += size;
+        }
+
+        TEST_ASSERT(total == threads_count * messages_count, "Messages are lost on thread exit.");
+    }
+
+    void stream_output()
+    {
+        std::stringstream log_stream;
+        std::stringstream log_test;
+
+        {
+            batching_logger logger(std::make_unique<stream_logger>(log_stream, false), 16);
+
+            for (int i = 0; i < 100; ++i) {
+                logger.add_message(severity_level::info, name(), "message " + std::to_string(i) + "\n");
+                log_test << "[" << severity_level::info << "] " << name() << ": message " << i << "\n";
+            }
+        }
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Log messages are not correct.");
+    }
+
+    void logging_sink()
+    {
+        batches_info info;
+
+        auto sink   = std::make_unique<echo_logger>(info);
+        auto& owner = sink->owner;
+
+        batching_logger logger(std::move(sink), 2, std::chrono::hours(1));
+        owner = &logger;
+
+        logger.add_message(severity_level::info, name(), "1");
+        logger.add_message(severity_level::info, name(), "2");
+        logger.flush();
+
+        const std::vector<std::string> expected = {"1", "2", "echo"};
+        TEST_ASSERT(info.get_messages() == expected, "Messages logged by the sink are lost.");
+    }
+};
+
+int main()
+{
+    return run_tests(batching_logger_test());
+}
@@ -0,0 +1,280 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log/binary_log_reader.hpp>
+#include <log/binary_logger.hpp>
+#include <log/log.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::usize;
+using ::framework::log::binary_log_reader;
+using ::framework::log::binary_logger;
+using ::framework::log::binary_record;
+using ::framework::log::severity_level;
+
+namespace
+{
+std::string file_name(const std::string& path, usize index)
+{
+    return index == 0 ? path : path + "." + std::to_string(index);
+}
+
+void remove_files(const std::string& path, usize count)
+{
+    for (usize i = 0; i < count; ++i) {
+        std::remove(file_name(path, i).c_str());
+    }
+}
+
+bool file_exists(const std::string& path)
+{
+    return std::ifstream(path).good();
+}
+
+std::vector<binary_record> read_all(const std::string& path)
+{
+    std::vector<binary_record> records;
+
+    binary_log_reader reader(path);
+    binary_record record;
+    while (reader.next(record)) {
+        records.push_back(record);
+    }
+
+    return records;
+}
+
+} // namespace
+
+class binary_logger_test : public framework::unit_test::suite
+{
+public:
+    binary_logger_test() : suite("binary_logger_test")
+    {
+        add_test([this]() { typed_arguments(); }, "typed_arguments");
+        add_test([this]() { text_messages(); }, "text_messages");
+        add_test([this]() { call_site(); }, "call_site");
+        add_test([this]() { empty_strings(); }, "empty_strings");
+        add_test([this]() { rotation(); }, "rotation");
+        add_test([this]() { thread_safety(); }, "thread_safety");
+    }
+
+private:
+    void typed_arguments()
+    {
+        const std::string path = "binary_logger_typed.blog";
+        remove_files(path, 1);
+
+        {
+            binary_logger logger(path);
+            logger.write(severity_level::info, "tag_1", "int {} uint {} float {:.3f}", -42, 42u, 3.14159);
+            logger.write(severity_level::error, "tag_2", "bool {} char {} string {}", true, 'c', std::string("text"));
+            logger.write(severity_level::debug, "tag_1", "hex {:x} braces {{}} missing {}", 255u);
+            logger.write(severity_level::warning, "tag_3", "no arguments");
+        }
+
+        const std::vector<binary_record> records = read_all(path);
+
+        TEST_ASSERT(records.size() == 4, "Wrong records count.");
+        TEST_ASSERT(records[0].message == "int -42 uint 42 float 3.142", "Wrong integer message.");
+        TEST_ASSERT(records[0].tag == "tag_1", "Wrong tag.");
+        TEST_ASSERT(records[0].level == severity_level::info, "Wrong level.");
+        TEST_ASSERT(records[1].message == "bool true char c string text", "Wrong string message.");
+        TEST_ASSERT(records[1].tag == "tag_2", "Wrong tag.");
+        TEST_ASSERT(records[1].level == severity_level::error, "Wrong level.");
+        TEST_ASSERT(records[2].message == "hex ff braces {} missing {}", "Wrong format handling.");
+        TEST_ASSERT(records[2].tag == "tag_1", "Wrong tag.");
+        TEST_ASSERT(records[3].message == "no arguments", "Wrong message without arguments.");
+        TEST_ASSERT(records[0].timestamp <= records[3].timestamp, "Wrong timestamps.");
+
+        remove_files(path, 1);
+    }
+
+    void text_messages()
+    {
+        const std::string path = "binary_logger_text.blog";
+        remove_files(path, 1);
+
+        ::framework::log::set_logger(std::make_unique<binary_logger>(path));
+        ::framework::log::info(name()) << "message " << 1 << std::endl;
+        ::framework::log::warning(name()) << "message " << 2 << std::endl;
+        ::framework::log::set_logger(nullptr);
+
+        const std::vector<binary_record> records = read_all(path);
+
+        TEST_ASSERT(records.size() == 2, "Wrong records count.");
+        TEST_ASSERT(records[0].message == "message 1\n", "Wrong message.");
+        TEST_ASSERT(records[0].tag == name(), "Wrong tag.");
+        TEST_ASSERT(records[1].message == "message 2\n", "Wrong message.");
+        TEST_ASSERT(records[1].level == severity_level::warning, "Wrong level.");
+
+        remove_files(path, 1);
+    }
+
+    void call_site()
+    {
+        const std::string first_path  = "binary_logger_site_1.blog";
+        const std::string second_path = "binary_logger_site_2.blog";
+        remove_files(first_path, 1);
+        remove_files(second_path, 1);
+
+        {
+            binary_logger first(first_path);
+            binary_logger second(second_path);
+
+            // Different id order in the loggers, the cached ids must not leak between them.
+            second.write(severity_level::info, "other", "other {}", 0);
+
+            // One statement shared by both loggers.
+            for (int i = 0; i < 4; ++i) {
+                binary_logger& logger = (i % 2 == 0) ? first : second;
+                FRAMEWORK_LOG_BINARY(logger, info, "site", "value {}", i / 2);
+            }
+        }
+
+        const std::vector<binary_record> first_records  = read_all(first_path);
+        const std::vector<binary_record> second_records = read_all(second_path);
+
+        TEST_ASSERT(first_records.size() == 2, "Wrong records count.");
+        TEST_ASSERT(second_records.size() == 3, "Wrong records count.");
+        TEST_ASSERT(first_records[1].message == "value 1", "Wrong message.");
+        TEST_ASSERT(first_records[1].tag == "site", "Wrong tag.");
+        TEST_ASSERT(second_records[2].message == "value 1", "Wrong message.");
+        TEST_ASSERT(second_records[2].tag == "site", "Wrong tag.");
+        TEST_ASSERT(second_records[2].level == severity_level::info, "Wrong level.");
+
+        remove_files(first_path, 1);
+        remove_files(second_path, 1);
+    }
+
+    void empty_strings()
+    {
+        const std::string path = "binary_logger_empty.blog";
+        remove_files(path, 1);
+
+        {
+            binary_logger logger(path);
+            logger.write(severity_level::info, std::string_view(), std::string_view());
+            logger.add_message(severity_level::info, std::string_view(), std::string_view());
+        }
+
+        const std::vector<binary_record> records = read_all(path);
+
+        TEST_ASSERT(records.size() == 2, "Wrong records count.");
+        TEST_ASSERT(records[0].tag.empty() && records[0].message.empty(), "Wrong empty message.");
+        TEST_ASSERT(records[1].tag.empty() && records[1].message.empty(), "Wrong empty text message.");
+
+        remove_files(path, 1);
+    }
+
+    void rotation()
+    {
+        const std::string path = "binary_logger_rotation.blog";
+        remove_files(path, 4);
+
+        {
+            binary_logger logger(path, 4096, 3);
+            for (int i = 0; i < 1000; ++i) {
+                logger.write(severity_level::info, "rotation", "message {}", i);
+            }
+        }
+
+        TEST_ASSERT(file_exists(file_name(path, 0)), "Current file is missing.");
+        TEST_ASSERT(file_exists(file_name(path, 1)), "Rotated file is missing.");
+        TEST_ASSERT(file_exists(file_name(path, 2)), "Rotated file is missing.");
+        TEST_ASSERT(!file_exists(file_name(path, 3)), "Too many files are retained.");
+
+        // Messages are continuous from the oldest to the newest file.
+        int expected = -1;
+        for (usize index = 3; index-- > 0;) {
+            for (const auto& record : read_all(file_name(path, index))) {
+                TEST_ASSERT(record.tag == "rotation", "Wrong tag.");
+                if (expected >= 0) {
+                    TEST_ASSERT(record.message == "message " + std::to_string(expected), "Wrong message order.");
+                }
+                expected = std::stoi(record.message.substr(8)) + 1;
+            }
+        }
+
+        TEST_ASSERT(expected == 1000, "Last message is missing.");
+
+        remove_files(path, 4);
+    }
+
+    void thread_safety()
+    {
+        constexpr int threads_count  = 4;
+        constexpr int messages_count = 1000;
+        constexpr usize files_count  = 16;
+
+        const std::string path = "binary_logger_threads.blog";
+        remove_files(path, files_count);
+
+        {
+            binary_logger logger(path, 16 * 1024, files_count);
+
+            std::vector<std::thread> threads;
+            for (int thread = 0; thread < threads_count; ++thread) {
+                threads.emplace_back([&logger, thread]() {
+                    const std::string tag = "thread_" + std::to_string(thread);
+                    for (int i = 0; i < messages_count; ++i) {
+                        logger.write(severity_level::info, tag, "message {}", i);
+                    }
+                });
+            }
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            TEST_ASSERT(logger.dropped_count() == 0, "Messages should not be dropped.");
+        }
+
+        TEST_ASSERT(!file_exists(file_name(path, files_count - 1)), "Too many files are written.");
+
+        usize records_count = 0;
+        for (usize index = 0; index < files_count && file_exists(file_name(path, index)); ++index) {
+            for (const auto& record : read_all(file_name(path, index))) {
+                TEST_ASSERT(record.tag.compare(0, 7, "thread_") == 0, "Wrong tag.");
+                ++records_count;
+            }
+        }
+
+        TEST_ASSERT(records_count == threads_count * messages_count, "Messages are lost.");
+
+        remove_files(path, files_count);
+    }
+};
+
+int main()
+{
+    return run_tests(binary_logger_test());
+}
@@ -0,0 +1,320 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <log/file_logger.hpp>
+#include <log/log.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::usize;
+using ::framework::log::file_logger;
+using ::framework::log::severity_level;
+using ::framework::log::log_details::thread_index;
+using ::framework::log::log_details::timestamp_formatter;
+
+namespace
+{
+std::string file_name(const std::string& path, usize index)
+{
+    return index == 0 ? path : path + "." + std::to_string(index);
+}
+
+void remove_files(const std::string& path, usize count)
+{
+    for (usize i = 0; i < count; ++i) {
+        std::remove(file_name(path, i).c_str());
+    }
+}
+
+bool file_exists(const std::string& path)
+{
+    return std::ifstream(path).good();
+}
+
+std::string read_file(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    std::stringstream content;
+    content << file.rdbuf();
+
+    return content.str();
+}
+
+/// Reads the file and removes timestamps from the line starts.
+std::string read_messages(const std::string& path)
+{
+    const std::string content = read_file(path);
+
+    std::string result;
+    for (usize start = 0; start < content.size();) {
+        usize end = content.find('\n', start);
+        end       = end == std::string::npos ? content.size() : end + 1;
+
+        const usize message = std::min(start + timestamp_formatter::size + 1, end);
+        result.append(content, message, end - message);
+        start = end;
+    }
+
+    return result;
+}
+
+/// Days since 1970-01-01 of the civil date.
+long days_from_civil(int year, int month, int day)
+{
+    year -= month <= 2 ? 1 : 0;
+
+    const int era         = (year >= 0 ? year : year - 399) / 400;
+    const int year_of_era = year - era * 400;
+    const int day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int day_of_era  = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+    return era * 146097L + day_of_era - 719468L;
+}
+
+std::string prefix(severity_level level, const std::string& tag)
+{
+    std::stringstream stream;
+    stream << "[" << level << "] #" << thread_index() << " " << tag << ": ";
+    return stream.str();
+}
+
+} // namespace
+
+class file_logger_test : public framework::unit_test::suite
+{
+public:
+    file_logger_test() : suite("file_logger_test")
+    {
+        add_test([this]() { messages(); }, "messages");
+        add_test([this]() { error_write(); }, "error_write");
+        add_test([this]() { size_rotation(); }, "size_rotation");
+        add_test([this]() { time_rotation(); }, "time_rotation");
+        add_test([this]() { record_context(); }, "record_context");
+#if !defined(_WIN32)
+        add_test([this]() { reopen_failure(); }, "reopen_failure");
+#endif
+    }
+
+private:
+    void messages()
+    {
+        const std::string path = "file_logger_messages.log";
+        remove_files(path, 2);
+
+        std::stringstream log_test;
+
+        {
+            file_logger logger(path);
+
+            for (int i = 0; i < 10000; ++i) {
+                logger.add_message(severity_level::info, name(), "message " + std::to_string(i) + "\n");
+                log_test << prefix(severity_level::info, name()) << "message " << i << "\n";
+            }
+
+            const std::string long_message(file_logger::buffer_size * 2, 'a');
+            logger.add_message(severity_level::debug, name(), long_message);
+            log_test << prefix(severity_level::debug, name()) << long_message;
+
+            logger.flush();
+
+            TEST_ASSERT(read_messages(path) == log_test.str(), "Flush doesn't write messages.");
+        }
+
+        TEST_ASSERT(read_messages(path) == log_test.str(), "Log messages are not correct.");
+
+        remove_files(path, 2);
+    }
+
+    void error_write()
+    {
+        const std::string path = "file_logger_error.log";
+        remove_files(path, 2);
+
+        {
+            file_logger logger(path, 1024 * 1024, 2, std::chrono::seconds::zero(), true);
+
+            logger.add_message(severity_level::info, name(), "info\n");
+
+            TEST_ASSERT(read_file(path).empty(), "Messages should be buffered.");
+
+            logger.add_message(severity_level::error, name(), "error\n");
+
+            const std::string expected = prefix(severity_level::info, name()) + "info\n" +
+                                         prefix(severity_level::error, name()) + "error\n";
+            TEST_ASSERT(read_messages(path) == expected, "Error doesn't write buffer.");
+        }
+
+        remove_files(path, 2);
+    }
+
+    void size_rotation()
+    {
+        constexpr usize file_size = 1024;
+
+        const std::string path = "file_logger_rotation.log";
+        remove_files(path, 4);
+
+        {
+            file_logger logger(path, file_size, 3);
+
+            for (int i = 0; i < 1000; ++i) {
+                logger.add_message(severity_level::info, name(), std::to_string(i) + "\n");
+            }
+        }
+
+        TEST_ASSERT(file_exists(file_name(path, 0)), "Current file is missing.");
+        TEST_ASSERT(file_exists(file_name(path, 1)), "Rotated file is missing.");
+        TEST_ASSERT(file_exists(file_name(path, 2)), "Rotated file is missing.");
+        TEST_ASSERT(!file_exists(file_name(path, 3)), "Too many files are retained.");
+
+        std::string content;
+        for (usize index = 3; index > 0; --index) {
+            TEST_ASSERT(read_file(file_name(path, index - 1)).size() <= file_size, "File is too large.");
+            content += read_messages(file_name(path, index - 1));
+        }
+
+        const std::string last = prefix(severity_level::info, name()) + "999\n";
+        TEST_ASSERT(content.size() > file_size, "Files are not filled.");
+        TEST_ASSERT(content.substr(content.size() - last.size()) == last, "Last message is lost.");
+        TEST_ASSERT(content.compare(0, 7, "[info] ") == 0, "Messages are split between files.");
+
+        remove_files(path, 4);
+    }
+
+    void time_rotation()
+    {
+        const std::string path = "file_logger_time.log";
+        remove_files(path, 3);
+
+        {
+            file_logger logger(path, 1024 * 1024, 3, std::chrono::seconds(1));
+
+            logger.add_message(severity_level::info, name(), "first\n");
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+            logger.add_message(severity_level::info, name(), "second\n");
+        }
+
+        const std::string info = prefix(severity_level::info, name());
+
+        TEST_ASSERT(read_messages(file_name(path, 1)) == info + "first\n", "File is not rotated.");
+        TEST_ASSERT(read_messages(file_name(path, 0)) == info + "second\n", "Wrong current file.");
+
+        remove_files(path, 3);
+    }
+
+    void record_context()
+    {
+        const std::string path = "file_logger_context.log";
+        remove_files(path, 2);
+
+        const auto before = std::chrono::system_clock::now() - std::chrono::seconds(1);
+
+        ::framework::log::set_logger(std::make_unique<file_logger>(path));
+
+        const int line = __LINE__ + 1;
+        FRAMEWORK_LOG_WARNING(name()) << "message" << std::endl;
+
+        ::framework::log::set_logger(nullptr);
+
+        const auto after = std::chrono::system_clock::now() + std::chrono::seconds(1);
+
+        const std::string content  = read_file(path);
+        const std::string location = " (main.cpp:" + std::to_string(line) + "): ";
+
+        TEST_ASSERT(content.find(location) != std::string::npos, "Source location is not correct.");
+
+        std::tm date{};
+        std::istringstream(content) >> std::get_time(&date, "%Y-%m-%d %H:%M:%S");
+
+        TEST_ASSERT(content[timestamp_formatter::size - 7] == '.', "Timestamp is not correct.");
+
+        // Parsed as UTC to compare with the system clock.
+        const long days    = days_from_civil(date.tm_year + 1900, date.tm_mon + 1, date.tm_mday);
+        const auto seconds = std::chrono::hours(24) * days + std::chrono::hours(date.tm_hour) +
+                             std::chrono::minutes(date.tm_min) + std::chrono::seconds(date.tm_sec);
+        const std::chrono::system_clock::time_point time(seconds);
+
+        TEST_ASSERT(before <= time && time <= after, "Timestamp is not correct.");
+
+        remove_files(path, 2);
+    }
+
+#if !defined(_WIN32)
+    void reopen_failure()
+    {
+        const std::string directory = "file_logger_reopen";
+        const std::string path      = directory + "/reopen.log";
+
+        ::mkdir(directory.c_str(), 0755);
+        remove_files(path, 2);
+
+        {
+            file_logger logger(path, 64, 2);
+
+            // Rotation fails while the directory is missing.
+            remove_files(path, 2);
+            ::rmdir(directory.c_str());
+
+            logger.add_message(severity_level::info, name(), std::string(100, 'a') + "\n");
+            logger.add_message(severity_level::info, name(), "lost\n");
+            logger.flush();
+
+            ::mkdir(directory.c_str(), 0755);
+
+            // Flush retries immediately, messages are retried at most once a second.
+            logger.flush();
+            logger.add_message(severity_level::info, name(), "restored\n");
+        }
+
+        const std::string content = read_messages(path);
+        TEST_ASSERT(content == prefix(severity_level::info, name()) + "restored\n", "Log file is not reopened.");
+
+        remove_files(path, 2);
+        ::rmdir(directory.c_str());
+    }
+#endif
+};
+
+int main()
+{
+    return run_tests(file_logger_test());
+}
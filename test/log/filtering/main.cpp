@@ -0,0 +1,165 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+// Debug and info macros are removed at compile time.
+#define FRAMEWORK_LOG_MIN_LEVEL 2
+
+#include <sstream>
+#include <string>
+
+#include <log/log.hpp>
+#include <log/stream_logger.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::log::debug;
+using ::framework::log::error;
+using ::framework::log::info;
+using ::framework::log::warning;
+
+using ::framework::log::is_enabled;
+using ::framework::log::level;
+using ::framework::log::reset_tag_level;
+using ::framework::log::set_level;
+using ::framework::log::set_logger;
+using ::framework::log::set_tag_level;
+using ::framework::log::severity_level;
+using ::framework::log::stream_logger;
+
+class filtering_test : public framework::unit_test::suite
+{
+public:
+    filtering_test() : suite("filtering_test")
+    {
+        add_test([this]() { default_level(); }, "default_level");
+        add_test([this]() { runtime_level(); }, "runtime_level");
+        add_test([this]() { tag_level(); }, "tag_level");
+        add_test([this]() { compile_time_level(); }, "compile_time_level");
+        add_test([this]() { disabled_arguments(); }, "disabled_arguments");
+    }
+
+private:
+    void default_level()
+    {
+        TEST_ASSERT(level() == severity_level::debug, "Debug messages should be enabled by default.");
+        TEST_ASSERT(is_enabled(severity_level::debug, name()), "Debug messages should be enabled by default.");
+    }
+
+    void runtime_level()
+    {
+        std::stringstream log_stream;
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
+        set_level(severity_level::warning);
+
+        debug(name()) << "message_1" << std::endl;
+        info(name()) << "message_2" << std::endl;
+        warning(name()) << "message_3" << std::endl;
+        error(name()) << "message_4" << std::endl;
+
+        set_level(severity_level::debug);
+
+        std::stringstream log_test;
+        log_test << "[" << severity_level::warning << "] " << name() << ": message_3" << std::endl;
+        log_test << "[" << severity_level::error << "] " << name() << ": message_4" << std::endl;
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Log messages are not correct.");
+    }
+
+    void tag_level()
+    {
+        std::stringstream log_stream;
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
+        set_level(severity_level::error);
+        set_tag_level("verbose", severity_level::debug);
+        set_tag_level("quiet", severity_level::fatal);
+
+        debug("verbose") << "message_1" << std::endl;
+        debug(name()) << "message_2" << std::endl;
+        error("quiet") << "message_3" << std::endl;
+        error(name()) << "message_4" << std::endl;
+
+        reset_tag_level("verbose");
+        debug("verbose") << "message_5" << std::endl;
+
+        reset_tag_level("quiet");
+        error("quiet") << "message_6" << std::endl;
+
+        set_level(severity_level::debug);
+
+        std::stringstream log_test;
+        log_test << "[" << severity_level::debug << "] verbose: message_1" << std::endl;
+        log_test << "[" << severity_level::error << "] " << name() << ": message_4" << std::endl;
+        log_test << "[" << severity_level::error << "] quiet: message_6" << std::endl;
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Log messages are not correct.");
+    }
+
+    void compile_time_level()
+    {
+        std::stringstream log_stream;
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
+        set_level(severity_level::debug);
+
+        FRAMEWORK_LOG_DEBUG(name()) << "message_1" << std::endl;
+        FRAMEWORK_LOG_INFO(name()) << "message_2" << std::endl;
+        FRAMEWORK_LOG_WARNING(name()) << "message_3" << std::endl;
+        FRAMEWORK_LOG_ERROR(name()) << "message_4" << std::endl;
+        FRAMEWORK_LOG_FATAL(name()) << "message_5" << std::endl;
+
+        std::stringstream log_test;
+        log_test << "[" << severity_level::warning << "] " << name() << ": message_3" << std::endl;
+        log_test << "[" << severity_level::error << "] " << name() << ": message_4" << std::endl;
+        log_test << "[" << severity_level::fatal << "] " << name() << ": message_5" << std::endl;
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Log messages are not correct.");
+    }
+
+    void disabled_arguments()
+    {
+        std::stringstream log_stream;
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
+
+        int evaluated = 0;
+        auto argument = [&evaluated]() { return ++evaluated; };
+
+        set_level(severity_level::error);
+
+        FRAMEWORK_LOG_DEBUG(name()) << argument() << std::endl;
+        FRAMEWORK_LOG_WARNING(name()) << argument() << std::endl;
+
+        TEST_ASSERT(evaluated == 0, "Arguments of disabled messages should not be evaluated.");
+
+        FRAMEWORK_LOG_ERROR(name()) << argument() << std::endl;
+
+        set_level(severity_level::debug);
+
+        TEST_ASSERT(evaluated == 1, "Arguments of enabled messages should be evaluated.");
+        TEST_ASSERT(!log_stream.str().empty(), "Log messages are not correct.");
+    }
+};
+
+int main()
+{
+    return run_tests(filtering_test());
+}
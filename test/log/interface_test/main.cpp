@@ -28,6 +28,7 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <common/utils.hpp>
 #include <log/log.hpp>
@@ -40,6 +41,8 @@ using ::framework::log::fatal;
 using ::framework::log::info;
 using ::framework::log::warning;
 
+using ::framework::log::logger_base;
+using ::framework::log::record;
 using ::framework::log::set_logger;
 using ::framework::log::severity_level;
 using ::framework::log::stream_logger;
@@ -52,13 +55,16 @@ public:
         add_test([this]() { stream_logger_test(); }, "stream_logger_test");
         add_test([this]() { long_log_string(); }, "long_log_string");
         add_test([this]() { thread_safety(); }, "thread_safety");
+        add_test([this]() { record_context(); }, "record_context");
+        add_test([this]() { format_messages(); }, "format_messages");
+        add_test([this]() { stream_context(); }, "stream_context");
     }
 
 private:
     void stream_logger_test()
     {
         std::stringstream log_stream;
-        set_logger(std::make_unique<stream_logger>(log_stream));
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
 
         debug(name()) << "message_1" << std::endl;
         info(name()) << "message_2" << std::endl;
@@ -83,7 +89,7 @@ private:
     void long_log_string()
     {
         std::stringstream log_stream;
-        set_logger(std::make_unique<stream_logger>(log_stream));
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
 
         info(name())
         << "long string long string long string long string long string long string long string long string long"
@@ -130,7 +136,7 @@ private:
     void thread_safety()
     {
         std::stringstream log_stream;
-        set_logger(std::make_unique<stream_logger>(log_stream));
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
 
         std::thread t1([this]() {
             for (int i = 0; i < 100; ++i) {
@@ -151,6 +157,109 @@ private:
         // We can't check the output. Just check, that the test would not crash.
         TEST_ASSERT(!log_stream.str().empty(), "Log messages are not correct.");
     }
+
+    void record_context()
+    {
+        /// Keeps copies of records.
+        class record_logger : public logger_base
+        {
+        public:
+            explicit record_logger(std::vector<record>& records) : m_records(records)
+            {}
+
+            using logger_base::add_message;
+
+            void add_message(severity_level /*level*/, const std::string& /*tag*/, const std::string& /*message*/) override
+            {}
+
+            void add_message(const record& item) override
+            {
+                m_records.push_back(item);
+                m_records.back().tag     = {};
+                m_records.back().message = {};
+            }
+
+        private:
+            std::vector<record>& m_records;
+        };
+
+        std::vector<record> records;
+        set_logger(std::make_unique<record_logger>(records));
+
+        info(name()) << "message_1" << std::endl;
+
+        const auto line = static_cast<framework::uint32>(__LINE__ + 1);
+        FRAMEWORK_LOG_INFO(name()) << "message_2" << std::endl;
+
+        framework::uint32 thread = 0;
+        std::thread([this, &thread]() {
+            thread = framework::log::log_details::thread_index();
+            info(name()) << "message_3" << std::endl;
+        }).join();
+
+        set_logger(nullptr);
+
+        TEST_ASSERT(records.size() == 3, "Records are lost.");
+
+        TEST_ASSERT(records[0].file == nullptr && records[0].line == 0, "Location should be unknown.");
+        TEST_ASSERT(records[1].file == std::string(__FILE__) && records[1].line == line, "Location is not correct.");
+
+        TEST_ASSERT(records[0].thread == records[1].thread, "Thread index is not correct.");
+        TEST_ASSERT(records[2].thread == thread && thread != records[0].thread, "Thread index is not correct.");
+
+        TEST_ASSERT(records[0].timestamp != 0, "Timestamp is not set.");
+        TEST_ASSERT(records[0].timestamp <= records[1].timestamp, "Timestamps are not monotonic.");
+        TEST_ASSERT(records[1].timestamp <= records[2].timestamp, "Timestamps are not monotonic.");
+    }
+
+    void format_messages()
+    {
+        std::stringstream log_stream;
+        set_logger(std::make_unique<stream_logger>(log_stream, false));
+
+        info(name()).format("{}: {:.3f}\n", "value", 1.23456);
+        FRAMEWORK_LOG_WARNING(name()).format(FRAMEWORK_FORMAT_STRING("{:>4}|{:#x}|{}\n"), 7, 255u, true);
+        info(name()).format("{} {}", 1) << std::endl;
+        info(name()).format("{:08.2f}", -3.14159) << " and more" << std::endl;
+
+        std::stringstream log_test;
+        log_test << "[" << severity_level::info << "] " << name() << ": value: 1.235" << std::endl;
+        log_test << "[" << severity_level::warning << "] " << name() << ":    7|0xff|true" << std::endl;
+        log_test << "[" << severity_level::info << "] " << name() << ": 1 [format error: Argument index out of range]"
+                 << std::endl;
+        log_test << "[" << severity_level::info << "] " << name() << ": -0003.14 and more" << std::endl;
+
+        set_logger(nullptr);
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Formatted messages are not correct.");
+    }
+
+    void stream_context()
+    {
+        std::stringstream log_stream;
+        set_logger(std::make_unique<stream_logger>(log_stream));
+
+        info(name()) << "message_1" << std::endl;
+
+        const auto line = __LINE__ + 1;
+        FRAMEWORK_LOG_WARNING(name()) << "message_2" << std::endl;
+
+        set_logger(nullptr);
+
+        const std::string thread = " #" + std::to_string(framework::log::log_details::thread_index()) + " ";
+
+        std::string first;
+        std::string second;
+        std::getline(log_stream, first);
+        std::getline(log_stream, second);
+
+        // Timestamp is `YYYY-MM-DD HH:MM:SS.uuuuuu`.
+        TEST_ASSERT(first.size() > 27 && first[4] == '-' && first[10] == ' ' && first[19] == '.', "Wrong timestamp.");
+        TEST_ASSERT(first.substr(26) == " [info]" + thread + name() + ": message_1", "Wrong message context.");
+        TEST_ASSERT(second.substr(26) == " [warning]" + thread + name() + " (main.cpp:" + std::to_string(line) +
+                                         "): message_2",
+                    "Wrong message location.");
+    }
 };
 
 int main()
@@ -0,0 +1,214 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log/log.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::log::logger_base;
+using ::framework::log::log_details::logger_handle;
+using ::framework::log::set_logger;
+using ::framework::log::severity_level;
+
+namespace
+{
+std::atomic<int> alive_count{0};
+std::atomic<int> created_count{0};
+std::atomic<int> messages_count{0};
+
+/// Counts messages and checks that it is not used after destruction.
+class counting_logger : public logger_base
+{
+public:
+    counting_logger()
+    {
+        alive_count.fetch_add(1);
+        created_count.fetch_add(1);
+    }
+
+    ~counting_logger() override
+    {
+        m_alive.store(false);
+        alive_count.fetch_sub(1);
+    }
+
+    counting_logger(const counting_logger&) = delete;
+    counting_logger& operator=(const counting_logger&) = delete;
+
+    using logger_base::add_message;
+
+    void add_message(severity_level /*level*/, const std::string& /*tag*/, const std::string& /*message*/) override
+    {
+        if (m_alive.load()) {
+            messages_count.fetch_add(1);
+        }
+    }
+
+private:
+    std::atomic<bool> m_alive{true};
+};
+
+} // namespace
+
+class logger_swap_test : public framework::unit_test::suite
+{
+public:
+    logger_swap_test() : suite("logger_swap_test")
+    {
+        add_test([this]() { reclamation(); }, "reclamation");
+        add_test([this]() { nested_handles(); }, "nested_handles");
+        add_test([this]() { waits_for_readers(); }, "waits_for_readers");
+        add_test([this]() { concurrent_swap(); }, "concurrent_swap");
+    }
+
+private:
+    void reclamation()
+    {
+        set_logger(std::make_unique<counting_logger>());
+
+        {
+            auto handle = ::framework::log::logger();
+
+            set_logger(std::make_unique<counting_logger>());
+
+            TEST_ASSERT(alive_count.load() == 2, "Used logger is destroyed.");
+
+            handle->add_message(severity_level::info, name(), "message");
+        }
+
+        TEST_ASSERT(alive_count.load() == 1, "Last handle doesn't destroy retired logger.");
+
+        set_logger(nullptr);
+
+        TEST_ASSERT(alive_count.load() == 0, "Loggers are not destroyed.");
+        TEST_ASSERT(messages_count.load() == 1, "Message is lost.");
+    }
+
+    void nested_handles()
+    {
+        set_logger(std::make_unique<counting_logger>());
+
+        // More handles than slots of the thread record.
+        std::array<std::optional<logger_handle>, 12> handles;
+        for (auto& handle : handles) {
+            handle.emplace();
+        }
+
+        set_logger(std::make_unique<counting_logger>());
+
+        // Releases handles out of order, the last one still protects the first logger.
+        for (std::size_t index = 0; index + 1 < handles.size(); index += 2) {
+            handles[index].reset();
+        }
+
+        for (std::size_t index = 1; index + 1 < handles.size(); index += 2) {
+            handles[index].reset();
+        }
+
+        set_logger(std::make_unique<counting_logger>());
+
+        TEST_ASSERT(alive_count.load() == 2, "Logger of the nested handle is destroyed.");
+
+        handles.back().reset();
+        set_logger(nullptr);
+
+        TEST_ASSERT(alive_count.load() == 0, "Loggers are not destroyed.");
+    }
+
+    void waits_for_readers()
+    {
+        set_logger(std::make_unique<counting_logger>());
+
+        std::atomic<bool> acquired{false};
+        std::thread reader([this, &acquired]() {
+            auto handle = ::framework::log::logger();
+            acquired.store(true);
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            handle->add_message(severity_level::info, name(), "message");
+        });
+
+        while (!acquired.load()) {
+            std::this_thread::yield();
+        }
+
+        // Returns after the reader releases the logger, without another call.
+        set_logger(std::make_unique<counting_logger>());
+
+        TEST_ASSERT(alive_count.load() == 1, "Retired logger is not destroyed.");
+
+        reader.join();
+        set_logger(nullptr);
+
+        TEST_ASSERT(alive_count.load() == 0, "Loggers are not destroyed.");
+    }
+
+    void concurrent_swap()
+    {
+        constexpr int threads_count = 4;
+        constexpr int messages      = 20000;
+        constexpr int swaps_count   = 2000;
+
+        messages_count.store(0);
+        created_count.store(0);
+
+        set_logger(std::make_unique<counting_logger>());
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread) {
+            threads.emplace_back([this]() {
+                for (int i = 0; i < messages; ++i) {
+                    ::framework::log::info(name()) << "message " << i << std::endl;
+                }
+            });
+        }
+
+        for (int i = 0; i < swaps_count; ++i) {
+            set_logger(std::make_unique<counting_logger>());
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        set_logger(nullptr);
+
+        TEST_ASSERT(created_count.load() == swaps_count + 1, "Loggers are not created.");
+        TEST_ASSERT(alive_count.load() == 0, "Loggers are leaked.");
+        TEST_ASSERT(messages_count.load() == threads_count * messages, "Messages are lost.");
+    }
+};
+
+int main()
+{
+    return run_tests(logger_swap_test());
+}
@@ -0,0 +1,256 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log/log.hpp>
+#include <log/rate_limited_logger.hpp>
+#include <log/stream_logger.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::log::logger_base;
+using ::framework::log::rate_limited_logger;
+using ::framework::log::record;
+using ::framework::log::set_logger;
+using ::framework::log::severity_level;
+using ::framework::log::stream_logger;
+using ::framework::log::log_details::site_state;
+
+class rate_limited_logger_test : public framework::unit_test::suite
+{
+public:
+    rate_limited_logger_test() : suite("rate_limited_logger_test")
+    {
+        add_test([this]() { rate_limit(); }, "rate_limit");
+        add_test([this]() { call_sites(); }, "call_sites");
+        add_test([this]() { repeats(); }, "repeats");
+        add_test([this]() { interleaved_repeats(); }, "interleaved_repeats");
+        add_test([this]() { loggers_share_site(); }, "loggers_share_site");
+        add_test([this]() { logging_sink(); }, "logging_sink");
+    }
+
+private:
+    void rate_limit()
+    {
+        std::stringstream log_stream;
+        auto sink = std::make_unique<stream_logger>(log_stream, false);
+        set_logger(std::make_unique<rate_limited_logger>(std::move(sink), 5.0, 3, false));
+
+        // Single call site.
+        const auto log_message = [this](int i) { FRAMEWORK_LOG_WARNING(name()) << "message " << i << std::endl; };
+
+        for (int i = 0; i < 10; ++i) {
+            log_message(i);
+        }
+
+        std::stringstream log_test;
+        for (int i = 0; i < 3; ++i) {
+            log_test << "[" << severity_level::warning << "] " << name() << ": message " << i << std::endl;
+        }
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Burst is not limited.");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+        for (int i = 10; i < 13; ++i) {
+            log_message(i);
+        }
+
+        set_logger(nullptr);
+
+        log_test << "[" << severity_level::warning << "] " << name() << ": similar messages suppressed" << std::endl;
+        log_test << "[" << severity_level::warning << "] " << name() << ": message 10" << std::endl;
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Rate is not limited.");
+    }
+
+    void call_sites()
+    {
+        std::stringstream log_stream;
+        auto sink = std::make_unique<stream_logger>(log_stream, false);
+        set_logger(std::make_unique<rate_limited_logger>(std::move(sink), 1.0, 1, false));
+
+        for (int i = 0; i < 5; ++i) {
+            FRAMEWORK_LOG_INFO(name()) << "first" << std::endl;
+            FRAMEWORK_LOG_INFO(name()) << "second" << std::endl;
+            ::framework::log::info(name()) << "third" << std::endl;
+            ::framework::log::warning(name()) << "fourth" << std::endl;
+        }
+
+        set_logger(nullptr);
+
+        std::stringstream log_test;
+        log_test << "[" << severity_level::info << "] " << name() << ": first" << std::endl;
+        log_test << "[" << severity_level::info << "] " << name() << ": second" << std::endl;
+        log_test << "[" << severity_level::info << "] " << name() << ": third" << std::endl;
+        log_test << "[" << severity_level::warning << "] " << name() << ": fourth" << std::endl;
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Call sites are not separated.");
+    }
+
+    void repeats()
+    {
+        std::stringstream log_stream;
+        std::stringstream log_test;
+
+        {
+            rate_limited_logger logger(std::make_unique<stream_logger>(log_stream, false), 0.0);
+
+            for (int i = 0; i < 5; ++i) {
+                logger.add_message(severity_level::info, name(), "same\n");
+            }
+
+            logger.add_message(severity_level::info, name(), "other\n");
+            logger.add_message(severity_level::error, name(), "other\n");
+            logger.add_message(severity_level::error, name(), "other\n");
+
+            log_test << "[" << severity_level::info << "] " << name() << ": same\n";
+            log_test << "[" << severity_level::info << "] " << name() << ": last message repeated 4 times\n";
+            log_test << "[" << severity_level::info << "] " << name() << ": other\n";
+            log_test << "[" << severity_level::error << "] " << name() << ": other\n";
+
+            TEST_ASSERT(log_test.str() == log_stream.str(), "Repeats are not collapsed.");
+
+            logger.flush();
+
+            log_test << "[" << severity_level::error << "] " << name() << ": last message repeated 1 times\n";
+
+            TEST_ASSERT(log_test.str() == log_stream.str(), "Flush doesn't write repeats count.");
+        }
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Repeats count is written twice.");
+    }
+
+    void interleaved_repeats()
+    {
+        std::stringstream log_stream;
+        std::stringstream log_test;
+
+        rate_limited_logger logger(std::make_unique<stream_logger>(log_stream, false), 0.0);
+
+        for (int i = 0; i < 3; ++i) {
+            logger.add_message(severity_level::info, name(), "same\n");
+            logger.add_message(severity_level::warning, name(), "same\n");
+        }
+
+        log_test << "[" << severity_level::info << "] " << name() << ": same\n";
+        log_test << "[" << severity_level::warning << "] " << name() << ": same\n";
+
+        TEST_ASSERT(log_test.str() == log_stream.str(), "Repeats of other call site break collapsing.");
+
+        logger.flush();
+
+        const std::string output = log_stream.str();
+
+        std::stringstream info_note;
+        std::stringstream warning_note;
+        info_note << "[" << severity_level::info << "] " << name() << ": last message repeated 2 times\n";
+        warning_note << "[" << severity_level::warning << "] " << name() << ": last message repeated 2 times\n";
+
+        TEST_ASSERT(output.find(info_note.str()) != std::string::npos, "Flush doesn't write repeats count of site.");
+        TEST_ASSERT(output.find(warning_note.str()) != std::string::npos, "Flush doesn't write repeats count of site.");
+    }
+
+    void loggers_share_site()
+    {
+        std::stringstream first_stream;
+        std::stringstream second_stream;
+
+        rate_limited_logger first(std::make_unique<stream_logger>(first_stream, false), 1.0, 1, false);
+        rate_limited_logger second(std::make_unique<stream_logger>(second_stream, false), 1.0, 2, false);
+
+        const std::string tag = name();
+
+        // The first logger caches the suppression in the statement, the second one must ignore it.
+        for (int i = 0; i < 6; ++i) {
+            rate_limited_logger& logger = (i < 3) ? first : second;
+            ::framework::log::log_details::source_location location{__FILE__, __LINE__, site_state([] {})};
+
+            record item = ::framework::log::log_details::make_record(severity_level::info, tag, "message\n");
+            item.file   = location.file;
+            item.line   = location.line;
+            item.site   = location.site;
+            logger.add_message(item);
+        }
+
+        std::stringstream first_test;
+        std::stringstream second_test;
+        first_test << "[" << severity_level::info << "] " << name() << ": message\n";
+        second_test << "[" << severity_level::info << "] " << name() << ": message\n";
+        second_test << "[" << severity_level::info << "] " << name() << ": message\n";
+
+        TEST_ASSERT(first_stream.str() == first_test.str(), "Messages are not limited.");
+        TEST_ASSERT(second_stream.str() == second_test.str(), "Suppression of other logger is applied.");
+    }
+
+    void logging_sink()
+    {
+        /// Flushes the rate limited logger from the sink.
+        class flushing_logger : public logger_base
+        {
+        public:
+            using logger_base::add_message;
+
+            void add_message(severity_level /*level*/, const std::string& /*tag*/, const std::string& message) override
+            {
+                messages.push_back(message);
+
+                if (owner != nullptr) {
+                    owner->flush();
+                }
+            }
+
+            logger_base* owner = nullptr;
+            std::vector<std::string> messages;
+        };
+
+        auto sink                = std::make_unique<flushing_logger>();
+        flushing_logger& printer = *sink;
+
+        rate_limited_logger logger(std::move(sink), 0.0);
+        printer.owner = &logger;
+
+        // The sink is called without the site lock, so the flush from it doesn't deadlock.
+        for (int i = 0; i < 3; ++i) {
+            logger.add_message(severity_level::info, name(), "same\n");
+        }
+
+        logger.add_message(severity_level::info, name(), "other\n");
+
+        printer.owner = nullptr;
+
+        const std::vector<std::string> expected = {"same\n", "last message repeated 2 times\n", "other\n"};
+        TEST_ASSERT(printer.messages == expected, "Messages are not correct.");
+    }
+};
+
+int main()
+{
+    return run_tests(rate_limited_logger_test());
+}
@@ -0,0 +1,301 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <csignal>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <log/log.hpp>
+#include <log/ring_logger.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::log::ring_logger;
+using ::framework::log::severity_level;
+
+namespace
+{
+/// Reads the file from the start and closes it.
+std::string read_file(std::FILE* file)
+{
+    std::string result;
+    std::rewind(file);
+
+    char buffer[4096];
+    std::size_t size = 0;
+    while ((size = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        result.append(buffer, size);
+    }
+
+    std::fclose(file);
+
+    return result;
+}
+
+#if !defined(_WIN32)
+/// Pipe of the signal handler installed before the crash handler.
+int chained_file = -1;
+#endif
+
+/// Dumps the logger into a temporary file and reads it back.
+std::string dump_text(const ring_logger& logger)
+{
+    std::FILE* file = std::tmpfile();
+
+    logger.dump(fileno(file));
+
+    return read_file(file);
+}
+
+void add_message(ring_logger& logger, severity_level level, std::string_view tag, std::string_view message)
+{
+    logger.add_message(level, tag, message);
+}
+
+constexpr std::string_view header = "--- last log messages ---\n";
+
+} // namespace
+
+class ring_logger_test : public framework::unit_test::suite
+{
+public:
+    ring_logger_test() : suite("ring_logger_test")
+    {
+        add_test([this]() { messages(); }, "messages");
+        add_test([this]() { overwrite(); }, "overwrite");
+        add_test([this]() { long_message(); }, "long_message");
+#if !defined(_WIN32)
+        add_test([this]() { crash_dump(); }, "crash_dump");
+        add_test([this]() { fatal_and_crash_log(); }, "fatal_and_crash_log");
+        add_test([this]() { fatal_dump(); }, "fatal_dump");
+        add_test([this]() { chained_handler(); }, "chained_handler");
+#endif
+    }
+
+private:
+    void messages()
+    {
+        ring_logger logger(4096);
+
+        add_message(logger, severity_level::info, "tag", "first\n");
+        add_message(logger, severity_level::error, "tag", "second");
+
+        const std::string thread   = std::to_string(framework::log::log_details::thread_index());
+        const std::string expected = std::string(header) + "[info] #" + thread + " tag: first\n[error] #" + thread +
+                                     " tag: second\n";
+
+        TEST_ASSERT(dump_text(logger) == expected, "Dump is not correct.");
+    }
+
+    void overwrite()
+    {
+        ring_logger logger(4096);
+
+        for (int i = 0; i < 1000; ++i) {
+            add_message(logger, severity_level::info, "tag", "message " + std::to_string(i) + "\n");
+        }
+
+        const std::string text = dump_text(logger);
+
+        TEST_ASSERT(text.compare(0, header.size(), header) == 0, "Dump header is missing.");
+        TEST_ASSERT(text.compare(header.size(), 7, "[info] ") == 0, "Dump doesn't start at a line.");
+        TEST_ASSERT(text.find(": message 999\n") == text.size() - 14, "Last message is lost.");
+        TEST_ASSERT(text.find(": message 1\n") == std::string::npos, "Old messages are not overwritten.");
+        TEST_ASSERT(text.size() <= header.size() + 4096, "Dump is too large.");
+    }
+
+    void long_message()
+    {
+        ring_logger logger(4096);
+
+        add_message(logger, severity_level::info, "tag", std::string(10000, 'a'));
+        add_message(logger, severity_level::info, "tag", "short\n");
+
+        const std::string text = dump_text(logger);
+
+        TEST_ASSERT(text.size() > header.size() && text.back() == '\n', "Long message is not truncated.");
+        TEST_ASSERT(text.find("tag: short\n") != std::string::npos, "Message after long one is lost.");
+    }
+
+#if !defined(_WIN32)
+    void crash_dump()
+    {
+        int pipe_files[2];
+        TEST_ASSERT(::pipe(pipe_files) == 0, "Can't create pipe.");
+
+        const pid_t child = ::fork();
+        if (child == 0) {
+            ::close(pipe_files[0]);
+
+            auto logger = std::make_unique<ring_logger>(4096);
+            logger->install_crash_handler(pipe_files[1]);
+
+            ::framework::log::set_logger(std::move(logger));
+            ::framework::log::error("crash") << "before crash" << std::endl;
+
+            std::raise(SIGSEGV);
+            ::_exit(0);
+        }
+
+        ::close(pipe_files[1]);
+
+        std::string text;
+        char buffer[4096];
+        ssize_t size = 0;
+        while ((size = ::read(pipe_files[0], buffer, sizeof(buffer))) > 0) {
+            text.append(buffer, static_cast<std::size_t>(size));
+        }
+
+        ::close(pipe_files[0]);
+
+        int status = 0;
+        ::waitpid(child, &status, 0);
+
+        TEST_ASSERT(WIFSIGNALED(status) && WTERMSIG(status) == SIGSEGV, "Signal is not raised again.");
+        TEST_ASSERT(text.find(header) == 0, "Crash log is not dumped.");
+        TEST_ASSERT(text.find("crash: before crash\n") != std::string::npos, "Crash log is not correct.");
+    }
+
+    void fatal_dump()
+    {
+        std::FILE* file = std::tmpfile();
+
+        {
+            ring_logger logger(4096);
+            logger.install_crash_handler(fileno(file));
+
+            add_message(logger, severity_level::error, "tag", "error\n");
+            add_message(logger, severity_level::fatal, "tag", "fatal\n");
+            add_message(logger, severity_level::fatal, "tag", "fatal again\n");
+        }
+
+        const std::string text = read_file(file);
+
+        TEST_ASSERT(text.find("tag: error\n") != std::string::npos, "Fatal message doesn't dump log.");
+        TEST_ASSERT(text.find("tag: fatal\n") != std::string::npos, "Fatal message is not in the dump.");
+        TEST_ASSERT(text.find("fatal again") == std::string::npos, "Log is dumped twice.");
+    }
+
+    void fatal_and_crash_log()
+    {
+        int pipe_files[2];
+        TEST_ASSERT(::pipe(pipe_files) == 0, "Can't create pipe.");
+
+        // The dump flags are per process, so the fatal message is logged in a child process.
+        const pid_t child = ::fork();
+        if (child == 0) {
+            ::close(pipe_files[0]);
+
+            auto logger = std::make_unique<ring_logger>(4096);
+            logger->install_crash_handler(pipe_files[1]);
+
+            ::framework::log::set_logger(std::move(logger));
+            ::framework::log::fatal("tag") << "fatal" << std::endl;
+            ::framework::log::logger()->flush();
+            ::framework::log::dump_crash_log();
+
+            ::_exit(0);
+        }
+
+        ::close(pipe_files[1]);
+
+        std::string text;
+        char buffer[4096];
+        ssize_t size = 0;
+        while ((size = ::read(pipe_files[0], buffer, sizeof(buffer))) > 0) {
+            text.append(buffer, static_cast<std::size_t>(size));
+        }
+
+        ::close(pipe_files[0]);
+
+        int status = 0;
+        ::waitpid(child, &status, 0);
+
+        TEST_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0, "Child process failed.");
+        TEST_ASSERT(text.find(header) == 0, "Fatal message doesn't dump log.");
+        TEST_ASSERT(text.find(header, header.size()) == std::string::npos, "Log is dumped twice.");
+    }
+
+    void chained_handler()
+    {
+        int pipe_files[2];
+        TEST_ASSERT(::pipe(pipe_files) == 0, "Can't create pipe.");
+
+        const pid_t child = ::fork();
+        if (child == 0) {
+            ::close(pipe_files[0]);
+            chained_file = pipe_files[1];
+
+            struct sigaction action
+            {};
+            action.sa_handler = [](int) {
+                constexpr std::string_view text = "previous handler\n";
+                [[maybe_unused]] const auto written = ::write(chained_file, text.data(), text.size());
+                ::_exit(3);
+            };
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGSEGV, &action, nullptr);
+
+            ring_logger logger(4096);
+            logger.install_crash_handler(pipe_files[1]);
+
+            add_message(logger, severity_level::fatal, "tag", "fatal\n");
+            add_message(logger, severity_level::error, "tag", "after fatal\n");
+
+            std::raise(SIGSEGV);
+            ::_exit(0);
+        }
+
+        ::close(pipe_files[1]);
+
+        std::string text;
+        char buffer[4096];
+        ssize_t size = 0;
+        while ((size = ::read(pipe_files[0], buffer, sizeof(buffer))) > 0) {
+            text.append(buffer, static_cast<std::size_t>(size));
+        }
+
+        ::close(pipe_files[0]);
+
+        int status = 0;
+        ::waitpid(child, &status, 0);
+
+        TEST_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 3, "Previous handler is not called.");
+        TEST_ASSERT(text.find("tag: after fatal\n") != std::string::npos, "Fatal message suppresses crash dump.");
+        TEST_ASSERT(text.find("previous handler\n") > text.find("tag: after fatal\n"),
+                    "Previous handler is called before the dump.");
+    }
+#endif
+};
+
+int main()
+{
+    return run_tests(ring_logger_test());
+}
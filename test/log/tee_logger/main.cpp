@@ -0,0 +1,116 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <log/stream_logger.hpp>
+#include <log/tee_logger.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::log::severity_level;
+using ::framework::log::stream_logger;
+using ::framework::log::tee_logger;
+
+namespace
+{
+void add_message(tee_logger& logger, severity_level level, std::string_view tag, std::string_view message)
+{
+    logger.add_message(level, tag, message);
+}
+
+} // namespace
+
+class tee_logger_test : public framework::unit_test::suite
+{
+public:
+    tee_logger_test() : suite("tee_logger_test")
+    {
+        add_test([this]() { routing(); }, "routing");
+        add_test([this]() { sinks_limit(); }, "sinks_limit");
+    }
+
+private:
+    void routing()
+    {
+        std::stringstream errors;
+        std::stringstream everything;
+        std::stringstream renderer;
+
+        tee_logger logger;
+        add_message(logger, severity_level::fatal, "core", "no sinks\n");
+
+        logger.add_sink(std::make_unique<stream_logger>(errors, false), severity_level::error);
+        logger.add_sink(std::make_unique<stream_logger>(everything, false));
+        logger.add_sink(std::make_unique<stream_logger>(renderer, false), severity_level::info, {"renderer", "shader"});
+
+        add_message(logger, severity_level::debug, "core", "1\n");
+        add_message(logger, severity_level::debug, "renderer", "2\n");
+        add_message(logger, severity_level::info, "renderer", "3\n");
+        add_message(logger, severity_level::warning, "shader", "4\n");
+        add_message(logger, severity_level::error, "core", "5\n");
+        add_message(logger, severity_level::fatal, "shader", "6\n");
+        add_message(logger, severity_level::info, "render", "7\n");
+
+        TEST_ASSERT(errors.str() == "[error] core: 5\n[fatal] shader: 6\n", "Level filter is not correct.");
+        TEST_ASSERT(renderer.str() == "[info] renderer: 3\n[warning] shader: 4\n[fatal] shader: 6\n",
+                    "Tag filter is not correct.");
+        TEST_ASSERT(everything.str() ==
+                    "[debug] core: 1\n[debug] renderer: 2\n[info] renderer: 3\n[warning] shader: 4\n"
+                    "[error] core: 5\n[fatal] shader: 6\n[info] render: 7\n",
+                    "Messages are lost.");
+    }
+
+    void sinks_limit()
+    {
+        std::stringstream output;
+
+        tee_logger logger;
+        for (std::size_t i = 0; i < tee_logger::max_sinks; ++i) {
+            logger.add_sink(std::make_unique<stream_logger>(output, false), severity_level::debug, {std::to_string(i)});
+        }
+
+        bool thrown = false;
+        try {
+            logger.add_sink(std::make_unique<stream_logger>(output, false));
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+
+        TEST_ASSERT(thrown, "Sinks count is not limited.");
+
+        add_message(logger, severity_level::info, "63", "last\n");
+        add_message(logger, severity_level::info, "64", "none\n");
+
+        TEST_ASSERT(output.str() == "[info] 63: last\n", "Last sink doesn't receive messages.");
+    }
+};
+
+int main()
+{
+    return run_tests(tee_logger_test());
+}
@@ -23,9 +23,17 @@
 // SOFTWARE.
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
 #include <math/math.hpp>
 #include <unit_test/suite.hpp>
 
+using ::framework::int32;
+using ::framework::float32;
+
 using ::framework::math::matrix2x2f;
 using ::framework::math::matrix2x3f;
 using ::framework::math::matrix2x4f;
@@ -44,6 +52,34 @@ using ::framework::math::vector4f;
 
 using ::framework::math::almost_equal;
 
+namespace
+{
+// Maximal difference of SIMD and generic implementations in ULP of the largest column element.
+// The results are equal unless the compiler contracts multiplications and additions into FMA.
+constexpr int32 max_product_ulp = 4;
+constexpr int32 max_inverse_ulp = 16;
+
+int32 ulp_distance(const matrix4f& test, const matrix4f& reference)
+{
+    int32 result = 0;
+
+    for (int32 c = 0; c < 4; ++c) {
+        float32 magnitude = 0.0f;
+        for (int32 r = 0; r < 4; ++r) {
+            magnitude = std::max(magnitude, std::abs(reference[c][r]));
+        }
+
+        const float32 ulp = std::nextafter(magnitude, std::numeric_limits<float32>::infinity()) - magnitude;
+        for (int32 r = 0; r < 4; ++r) {
+            result = std::max(result, static_cast<int32>(std::abs(test[c][r] - reference[c][r]) / ulp));
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
 class matrix_function_tests : public framework::unit_test::suite
 {
 public:
@@ -56,6 +92,7 @@ public:
         add_test([this]() { inverse_function(); }, "inverse_function");
         add_test([this]() { affine_inverse_function(); }, "affine_inverse_function");
         add_test([this]() { inverse_transpose_function(); }, "inverse_transpose_function");
+        add_test([this]() { simd_precision(); }, "simd_precision");
     }
 
 private:
@@ -238,6 +275,52 @@ private:
         TEST_ASSERT(transpose(inverse(test4)) == inverse_transpose(test4),
                     "Inverse_transpose function for matrix4x4f failed.");
     }
+
+    void simd_precision()
+    {
+        namespace details = ::framework::math::matrix_functions_details;
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float32> distribution(-10.0f, 10.0f);
+
+        int32 product_ulp = 0, inverse_ulp = 0, affine_inverse_ulp = 0, inverse_transpose_ulp = 0;
+
+        for (int32 i = 0; i < 1000; ++i) {
+            matrix4f lhs, rhs;
+            for (int32 c = 0; c < 4; ++c) {
+                for (int32 r = 0; r < 4; ++r) {
+                    lhs[c][r] = distribution(generator);
+                    rhs[c][r] = distribution(generator);
+                }
+                // Keep the matrices well-conditioned.
+                lhs[c][c] += 40.0f;
+            }
+
+            matrix4f affine = lhs;
+            affine[0][3] = affine[1][3] = affine[2][3] = 0.0f;
+            affine[3][3]                                = 1.0f;
+
+            // Explicit template arguments select the generic implementations.
+            const matrix4f product = ::framework::math::operator*<4, 4, 4, float32, float32>(lhs, rhs);
+
+            product_ulp = std::max(product_ulp, ulp_distance(lhs * rhs, product));
+            inverse_ulp = std::max(inverse_ulp, ulp_distance(inverse(lhs), details::inverse<float32>(lhs)));
+
+            const int32 affine_ulp = ulp_distance(affine_inverse(affine), details::affine_inverse<float32>(affine));
+            affine_inverse_ulp     = std::max(affine_inverse_ulp, affine_ulp);
+
+            const int32 transpose_ulp = ulp_distance(inverse_transpose(lhs), details::inverse_transpose<float32>(lhs));
+            inverse_transpose_ulp     = std::max(inverse_transpose_ulp, transpose_ulp);
+
+            const matrix4f transposed = details::transpose<4, float32>(lhs);
+            TEST_ASSERT(transpose(lhs) == transposed, "SIMD transpose differs from generic one.");
+        }
+
+        TEST_ASSERT(product_ulp <= max_product_ulp, "SIMD matrix product is out of the ULP bound.");
+        TEST_ASSERT(inverse_ulp <= max_inverse_ulp, "SIMD inverse is out of the ULP bound.");
+        TEST_ASSERT(affine_inverse_ulp <= max_inverse_ulp, "SIMD affine_inverse is out of the ULP bound.");
+        TEST_ASSERT(inverse_transpose_ulp <= max_inverse_ulp, "SIMD inverse_transpose is out of the ULP bound.");
+    }
 };
 
 int main()
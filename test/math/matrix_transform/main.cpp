@@ -24,6 +24,7 @@
 // =============================================================================
 
 #include <cassert>
+#include <vector>
 
 #include <math/math.hpp>
 #include <unit_test/suite.hpp>
@@ -46,6 +47,7 @@ using ::framework::math::vector3f;
 using ::framework::math::vector4f;
 
 using ::framework::float32;
+using ::framework::usize;
 
 using ::framework::math::frustum;
 using ::framework::math::infinite_perspective;
@@ -54,6 +56,9 @@ using ::framework::math::ortho2d;
 using ::framework::math::perspective;
 using ::framework::math::perspective_fov;
 using ::framework::math::radians;
+using ::framework::math::transform_normals;
+using ::framework::math::transform_points;
+using ::framework::math::transform_vectors;
 
 using ::framework::math::half_pi;
 
@@ -269,6 +274,10 @@ public:
         add_test([this]() { translate_function(); }, "translate_function");
         add_test([this]() { scale_function(); }, "scale_function");
         add_test([this]() { rotate_function(); }, "rotate_function");
+        add_test([this]() { transform_points_function(); }, "transform_points_function");
+        add_test([this]() { transform_vectors_function(); }, "transform_vectors_function");
+        add_test([this]() { transform_normals_function(); }, "transform_normals_function");
+        add_test([this]() { parallel_transform(); }, "parallel_transform");
     }
 
 private:
@@ -396,6 +405,74 @@ private:
         TEST_ASSERT(almost_equal(resulty, my, 1), "Rotate matrix from (0, 1, 0) by 90 degrees failed.");
         TEST_ASSERT(almost_equal(resultz, mz, 1), "Rotate matrix from (0, 0, 1) by 90 degrees failed.");
     }
+
+    void transform_points_function()
+    {
+        const matrix4f m = translate(scale(matrix4f(), vector3f(2, 3, 4)), vector3f(1, 2, 3));
+
+        const std::vector<vector3f> points = {vector3f(0, 0, 0), vector3f(1, -1, 2), vector3f(-3, 0.5f, 1)};
+        std::vector<vector3f> result(points.size());
+
+        transform_points(m, points.data(), points.size(), result.data());
+
+        for (usize i = 0; i < points.size(); ++i) {
+            TEST_ASSERT(result[i] == vector3f(m * vector4f(points[i], 1)), "Point is transformed incorrectly.");
+        }
+        TEST_ASSERT(result[0] == vector3f(2, 6, 12), "Point is transformed incorrectly.");
+
+        std::vector<vector3f> in_place = points;
+        transform_points(m, in_place.data(), in_place.size());
+        TEST_ASSERT(in_place == result, "In-place point transform failed.");
+    }
+
+    void transform_vectors_function()
+    {
+        const matrix4f m = translate(scale(matrix4f(), vector3f(2, 3, 4)), vector3f(1, 2, 3));
+
+        std::vector<vector3f> vectors = {vector3f(1, 0, 0), vector3f(0, 1, 0), vector3f(1, 1, 1)};
+        transform_vectors(m, vectors.data(), vectors.size());
+
+        TEST_ASSERT(vectors[0] == vector3f(2, 0, 0), "Vector is transformed incorrectly.");
+        TEST_ASSERT(vectors[1] == vector3f(0, 3, 0), "Vector is transformed incorrectly.");
+        TEST_ASSERT(vectors[2] == vector3f(2, 3, 4), "Vector is transformed incorrectly.");
+    }
+
+    void transform_normals_function()
+    {
+        const matrix4f m = translate(scale(matrix4f(), vector3f(2, 1, 1)), vector3f(5, 5, 5));
+
+        // Normal of the plane x + y = const stays orthogonal to the transformed plane.
+        const std::vector<vector3f> normals = {vector3f(1, 1, 0)};
+        const std::vector<vector3f> tangents = {vector3f(1, -1, 0)};
+        std::vector<vector3f> normal(1), tangent(1);
+
+        transform_normals(m, normals.data(), 1, normal.data());
+        transform_vectors(m, tangents.data(), 1, tangent.data());
+
+        TEST_ASSERT(normal[0] == vector3f(0.5f, 1, 0), "Normal is transformed incorrectly.");
+        TEST_ASSERT(dot(normal[0], tangent[0]) == 0.0f, "Normal is not orthogonal to the surface.");
+    }
+
+    void parallel_transform()
+    {
+        const matrix4f m = rotate(translate(matrix4f(), vector3f(1, 2, 3)), vector3f(0, 0, 1), radians(30.0f));
+
+        std::vector<vector3f> points(300000);
+        for (usize i = 0; i < points.size(); ++i) {
+            points[i] = vector3f(static_cast<float32>(i % 1000), static_cast<float32>(i % 7), 1.0f);
+        }
+
+        std::vector<vector3f> serial(points.size()), parallel(points.size());
+        transform_points(m, points.data(), points.size(), serial.data());
+        transform_points(m, points.data(), points.size(), parallel.data(), 4);
+
+        TEST_ASSERT(serial == parallel, "Parallel transform differs from serial one.");
+
+        transform_normals(m, points.data(), points.size(), serial.data());
+        transform_normals(m, points.data(), points.size(), parallel.data(), 0);
+
+        TEST_ASSERT(serial == parallel, "Parallel normals transform differs from serial one.");
+    }
 };
 
 class projection_function_tests : public framework::unit_test::suite
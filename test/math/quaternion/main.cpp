@@ -0,0 +1,219 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include <math/math.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::float32;
+using ::framework::usize;
+
+using ::framework::math::matrix3f;
+using ::framework::math::matrix4f;
+using ::framework::math::quaterniond;
+using ::framework::math::quaternionf;
+using ::framework::math::vector3d;
+using ::framework::math::vector3f;
+using ::framework::math::vector4f;
+
+using ::framework::math::almost_equal;
+using ::framework::math::angle_axis;
+using ::framework::math::conjugate;
+using ::framework::math::dot;
+using ::framework::math::inverse;
+using ::framework::math::length;
+using ::framework::math::matrix3_cast;
+using ::framework::math::matrix4_cast;
+using ::framework::math::nlerp;
+using ::framework::math::normalize;
+using ::framework::math::quaternion_cast;
+using ::framework::math::rotate;
+using ::framework::math::slerp;
+
+
+class quaternion_tests : public framework::unit_test::suite
+{
+public:
+    quaternion_tests() : suite("quaternion_tests")
+    {
+        add_test([this]() { constructors(); }, "constructors");
+        add_test([this]() { operators(); }, "operators");
+        add_test([this]() { rotation(); }, "rotation");
+        add_test([this]() { conversions(); }, "conversions");
+        add_test([this]() { interpolation(); }, "interpolation");
+        add_test([this]() { batch_interpolation(); }, "batch_interpolation");
+    }
+
+private:
+    // Elements close to zero differ in too many ULPs after a different order of operations.
+    static bool near(const matrix4f& a, const matrix4f& b)
+    {
+        for (framework::uint32 c = 0; c < 4; ++c) {
+            for (framework::uint32 r = 0; r < 4; ++r) {
+                if (std::abs(a[c][r] - b[c][r]) > 1e-6f) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void constructors()
+    {
+        const quaternionf identity;
+        TEST_ASSERT(identity == quaternionf(0, 0, 0, 1), "Default constructor failed.");
+
+        const quaternionf q(vector3f(1, 2, 3), 4);
+        TEST_ASSERT(q[0] == 1 && q[1] == 2 && q[2] == 3 && q[3] == 4, "Constructor from vector and scalar failed.");
+        TEST_ASSERT(quaternionf(vector4f(1, 2, 3, 4)) == q, "Constructor from vector4 failed.");
+        TEST_ASSERT(q.data()[3] == 4 && q.size() == 4, "Data access failed.");
+    }
+
+    void operators()
+    {
+        const quaternionf a(1, 2, 3, 4);
+        const quaternionf b(-5, 6, 0.5f, 2);
+
+        TEST_ASSERT(a + b == quaternionf(-4, 8, 3.5f, 6), "Sum failed.");
+        TEST_ASSERT(a - b == quaternionf(6, -4, 2.5f, 2), "Difference failed.");
+        TEST_ASSERT(-a == quaternionf(-1, -2, -3, -4), "Negation failed.");
+        TEST_ASSERT(a * 2.0f == 2.0f * a && a * 2.0f == quaternionf(2, 4, 6, 8), "Scalar product failed.");
+        TEST_ASSERT(a / 2.0f == quaternionf(0.5f, 1, 1.5f, 2), "Scalar division failed.");
+
+        // Hamilton product computed by hand.
+        TEST_ASSERT(a * b == quaternionf(-35, 12.5f, 24, -0.5f), "Quaternion product failed.");
+
+        quaternionf c = a;
+        c *= b;
+        TEST_ASSERT(c == a * b, "Compound product failed.");
+
+        const quaternionf generic = ::framework::math::operator*<float32>(a, b);
+        TEST_ASSERT(generic == a * b, "SIMD product differs from the generic one.");
+
+        TEST_ASSERT(conjugate(a) == quaternionf(-1, -2, -3, 4), "Conjugate failed.");
+        TEST_ASSERT(quaternionf(1, -1, 1, 1) * inverse(quaternionf(1, -1, 1, 1)) == quaternionf(), "Inverse failed.");
+        TEST_ASSERT(dot(a, b) == 16.5f, "Dot failed.");
+        TEST_ASSERT(length(quaternionf(1, 1, 1, 1)) == 2.0f, "Length failed.");
+        TEST_ASSERT(normalize(quaternionf(0, 0, 3, 4)) == quaternionf(0, 0, 0.6f, 0.8f), "Normalize failed.");
+    }
+
+    void rotation()
+    {
+        const vector3f axis = normalize(vector3f(1, -2, 3));
+        const float32 angle = 0.75f;
+
+        const quaternionf q = angle_axis(angle, axis);
+        const matrix4f m    = rotate(matrix4f(), axis, angle);
+
+        TEST_ASSERT(almost_equal(length(q), 1.0f, 1), "Rotation quaternion is not normalized.");
+
+        const vector3f v(4, 5, -6);
+        const vector4f expected = m * vector4f(v, 0);
+        TEST_ASSERT(almost_equal(rotate(q, v), vector3f(expected), 8), "Vector rotation failed.");
+        TEST_ASSERT(almost_equal(q * v, vector3f(expected), 8), "Vector rotation operator failed.");
+
+        // Composition of the rotations matches the product of the matrices.
+        const quaternionf r = angle_axis(-1.25f, normalize(vector3f(0, 1, 1)));
+        const matrix4f composed = matrix4_cast(q) * matrix4_cast(r);
+        TEST_ASSERT(near(matrix4_cast(q * r), composed), "Rotation composition failed.");
+
+        const quaterniond half_turn = angle_axis(::framework::math::pi, vector3d(0, 0, 1));
+        TEST_ASSERT(almost_equal(rotate(half_turn, vector3d(1, 0, 0)).x, -1.0), "Half turn failed.");
+    }
+
+    void conversions()
+    {
+        const matrix4f m = rotate(matrix4f(), normalize(vector3f(1, -2, 3)), 0.75f);
+        TEST_ASSERT(almost_equal(matrix4_cast(quaternion_cast(m)), m, 8), "Matrix round trip failed.");
+
+        // Covers each branch of the conversion.
+        const std::vector<quaternionf> rotations = {angle_axis(0.5f, vector3f(1, 0, 0)),
+                                                    angle_axis(3.0f, vector3f(1, 0, 0)),
+                                                    angle_axis(3.0f, vector3f(0, 1, 0)),
+                                                    angle_axis(3.0f, vector3f(0, 0, 1))};
+
+        for (const auto& q : rotations) {
+            const quaternionf restored = quaternion_cast(matrix3_cast(q));
+            TEST_ASSERT(almost_equal(restored, q, 8) || almost_equal(restored, -q, 8), "Quaternion round trip failed.");
+        }
+    }
+
+    void interpolation()
+    {
+        const quaternionf from = angle_axis(0.25f, vector3f(0, 0, 1));
+        const quaternionf to   = angle_axis(1.75f, vector3f(0, 0, 1));
+
+        TEST_ASSERT(almost_equal(slerp(from, to, 0.0f), from, 2), "Slerp start failed.");
+        TEST_ASSERT(almost_equal(slerp(from, to, 1.0f), to, 2), "Slerp end failed.");
+        const quaternionf middle = angle_axis(1.0f, vector3f(0, 0, 1));
+        TEST_ASSERT(almost_equal(slerp(from, to, 0.5f), middle, 4), "Slerp middle failed.");
+        TEST_ASSERT(almost_equal(nlerp(from, to, 0.5f), middle, 4), "Nlerp middle failed.");
+
+        // Negated quaternion is the same rotation, the shortest path should be taken.
+        TEST_ASSERT(almost_equal(slerp(from, -to, 0.5f), slerp(from, to, 0.5f), 4), "Slerp is not the shortest.");
+        TEST_ASSERT(almost_equal(nlerp(from, -to, 0.5f), nlerp(from, to, 0.5f), 4), "Nlerp is not the shortest.");
+
+        // Close rotations fall back to nlerp.
+        const quaternionf close = angle_axis(0.2501f, vector3f(0, 0, 1));
+        TEST_ASSERT(almost_equal(length(slerp(from, close, 0.3f)), 1.0f, 2), "Slerp of close rotations failed.");
+
+        const quaterniond from_d = angle_axis(0.25, vector3d(0, 0, 1));
+        const quaterniond to_d   = angle_axis(1.75, vector3d(0, 0, 1));
+        TEST_ASSERT(almost_equal(slerp(from_d, to_d, 0.5), angle_axis(1.0, vector3d(0, 0, 1)), 4),
+                    "Slerp of float64 failed.");
+    }
+
+    void batch_interpolation()
+    {
+        std::vector<quaternionf> from;
+        std::vector<quaternionf> to;
+
+        for (usize i = 0; i < 19; ++i) {
+            const auto value = static_cast<float32>(i);
+            from.push_back(angle_axis(0.1f * value, normalize(vector3f(1, value, 2))));
+            to.push_back(angle_axis(-0.2f * value, normalize(vector3f(value, -1, 3))));
+        }
+
+        std::vector<quaternionf> result(from.size());
+
+        slerp(from.data(), to.data(), from.size(), 0.3f, result.data());
+        for (usize i = 0; i < from.size(); ++i) {
+            TEST_ASSERT(result[i] == slerp(from[i], to[i], 0.3f), "Batch slerp failed.");
+        }
+
+        nlerp(from.data(), to.data(), from.size(), 0.3f, result.data());
+        for (usize i = 0; i < from.size(); ++i) {
+            TEST_ASSERT(result[i] == nlerp(from[i], to[i], 0.3f), "Batch nlerp failed.");
+        }
+    }
+};
+
+int main()
+{
+    return run_tests(quaternion_tests());
+}
@@ -0,0 +1,213 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include <math/math.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::float32;
+using ::framework::uint32;
+using ::framework::usize;
+
+using ::framework::math::dual_quaterniond;
+using ::framework::math::dual_quaternionf;
+using ::framework::math::matrix4f;
+using ::framework::math::quaternionf;
+using ::framework::math::transformationf;
+using ::framework::math::vector3d;
+using ::framework::math::vector3f;
+using ::framework::math::vector4f;
+using ::framework::math::vector4u;
+
+using ::framework::math::angle_axis;
+using ::framework::math::dual_quaternion_cast;
+using ::framework::math::dual_quaternion_skinning;
+using ::framework::math::inverse;
+using ::framework::math::linear_blend_skinning;
+using ::framework::math::matrix4_cast;
+using ::framework::math::normalize;
+
+namespace details = ::framework::math::skinning_functions_details;
+
+class skinning_tests : public framework::unit_test::suite
+{
+public:
+    skinning_tests() : suite("skinning_tests")
+    {
+        add_test([this]() { transformation(); }, "transformation");
+        add_test([this]() { dual_quaternion(); }, "dual_quaternion");
+        add_test([this]() { linear_blend(); }, "linear_blend");
+        add_test([this]() { dual_quaternion_blend(); }, "dual_quaternion_blend");
+
+        rotation = angle_axis(0.75f, normalize(vector3f(1, -2, 3)));
+
+        for (usize i = 0; i < 4; ++i) {
+            const auto value = static_cast<float32>(i);
+            const dual_quaternionf bone(angle_axis(0.5f * value - 1.0f, normalize(vector3f(value, 1, 2))),
+                                        vector3f(value, -value, 2.0f));
+            dual_bones.push_back(bone);
+            matrix_bones.push_back(matrix4_cast(bone));
+        }
+
+        // Not a multiple of the SIMD width, includes points affected by one bone only.
+        for (usize i = 0; i < 23; ++i) {
+            const auto value = static_cast<float32>(i);
+            points.push_back(vector3f(value - 11.0f, 0.5f * value, 3.0f - 0.25f * value));
+            indices.push_back(vector4u(static_cast<uint32>(i % 4), static_cast<uint32>((i + 1) % 4), 2, 3));
+            weights.push_back(i % 5 == 0 ? vector4f(1, 0, 0, 0) : vector4f(0.5f, 0.25f, 0.125f, 0.125f));
+        }
+    }
+
+private:
+    // Elements close to zero differ in too many ULPs after a different order of operations.
+    static bool near(const vector3f& a, const vector3f& b)
+    {
+        for (uint32 i = 0; i < 3; ++i) {
+            if (std::abs(a[i] - b[i]) > 1e-4f) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void transformation()
+    {
+        const vector3f point(4, 5, -6);
+
+        TEST_ASSERT(transformationf() * point == point, "Identity transformation failed.");
+
+        const transformationf a(vector3f(1, 2, 3), rotation, vector3f(2, 3, 4));
+        const vector4f expected = matrix4_cast(a) * vector4f(point, 1);
+        TEST_ASSERT(near(a * point, vector3f(expected)), "Point transformation failed.");
+
+        const transformationf b(vector3f(-3, 0.5f, 1), angle_axis(-1.25f, normalize(vector3f(0, 1, 1))), vector3f(2));
+        const transformationf c(vector3f(0.5f, 1, 0), rotation, vector3f(0.5f, 3, 1));
+        const vector4f composed = matrix4_cast(b) * matrix4_cast(c) * vector4f(point, 1);
+        TEST_ASSERT(near((b * c) * point, vector3f(composed)), "Composition failed.");
+        TEST_ASSERT(near(b * (c * point), vector3f(composed)), "Composition is not associative.");
+
+        TEST_ASSERT(near(inverse(b) * (b * point), point), "Inverse failed.");
+    }
+
+    void dual_quaternion()
+    {
+        const vector3f point(4, 5, -6);
+        const vector3f translation(1, 2, 3);
+
+        TEST_ASSERT(dual_quaternionf() * point == point, "Identity dual quaternion failed.");
+
+        const dual_quaternionf a(rotation, translation);
+        TEST_ASSERT(near(a * point, rotation * point + translation), "Point transformation failed.");
+
+        const vector4f expected = matrix4_cast(a) * vector4f(point, 1);
+        TEST_ASSERT(near(a * point, vector3f(expected)), "Matrix conversion failed.");
+
+        const transformationf t(translation, rotation);
+        TEST_ASSERT(near(dual_quaternion_cast(t) * point, t * point), "Transformation conversion failed.");
+
+        const dual_quaternionf b(angle_axis(-1.25f, normalize(vector3f(0, 1, 1))), vector3f(-3, 0.5f, 1));
+        TEST_ASSERT(near((a * b) * point, a * (b * point)), "Composition failed.");
+        TEST_ASSERT(near(inverse(a) * (a * point), point), "Inverse failed.");
+
+        const dual_quaternionf scaled = normalize(a * 3.0f);
+        TEST_ASSERT(near(scaled * point, a * point), "Normalize failed.");
+
+        const dual_quaterniond d(angle_axis(0.5, vector3d(0, 0, 1)), vector3d(1, 0, 0));
+        const vector3d moved = d * vector3d(1, 0, 0);
+        TEST_ASSERT(std::abs(moved.x - (1.0 + std::cos(0.5))) < 1e-12 && std::abs(moved.y - std::sin(0.5)) < 1e-12,
+                    "Dual quaternion of float64 failed.");
+    }
+
+    void linear_blend()
+    {
+        std::vector<vector3f> result(points.size());
+        linear_blend_skinning(matrix_bones.data(), indices.data(), weights.data(), points.data(), points.size(),
+                              result.data());
+
+        for (usize i = 0; i < points.size(); ++i) {
+            const vector4u& index = indices[i];
+            const vector4f& w     = weights[i];
+            const vector4f p(points[i], 1);
+
+            const vector4f expected = matrix_bones[index[0]] * p * w[0] + matrix_bones[index[1]] * p * w[1] +
+                                      matrix_bones[index[2]] * p * w[2] + matrix_bones[index[3]] * p * w[3];
+            TEST_ASSERT(near(result[i], vector3f(expected)), "Linear blend skinning failed.");
+        }
+
+        std::vector<vector3f> generic(points.size());
+        details::linear_blend<float32>(matrix_bones.data(), indices.data(), weights.data(), points.data(),
+                                       points.size(), generic.data());
+        TEST_ASSERT(near(result[7], generic[7]) && near(result[22], generic[22]), "SIMD kernel differs.");
+    }
+
+    void dual_quaternion_blend()
+    {
+        std::vector<vector3f> result(points.size());
+        dual_quaternion_skinning(dual_bones.data(), indices.data(), weights.data(), points.data(), points.size(),
+                                 result.data(), 0);
+
+        for (usize i = 0; i < points.size(); ++i) {
+            if (weights[i][0] == 1.0f) {
+                TEST_ASSERT(near(result[i], dual_bones[indices[i][0]] * points[i]), "Single bone skinning failed.");
+            }
+
+            const dual_quaternionf blended = details::blend<float32>(dual_bones.data(), indices[i], weights[i]);
+            TEST_ASSERT(near(result[i], blended * points[i]), "SIMD kernel differs.");
+        }
+
+        // Blending of two rotations around the same axis is the rotation by the middle angle.
+        const vector3f axis(0, 0, 1);
+        const std::vector<dual_quaternionf> bones = {dual_quaternionf(angle_axis(0.5f, axis), vector3f(0)),
+                                                     dual_quaternionf(angle_axis(1.5f, axis), vector3f(0))};
+        const vector4u index(0, 1, 0, 0);
+        const vector4f weight(0.5f, 0.5f, 0, 0);
+        const vector3f point(2, 0, 0);
+
+        vector3f blended;
+        dual_quaternion_skinning(bones.data(), &index, &weight, &point, 1, &blended);
+        TEST_ASSERT(near(blended, vector3f(2 * std::cos(1.0f), 2 * std::sin(1.0f), 0)), "Volume is not preserved.");
+
+        // The opposite sign of a bone is the same rotation.
+        const std::vector<dual_quaternionf> flipped = {bones[0], bones[1] * -1.0f};
+        vector3f flipped_blended;
+        dual_quaternion_skinning(flipped.data(), &index, &weight, &point, 1, &flipped_blended);
+        TEST_ASSERT(near(flipped_blended, blended), "Shortest path is not taken.");
+    }
+
+    quaternionf rotation;
+    std::vector<dual_quaternionf> dual_bones;
+    std::vector<matrix4f> matrix_bones;
+    std::vector<vector3f> points;
+    std::vector<vector4u> indices;
+    std::vector<vector4f> weights;
+};
+
+int main()
+{
+    return run_tests(skinning_tests());
+}
@@ -23,6 +23,11 @@
 // SOFTWARE.
 // =============================================================================
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+
 #include <math/math.hpp>
 #include <unit_test/suite.hpp>
 
@@ -73,6 +78,9 @@ public:
         add_test([this]() { fma_function(); }, "fma_function");
         add_test([this]() { frexp_function(); }, "frexp_function");
         add_test([this]() { ldexp_function(); }, "ldexp_function");
+        add_test([this]() { simd_float_functions(); }, "simd_float_functions");
+        add_test([this]() { simd_int_functions(); }, "simd_int_functions");
+        add_test([this]() { simd_constant_evaluation(); }, "simd_constant_evaluation");
 
         v4d = {1.1, -1.5, 0.0, -1.8};
         v3f = {1.6f, -1.5f, 0.0f};
@@ -274,6 +282,100 @@ private:
         TEST_ASSERT(ldexp(frexp(v2u, &v2i_exponent), v2i_exponent) == vector2d(v2u), "Ldexp function failed.");
     }
 
+    // Results of the SIMD specializations must match the scalar implementation.
+    void simd_float_functions()
+    {
+        const std::array<vector4f, 4> values = {vector4f(1.5f, -2.25f, 0.0f, -0.0f),
+                                                vector4f(-1e30f, 1e-30f, 3.0f, -7.5f),
+                                                vector4f(65504.0f, -0.125f, 2.0f, 1e10f),
+                                                vector4f(-3.0f, 4.5f, -1e-10f, 8.0f)};
+
+        for (const vector4f& a : values) {
+            for (const vector4f& b : values) {
+                vector4f scalar_min;
+                vector4f scalar_max;
+                vector4f scalar_abs;
+                for (framework::uint32 i = 0; i < 4; ++i) {
+                    scalar_min[i] = std::min(a[i], b[i]);
+                    scalar_max[i] = std::max(a[i], b[i]);
+                    scalar_abs[i] = std::abs(a[i]);
+                }
+
+                TEST_ASSERT(min(a, b) == scalar_min, "SIMD min function differs from scalar.");
+                TEST_ASSERT(max(a, b) == scalar_max, "SIMD max function differs from scalar.");
+                TEST_ASSERT(min(a, b.y) == min(a, vector4f(b.y)), "SIMD min function differs from scalar.");
+                TEST_ASSERT(max(a, b.y) == max(a, vector4f(b.y)), "SIMD max function differs from scalar.");
+                TEST_ASSERT(abs(a) == scalar_abs, "SIMD abs function differs from scalar.");
+            }
+        }
+
+        // Products and sums are exact, so fused and separate operations give the same result.
+        const std::array<vector4f, 3> exact = {vector4f(1.5f, -2.25f, 0.0f, 16.0f),
+                                               vector4f(-0.75f, 4.0f, -3.5f, 0.25f),
+                                               vector4f(10.0f, -0.5f, 7.25f, -12.0f)};
+
+        for (const vector4f& a : exact) {
+            for (const vector4f& b : exact) {
+                for (const vector4f& c : exact) {
+                    vector4f scalar_fma;
+                    for (framework::uint32 i = 0; i < 4; ++i) {
+                        scalar_fma[i] = a[i] * b[i] + c[i];
+                    }
+
+                    TEST_ASSERT(fma(a, b, c) == scalar_fma, "SIMD fma function differs from scalar.");
+                }
+            }
+        }
+    }
+
+    // Covers SSE2 fallbacks of int32 multiplication, min and max without SSE4.1.
+    void simd_int_functions()
+    {
+        const std::array<vector4i, 4> values = {vector4i(1, -2, 0, 46340),
+                                                vector4i(-46340, 46341, -1, 7),
+                                                vector4i(2147483647, -2147483647, 3, -8),
+                                                vector4i(-65536, 65535, 32768, -32769)};
+
+        for (const vector4i& a : values) {
+            for (const vector4i& b : values) {
+                vector4i scalar_min;
+                vector4i scalar_max;
+                vector4i scalar_abs;
+                vector4i scalar_mul;
+                for (framework::uint32 i = 0; i < 4; ++i) {
+                    scalar_min[i] = std::min(a[i], b[i]);
+                    scalar_max[i] = std::max(a[i], b[i]);
+                    scalar_abs[i] = std::abs(a[i]);
+
+                    // Wraps like the SIMD instructions do, signed overflow is undefined.
+                    scalar_mul[i] = static_cast<framework::int32>(static_cast<framework::uint32>(a[i]) *
+                                                                  static_cast<framework::uint32>(b[i]));
+                }
+
+                vector4i product = a;
+                product *= b;
+
+                TEST_ASSERT(min(a, b) == scalar_min, "SIMD min function differs from scalar.");
+                TEST_ASSERT(max(a, b) == scalar_max, "SIMD max function differs from scalar.");
+                TEST_ASSERT(abs(a) == scalar_abs, "SIMD abs function differs from scalar.");
+                TEST_ASSERT(product == scalar_mul, "SIMD multiplication differs from scalar.");
+            }
+        }
+    }
+
+    // The SIMD specializations have to stay usable in constant expressions.
+    void simd_constant_evaluation()
+    {
+        constexpr vector4f float_abs = abs(vector4f(1.5f, -2.25f, 0.0f, -8.0f));
+        constexpr vector4i int_abs   = abs(vector4i(1, -2, 0, -2147483647));
+
+        static_assert(float_abs == vector4f(1.5f, 2.25f, 0.0f, 8.0f), "Constexpr abs function failed.");
+        static_assert(int_abs == vector4i(1, 2, 0, 2147483647), "Constexpr abs function failed.");
+
+        TEST_ASSERT(abs(vector4f(1.5f, -2.25f, 0.0f, -8.0f)) == float_abs, "SIMD abs function differs from constexpr.");
+        TEST_ASSERT(abs(vector4i(1, -2, 0, -2147483647)) == int_abs, "SIMD abs function differs from constexpr.");
+    }
+
     vector4d v4d;
     vector3f v3f;
     vector3i v3i;
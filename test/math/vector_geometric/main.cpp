@@ -23,11 +23,16 @@
 // SOFTWARE.
 // =============================================================================
 
+#include <array>
+#include <cmath>
+
 #include <math/math.hpp>
 #include <unit_test/suite.hpp>
 
 using ::framework::math::vector2f;
 using ::framework::math::vector3f;
+using ::framework::math::vector4f;
+using ::framework::math::vector4i;
 
 using ::framework::math::almost_equal;
 
@@ -39,6 +44,7 @@ public:
         add_test([this]() { length_function(); }, "length_function");
         add_test([this]() { distance_function(); }, "distance_function");
         add_test([this]() { dot_function(); }, "dot_function");
+        add_test([this]() { simd_dot_function(); }, "simd_dot_function");
         add_test([this]() { cross_function(); }, "cross_function");
         add_test([this]() { normalize_function(); }, "normalize_function");
         add_test([this]() { faceforward_function(); }, "faceforward_function");
@@ -69,6 +75,32 @@ private:
         TEST_ASSERT(almost_equal(dot(vector2f{0.0f, 1.0f}, vector2f{1.0f, 0.0f}), 0.0f), "Dot function failed.");
     }
 
+    // Results of the SIMD dot product must match the scalar implementation.
+    void simd_dot_function()
+    {
+        const std::array<vector4f, 3> exact = {vector4f(1.5f, -2.25f, 0.0f, 16.0f),
+                                               vector4f(-0.75f, 4.0f, -3.5f, 0.25f),
+                                               vector4f(10.0f, -0.5f, 7.25f, -12.0f)};
+
+        for (const vector4f& a : exact) {
+            for (const vector4f& b : exact) {
+                const float scalar = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+                TEST_ASSERT(dot(a, b) == scalar, "SIMD dot function differs from scalar.");
+            }
+        }
+
+        // Summation order of SIMD may differ, the results are equal up to rounding.
+        const vector4f a(0.1f, -123.456f, 1e-3f, 7.77f);
+        const vector4f b(3.3f, 0.0625f, -987.5f, 1.0f / 3.0f);
+        const float scalar = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+
+        TEST_ASSERT(std::abs(dot(a, b) - scalar) <= 1e-6f * (std::abs(a.x * b.x) + std::abs(a.y * b.y) +
+                                                            std::abs(a.z * b.z) + std::abs(a.w * b.w)),
+                    "SIMD dot function differs from scalar.");
+
+        TEST_ASSERT(dot(vector4i(1, -2, 3, -4), vector4i(-5, 6, 7, 8)) == -28, "Dot function failed.");
+    }
+
     void cross_function()
     {
         TEST_ASSERT(cross(vector3f(3.0f, 2.0f, 1.0f), v3f) == vector3f(4, -8, 4), "Cross function failed.");
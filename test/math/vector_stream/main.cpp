@@ -0,0 +1,199 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <cstdint>
+#include <vector>
+
+#include <math/math.hpp>
+#include <unit_test/suite.hpp>
+
+using ::framework::float32;
+using ::framework::int32;
+using ::framework::usize;
+
+using ::framework::math::matrix3f;
+using ::framework::math::vector3d;
+using ::framework::math::vector3f;
+using ::framework::math::vector3i;
+using ::framework::math::vector_stream;
+using ::framework::math::vector_stream3d;
+using ::framework::math::vector_stream3f;
+
+using ::framework::math::almost_equal;
+
+class vector_stream_tests : public framework::unit_test::suite
+{
+public:
+    vector_stream_tests() : suite("vector_stream_tests")
+    {
+        add_test([this]() { storage(); }, "storage");
+        add_test([this]() { resize_padding(); }, "resize_padding");
+        add_test([this]() { geometric_functions(); }, "geometric_functions");
+        add_test([this]() { common_functions(); }, "common_functions");
+        add_test([this]() { matrix_multiplication(); }, "matrix_multiplication");
+        add_test([this]() { other_types(); }, "other_types");
+
+        // Not a multiple of the lanes count to check the padding, products are exact.
+        for (usize i = 0; i < 37; ++i) {
+            const auto value = static_cast<float32>(i);
+            lhs.push_back(vector3f(value - 18.0f, 0.5f * value, 3.0f - 0.125f * value));
+            rhs.push_back(vector3f(1.0f + value, -2.0f, 0.25f * value));
+        }
+    }
+
+private:
+    void storage()
+    {
+        vector_stream3f stream = {vector3f(1, 2, 3), vector3f(4, 5, 6)};
+
+        TEST_ASSERT(stream.size() == 2, "Wrong stream size.");
+        TEST_ASSERT(stream.aligned_size() == vector_stream3f::lanes, "Wrong aligned size.");
+        TEST_ASSERT(stream.get(1) == vector3f(4, 5, 6), "Wrong stream value.");
+
+        for (framework::uint32 c = 0; c < 3; ++c) {
+            TEST_ASSERT(reinterpret_cast<std::uintptr_t>(stream.data(c)) % 64 == 0, "Component is not aligned.");
+        }
+
+        stream.set(0, vector3f(7, 8, 9));
+        TEST_ASSERT(stream.get(0) == vector3f(7, 8, 9), "Wrong stream value after set.");
+
+        stream.resize(1);
+        TEST_ASSERT(stream.data(0)[1] == 0.0f, "Padding is not cleared after resize.");
+
+        for (usize i = 0; i < vector_stream3f::lanes; ++i) {
+            stream.push_back(vector3f(1, 1, 1));
+        }
+        TEST_ASSERT(stream.size() == vector_stream3f::lanes + 1, "Wrong stream size after push_back.");
+        TEST_ASSERT(stream.aligned_size() == 2 * vector_stream3f::lanes, "Wrong aligned size after push_back.");
+        TEST_ASSERT(stream.get(0) == vector3f(7, 8, 9), "Value is lost after push_back.");
+
+        std::vector<vector3f> values(lhs.size());
+        lhs.copy_to(values.begin());
+
+        const vector_stream3f copy(values.begin(), values.end());
+        TEST_ASSERT(copy.size() == lhs.size() && copy.get(36) == lhs.get(36), "Wrong copy of the stream.");
+
+        stream.clear();
+        TEST_ASSERT(stream.empty(), "Stream is not empty after clear.");
+    }
+
+    void resize_padding()
+    {
+        // Normalization of the zero padding lanes writes NaN to them.
+        vector_stream3f stream = {vector3f(1, 2, 3)};
+        normalize(stream, stream);
+
+        stream.resize(2);
+        TEST_ASSERT(stream.get(1) == vector3f(0, 0, 0), "New vector is not zero after resize.");
+
+        stream.set(1, vector3f(0, 0, 1));
+        normalize(stream, stream);
+
+        stream.resize(vector_stream3f::lanes + 1);
+        for (usize i = 2; i < stream.size(); ++i) {
+            TEST_ASSERT(stream.get(i) == vector3f(0, 0, 0), "New vector is not zero after resize.");
+        }
+    }
+
+    void geometric_functions()
+    {
+        std::vector<float32> dots, lengths;
+        vector_stream3f crosses, normals;
+
+        dot(lhs, rhs, dots);
+        length(lhs, lengths);
+        cross(lhs, rhs, crosses);
+        normalize(rhs, normals);
+
+        TEST_ASSERT(dots.size() == lhs.size() && lengths.size() == lhs.size(), "Wrong size of scalar results.");
+        TEST_ASSERT(crosses.size() == lhs.size() && normals.size() == lhs.size(), "Wrong size of vector results.");
+
+        for (usize i = 0; i < lhs.size(); ++i) {
+            TEST_ASSERT(almost_equal(dots[i], dot(lhs.get(i), rhs.get(i))), "Dot function failed.");
+            TEST_ASSERT(almost_equal(lengths[i], length(lhs.get(i))), "Length function failed.");
+            TEST_ASSERT(almost_equal(crosses.get(i), cross(lhs.get(i), rhs.get(i))), "Cross function failed.");
+            TEST_ASSERT(almost_equal(normals.get(i), normalize(rhs.get(i))), "Normalize function failed.");
+        }
+
+        vector_stream3f in_place = rhs;
+        normalize(in_place, in_place);
+        TEST_ASSERT(almost_equal(in_place.get(5), normals.get(5)), "In-place normalize failed.");
+    }
+
+    void common_functions()
+    {
+        vector_stream3f mixed, clamped, clamped_components;
+
+        mix(lhs, rhs, 0.25f, mixed);
+        clamp(lhs, -1.0f, 1.0f, clamped);
+        clamp(lhs, vector3f(-1, 0, 1), vector3f(1, 2, 3), clamped_components);
+
+        for (usize i = 0; i < lhs.size(); ++i) {
+            TEST_ASSERT(almost_equal(mixed.get(i), mix(lhs.get(i), rhs.get(i), 0.25f)), "Mix function failed.");
+            TEST_ASSERT(clamped.get(i) == clamp(lhs.get(i), -1.0f, 1.0f), "Clamp function failed.");
+            TEST_ASSERT(clamped_components.get(i) == clamp(lhs.get(i), vector3f(-1, 0, 1), vector3f(1, 2, 3)),
+                        "Clamp function with vectors failed.");
+        }
+    }
+
+    void matrix_multiplication()
+    {
+        const matrix3f m = {0.5f, 1.0f, -2.0f, 3.0f, 0.25f, 1.5f, -1.0f, 2.0f, 0.75f};
+
+        vector_stream3f result;
+        multiply(m, lhs, result);
+
+        for (usize i = 0; i < lhs.size(); ++i) {
+            TEST_ASSERT(almost_equal(result.get(i), m * lhs.get(i)), "Matrix multiplication failed.");
+        }
+    }
+
+    void other_types()
+    {
+        const vector_stream3d doubles = {vector3d(3, 4, 0), vector3d(0, 0, 2)};
+
+        std::vector<double> lengths;
+        length(doubles, lengths);
+        TEST_ASSERT(lengths.size() == 2 && lengths[0] == 5.0 && lengths[1] == 2.0, "Length of float64 stream failed.");
+
+        const vector_stream<3, int32> integers = {vector3i(1, 2, 3), vector3i(-4, 5, -6)};
+
+        std::vector<int32> dots;
+        dot(integers, integers, dots);
+        TEST_ASSERT(dots.size() == 2 && dots[0] == 14 && dots[1] == 77, "Dot of int32 stream failed.");
+
+        vector_stream<3, int32> crosses;
+        cross(integers, integers, crosses);
+        TEST_ASSERT(crosses.get(1) == vector3i(0, 0, 0), "Cross of int32 stream failed.");
+    }
+
+    vector_stream3f lhs;
+    vector_stream3f rhs;
+};
+
+int main()
+{
+    return run_tests(vector_stream_tests());
+}
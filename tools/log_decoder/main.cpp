@@ -0,0 +1,87 @@
+
+// =============================================================================
+// MIT License
+//
+// Copyright (c) 2017-2018 Fedorov Alexey
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+#include <ctime>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <log/binary_log_reader.hpp>
+
+namespace
+{
+void print_time(std::ostream& output, framework::uint64 timestamp)
+{
+    const auto seconds     = static_cast<std::time_t>(timestamp / 1000000000);
+    const auto nanoseconds = timestamp % 1000000000;
+
+    char buffer[32];
+    const std::tm* time = std::gmtime(&seconds);
+    if (time == nullptr || std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", time) == 0) {
+        output << seconds;
+    } else {
+        output << buffer;
+    }
+
+    output << '.' << std::setw(9) << std::setfill('0') << nanoseconds << std::setfill(' ');
+}
+
+void decode(const std::string& path)
+{
+    framework::log::binary_log_reader reader(path);
+    framework::log::binary_record record;
+
+    while (reader.next(record)) {
+        print_time(std::cout, record.timestamp);
+        std::cout << " [" << record.level << "] #" << record.thread << " " << record.tag << ": " << record.message;
+
+        if (record.message.empty() || record.message.back() != '\n') {
+            std::cout << '\n';
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <file>..." << std::endl;
+        return 1;
+    }
+
+    int result = 0;
+    for (int i = 1; i < argc; ++i) {
+        try {
+            decode(argv[i]);
+        } catch (const std::exception& exception) {
+            std::cerr << exception.what() << std::endl;
+            result = 1;
+        }
+    }
+
+    return result;
+}